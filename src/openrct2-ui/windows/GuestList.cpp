@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include <algorithm>
 #include <cmath>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Widget.h>
@@ -16,6 +17,7 @@
 #include <openrct2/config/Config.h>
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/localisation/Localisation.h>
+#include <openrct2/peep/GuestGroups.h>
 #include <openrct2/scenario/Scenario.h>
 #include <openrct2/sprites.h>
 #include <openrct2/util/Util.h>
@@ -154,7 +156,6 @@ static uint16_t _window_guest_list_groups_num_guests[240];
 static uint32_t _window_guest_list_groups_argument_1[240];
 static uint32_t _window_guest_list_groups_argument_2[240];
 static uint8_t _window_guest_list_groups_guest_faces[240 * 58];
-static uint8_t _window_guest_list_group_index[240];
 
 static char _window_guest_list_filter_name[32];
 
@@ -901,24 +902,8 @@ static void get_arguments_from_peep(Peep* peep, uint32_t* argument_1, uint32_t*
             get_arguments_from_action(peep, argument_1, argument_2);
             break;
         case VIEW_THOUGHTS:
-        {
-            rct_peep_thought* thought = &peep->thoughts[0];
-            if (thought->freshness <= 5 && thought->type != PEEP_THOUGHT_TYPE_NONE)
-            {
-                // HACK The out arguments here are used to draw the group text so we just return
-                //      gCommonFormatArgs as two uint32_ts.
-                std::memset(gCommonFormatArgs, 0, sizeof(*argument_1) + sizeof(*argument_2));
-                peep_thought_set_format_args(thought);
-                std::memcpy(argument_1, gCommonFormatArgs, sizeof(*argument_1));
-                std::memcpy(argument_2, gCommonFormatArgs + sizeof(*argument_1), sizeof(*argument_2));
-            }
-            else
-            {
-                *argument_1 = 0;
-                *argument_2 = 0;
-            }
+            get_arguments_from_thought(peep, argument_1, argument_2);
             break;
-        }
         default:
             *argument_1 = 0;
             *argument_2 = 0;
@@ -932,9 +917,6 @@ static void get_arguments_from_peep(Peep* peep, uint32_t* argument_1, uint32_t*
  */
 static void window_guest_list_find_groups()
 {
-    int32_t spriteIndex, spriteIndex2, groupIndex, faceIndex;
-    Peep *peep, *peep2;
-
     uint32_t tick256 = floor2(gScenarioTicks, 256);
     if (_window_guest_list_selected_view == _window_guest_list_last_find_groups_selected_view)
     {
@@ -947,117 +929,16 @@ static void window_guest_list_find_groups()
     _window_guest_list_last_find_groups_tick = tick256;
     _window_guest_list_last_find_groups_selected_view = _window_guest_list_selected_view;
     _window_guest_list_last_find_groups_wait = 320;
-    _window_guest_list_num_groups = 0;
 
-    // Set all guests to unassigned
-    FOR_ALL_GUESTS (spriteIndex, peep)
-        if (peep->outside_of_park == 0)
-            peep->flags |= SPRITE_FLAGS_PEEP_VISIBLE;
-
-    // For each guest / group
-    FOR_ALL_GUESTS (spriteIndex, peep)
+    auto groups = guest_groups_find(get_arguments_from_peep, 240, 56);
+    _window_guest_list_num_groups = (int32_t)groups.size();
+    for (int32_t groupIndex = 0; groupIndex < _window_guest_list_num_groups; groupIndex++)
     {
-        if (peep->outside_of_park != 0 || !(peep->flags & SPRITE_FLAGS_PEEP_VISIBLE))
-            continue;
-
-        // New group, cap at 240 though
-        groupIndex = _window_guest_list_num_groups;
-        if (groupIndex >= 240)
-            break;
-
-        _window_guest_list_num_groups++;
-        _window_guest_list_groups_num_guests[groupIndex] = 1;
-        peep->flags &= ~(SPRITE_FLAGS_PEEP_VISIBLE);
-
-        get_arguments_from_peep(
-            peep, &_window_guest_list_groups_argument_1[groupIndex], &_window_guest_list_groups_argument_2[groupIndex]);
-        std::memcpy(_window_guest_list_filter_arguments + 0, &_window_guest_list_groups_argument_1[groupIndex], 4);
-        std::memcpy(_window_guest_list_filter_arguments + 2, &_window_guest_list_groups_argument_2[groupIndex], 4);
-
-        _window_guest_list_group_index[groupIndex] = groupIndex;
-        faceIndex = groupIndex * 56;
-        _window_guest_list_groups_guest_faces[faceIndex++] = get_peep_face_sprite_small(peep)
-            - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
-
-        // Find more peeps that belong to same group
-        FOR_ALL_GUESTS (spriteIndex2, peep2)
-        {
-            if (peep2->outside_of_park != 0 || !(peep2->flags & SPRITE_FLAGS_PEEP_VISIBLE))
-                continue;
-
-            uint32_t argument1, argument2;
-            // Get and check if in same group
-            get_arguments_from_peep(peep2, &argument1, &argument2);
-            if (argument1 != _window_guest_list_groups_argument_1[groupIndex]
-                || argument2 != _window_guest_list_groups_argument_2[groupIndex])
-                continue;
-
-            // Assign guest
-            _window_guest_list_groups_num_guests[groupIndex]++;
-            peep2->flags &= ~(SPRITE_FLAGS_PEEP_VISIBLE);
-
-            // Add face sprite, cap at 56 though
-            if (_window_guest_list_groups_num_guests[groupIndex] >= 56)
-                continue;
-            _window_guest_list_groups_guest_faces[faceIndex++] = get_peep_face_sprite_small(peep2)
-                - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
-        }
-
-        if (_window_guest_list_filter_arguments[0] == 0)
-        {
-            _window_guest_list_num_groups--;
-            continue;
-        }
-
-        int32_t curr_num_guests = _window_guest_list_groups_num_guests[groupIndex];
-        int32_t swap_position = 0;
-        // This section places the groups in size order.
-        bool gotoNextPeep = false;
-        while (1)
-        {
-            if (swap_position >= groupIndex)
-            {
-                gotoNextPeep = true;
-                break;
-            }
-            if (curr_num_guests > _window_guest_list_groups_num_guests[swap_position])
-                break;
-            swap_position++;
-        }
-        if (gotoNextPeep)
-        {
-            continue;
-        }
-
-        int32_t argument_1 = _window_guest_list_groups_argument_1[groupIndex];
-        int32_t argument_2 = _window_guest_list_groups_argument_2[groupIndex];
-        int32_t bl = _window_guest_list_group_index[groupIndex];
-
-        do
-        {
-            int32_t temp = curr_num_guests;
-            curr_num_guests = _window_guest_list_groups_num_guests[swap_position];
-            _window_guest_list_groups_num_guests[swap_position] = temp;
-
-            temp = argument_1;
-            argument_1 = _window_guest_list_groups_argument_1[swap_position];
-            _window_guest_list_groups_argument_1[swap_position] = temp;
-
-            temp = argument_2;
-            argument_2 = _window_guest_list_groups_argument_2[swap_position];
-            _window_guest_list_groups_argument_2[swap_position] = temp;
-
-            uint8_t temp_faces[56];
-            std::memcpy(temp_faces, &(_window_guest_list_groups_guest_faces[groupIndex * 56]), 56);
-            std::memcpy(
-                &(_window_guest_list_groups_guest_faces[groupIndex * 56]),
-                &(_window_guest_list_groups_guest_faces[swap_position * 56]), 56);
-            std::memcpy(&(_window_guest_list_groups_guest_faces[swap_position * 56]), temp_faces, 56);
-
-            temp = _window_guest_list_group_index[swap_position];
-            _window_guest_list_group_index[swap_position] = bl;
-            bl = temp;
-        } while (++swap_position <= groupIndex);
+        const GuestGroup& group = groups[groupIndex];
+        _window_guest_list_groups_num_guests[groupIndex] = group.NumGuests;
+        _window_guest_list_groups_argument_1[groupIndex] = group.Argument1;
+        _window_guest_list_groups_argument_2[groupIndex] = group.Argument2;
+        std::copy(group.Faces.begin(), group.Faces.end(), &_window_guest_list_groups_guest_faces[groupIndex * 56]);
     }
 }
 
@@ -173,14 +173,31 @@ static uint32_t _currentLine;
 /** rct2: 0x00F1AD68 */
 static std::vector<uint8_t> _mapImageData;
 
+// Number of lines of the minimap still to be redrawn in full after it was opened, rotated, switched to another tab or
+// missed some invalidated tiles. Afterwards only invalidated tiles are redrawn, together with a slow sweep over the
+// lines for the few changes that do not invalidate their tile.
+static uint32_t _mapLinesToRefresh;
+static std::vector<TileCoordsXY> _mapInvalidatedTiles;
+
+struct MapOverlayPixel
+{
+    int16_t Left;
+    int16_t Right;
+    int16_t Top;
+    uint8_t Colour;
+};
+
+// The peeps or vehicles drawn on top of the minimap, taken once per update rather than on every paint
+static std::vector<MapOverlayPixel> _mapOverlayPixels;
+
 static uint16_t _landRightsToolSize;
 
 static void window_map_init_map();
 static void window_map_centre_on_view_point();
 static void window_map_show_default_scenario_editor_buttons(rct_window* w);
 static void window_map_draw_tab_images(rct_window* w, rct_drawpixelinfo* dpi);
-static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi);
-static void window_map_paint_train_overlay(rct_drawpixelinfo* dpi);
+static void window_map_update_overlay(rct_window* w);
+static void window_map_paint_overlay(rct_drawpixelinfo* dpi);
 static void window_map_paint_hud_rectangle(rct_drawpixelinfo* dpi);
 static void window_map_inputsize_land(rct_window* w);
 static void window_map_inputsize_map(rct_window* w);
@@ -192,7 +209,7 @@ static void window_map_place_park_entrance_tool_down(int32_t x, int32_t y);
 static void window_map_set_peep_spawn_tool_down(int32_t x, int32_t y);
 static void map_window_increase_map_size();
 static void map_window_decrease_map_size();
-static void map_window_set_pixels(rct_window* w);
+static void map_window_update_pixels(rct_window* w);
 
 static CoordsXY map_window_screen_to_map(int32_t screenX, int32_t screenY);
 
@@ -373,6 +390,8 @@ static void window_map_mouseup(rct_window* w, rct_widgetindex widgetIndex)
 
                 w->selected_tab = widgetIndex;
                 w->list_information_type = 0;
+                _mapLinesToRefresh = MAXIMUM_MAP_SIZE_TECHNICAL;
+                window_map_update_overlay(w);
             }
     }
 }
@@ -432,8 +451,8 @@ static void window_map_update(rct_window* w)
         window_map_centre_on_view_point();
     }
 
-    for (int32_t i = 0; i < 16; i++)
-        map_window_set_pixels(w);
+    map_window_update_pixels(w);
+    window_map_update_overlay(w);
 
     window_invalidate(w);
 
@@ -879,14 +898,7 @@ static void window_map_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi, int32_
     gfx_set_g1_element(SPR_TEMP, &g1temp);
     gfx_draw_sprite(dpi, SPR_TEMP, 0, 0, 0);
 
-    if (w->selected_tab == PAGE_PEEPS)
-    {
-        window_map_paint_peep_overlay(dpi);
-    }
-    else
-    {
-        window_map_paint_train_overlay(dpi);
-    }
+    window_map_paint_overlay(dpi);
     window_map_paint_hud_rectangle(dpi);
 }
 
@@ -898,6 +910,8 @@ static void window_map_init_map()
 {
     std::fill(_mapImageData.begin(), _mapImageData.end(), PALETTE_INDEX_10);
     _currentLine = 0;
+    _mapLinesToRefresh = MAXIMUM_MAP_SIZE_TECHNICAL;
+    _mapOverlayPixels.clear();
 }
 
 /**
@@ -1040,7 +1054,7 @@ static MapCoordsXY window_map_transform_to_map_coords(CoordsXY c)
  *
  *  rct2: 0x0068DADA
  */
-static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
+static void window_map_update_peep_overlay()
 {
     Peep* peep;
     uint16_t spriteIndex;
@@ -1055,9 +1069,8 @@ static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
         int16_t top = c.y;
 
         int16_t right = left;
-        int16_t bottom = top;
 
-        int16_t colour = PALETTE_INDEX_20;
+        uint8_t colour = PALETTE_INDEX_20;
 
         if (sprite_get_flashing((rct_sprite*)peep))
         {
@@ -1082,7 +1095,7 @@ static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
                 }
             }
         }
-        gfx_fill_rect(dpi, left, top, right, bottom, colour);
+        _mapOverlayPixels.push_back({ left, right, top, colour });
     }
 }
 
@@ -1090,7 +1103,7 @@ static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
  *
  *  rct2: 0x0068DBC1
  */
-static void window_map_paint_train_overlay(rct_drawpixelinfo* dpi)
+static void window_map_update_train_overlay()
 {
     rct_vehicle *train, *vehicle;
     uint16_t train_index, vehicle_index;
@@ -1106,11 +1119,32 @@ static void window_map_paint_train_overlay(rct_drawpixelinfo* dpi)
 
             MapCoordsXY c = window_map_transform_to_map_coords({ vehicle->x, vehicle->y });
 
-            gfx_fill_rect(dpi, c.x, c.y, c.x, c.y, PALETTE_INDEX_171);
+            _mapOverlayPixels.push_back({ (int16_t)c.x, (int16_t)c.x, (int16_t)c.y, PALETTE_INDEX_171 });
         }
     }
 }
 
+static void window_map_update_overlay(rct_window* w)
+{
+    _mapOverlayPixels.clear();
+    if (w->selected_tab == PAGE_PEEPS)
+    {
+        window_map_update_peep_overlay();
+    }
+    else
+    {
+        window_map_update_train_overlay();
+    }
+}
+
+static void window_map_paint_overlay(rct_drawpixelinfo* dpi)
+{
+    for (const auto& pixel : _mapOverlayPixels)
+    {
+        gfx_fill_rect(dpi, pixel.Left, pixel.Top, pixel.Right, pixel.Top, pixel.Colour);
+    }
+}
+
 /**
  * The call to gfx_fill_rect was originally wrapped in sub_68DABD which made sure that arguments were ordered correctly,
  * but it doesn't look like it's ever necessary here so the call was removed.
@@ -1605,70 +1639,102 @@ static uint16_t map_window_get_pixel_colour_ride(CoordsXY c)
     return colourB;
 }
 
-static void map_window_set_pixels(rct_window* w)
+static void map_window_set_tile_pixels(rct_window* w, TileCoordsXY tile)
 {
-    uint16_t colour = 0;
-    int32_t x = 0, y = 0, dx = 0, dy = 0;
-
-    int32_t pos = (_currentLine * (MAP_WINDOW_MAP_SIZE - 1)) + MAXIMUM_MAP_SIZE_TECHNICAL - 1;
-    LocationXY16 destinationPosition = MakeXY16(pos % MAP_WINDOW_MAP_SIZE, pos / MAP_WINDOW_MAP_SIZE);
-    auto destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
+    // The minimap is drawn in diagonal lines, each running along one axis of the map depending on the rotation
+    int32_t line = 0, position = 0;
     switch (get_current_rotation())
     {
         case 0:
-            x = _currentLine * 32;
-            y = 0;
-            dx = 0;
-            dy = 32;
+            line = tile.x;
+            position = tile.y;
             break;
         case 1:
-            x = (MAXIMUM_MAP_SIZE_TECHNICAL - 1) * 32;
-            y = _currentLine * 32;
-            dx = -32;
-            dy = 0;
+            line = tile.y;
+            position = (MAXIMUM_MAP_SIZE_TECHNICAL - 1) - tile.x;
             break;
         case 2:
-            x = ((MAXIMUM_MAP_SIZE_TECHNICAL - 1) - _currentLine) * 32;
-            y = (MAXIMUM_MAP_SIZE_TECHNICAL - 1) * 32;
-            dx = 0;
-            dy = -32;
+            line = (MAXIMUM_MAP_SIZE_TECHNICAL - 1) - tile.x;
+            position = (MAXIMUM_MAP_SIZE_TECHNICAL - 1) - tile.y;
             break;
         case 3:
-            x = 0;
-            y = ((MAXIMUM_MAP_SIZE_TECHNICAL - 1) - _currentLine) * 32;
-            dx = 32;
-            dy = 0;
+            line = (MAXIMUM_MAP_SIZE_TECHNICAL - 1) - tile.y;
+            position = tile.x;
+            break;
+    }
+
+    CoordsXY coords = { tile.x * 32, tile.y * 32 };
+    if (coords.x <= 0 || coords.y <= 0 || coords.x >= gMapSizeUnits || coords.y >= gMapSizeUnits)
+        return;
+
+    uint16_t colour = 0;
+    switch (w->selected_tab)
+    {
+        case PAGE_PEEPS:
+            colour = map_window_get_pixel_colour_peep(coords);
+            break;
+        case PAGE_RIDES:
+            colour = map_window_get_pixel_colour_ride(coords);
             break;
     }
 
+    int32_t destinationX = (MAXIMUM_MAP_SIZE_TECHNICAL - 1) - line + position;
+    int32_t destinationY = line + position;
+    auto destination = _mapImageData.data() + (destinationY * MAP_WINDOW_MAP_SIZE) + destinationX;
+    destination[0] = (colour >> 8) & 0xFF;
+    destination[1] = colour;
+}
+
+static void map_window_set_pixels(rct_window* w)
+{
     for (int32_t i = 0; i < MAXIMUM_MAP_SIZE_TECHNICAL; i++)
     {
-        if (x > 0 && y > 0 && x < gMapSizeUnits && y < gMapSizeUnits)
+        TileCoordsXY tile;
+        switch (get_current_rotation())
         {
-            switch (w->selected_tab)
-            {
-                case PAGE_PEEPS:
-                    colour = map_window_get_pixel_colour_peep({ x, y });
-                    break;
-                case PAGE_RIDES:
-                    colour = map_window_get_pixel_colour_ride({ x, y });
-                    break;
-            }
-            destination[0] = (colour >> 8) & 0xFF;
-            destination[1] = colour;
+            case 0:
+                tile = { (int32_t)_currentLine, i };
+                break;
+            case 1:
+                tile = { (MAXIMUM_MAP_SIZE_TECHNICAL - 1) - i, (int32_t)_currentLine };
+                break;
+            case 2:
+                tile = { (MAXIMUM_MAP_SIZE_TECHNICAL - 1) - (int32_t)_currentLine, (MAXIMUM_MAP_SIZE_TECHNICAL - 1) - i };
+                break;
+            default:
+                tile = { i, (MAXIMUM_MAP_SIZE_TECHNICAL - 1) - (int32_t)_currentLine };
+                break;
         }
-        x += dx;
-        y += dy;
-
-        destinationPosition.x++;
-        destinationPosition.y++;
-        destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
+        map_window_set_tile_pixels(w, tile);
     }
     _currentLine++;
     if (_currentLine >= MAXIMUM_MAP_SIZE_TECHNICAL)
         _currentLine = 0;
 }
 
+static void map_window_update_pixels(rct_window* w)
+{
+    if (!map_take_invalidated_tiles(_mapInvalidatedTiles))
+    {
+        _mapLinesToRefresh = MAXIMUM_MAP_SIZE_TECHNICAL;
+    }
+    for (const auto& tile : _mapInvalidatedTiles)
+    {
+        map_window_set_tile_pixels(w, tile);
+    }
+
+    uint32_t numLines = 1;
+    if (_mapLinesToRefresh > 0)
+    {
+        numLines = std::min<uint32_t>(16, _mapLinesToRefresh);
+        _mapLinesToRefresh -= numLines;
+    }
+    for (uint32_t i = 0; i < numLines; i++)
+    {
+        map_window_set_pixels(w);
+    }
+}
+
 static CoordsXY map_window_screen_to_map(int32_t screenX, int32_t screenY)
 {
     screenX = ((screenX + 8) - MAXIMUM_MAP_SIZE_TECHNICAL) / 2;
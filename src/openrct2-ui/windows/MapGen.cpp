@@ -19,6 +19,7 @@
 #include <openrct2/object/ObjectManager.h>
 #include <openrct2/object/TerrainEdgeObject.h>
 #include <openrct2/object/TerrainSurfaceObject.h>
+#include <openrct2/platform/platform.h>
 #include <openrct2/util/Util.h>
 #include <openrct2/windows/Intent.h>
 #include <openrct2/world/MapGen.h>
@@ -818,6 +819,7 @@ static void window_mapgen_random_mouseup(rct_window* w, rct_widgetindex widgetIn
             mapgenSettings.floor = _randomTerrain ? -1 : _floorTexture;
             mapgenSettings.wall = _randomTerrain ? -1 : _wallTexture;
             mapgenSettings.trees = _placeTrees;
+            mapgenSettings.seed = platform_get_ticks();
 
             mapgenSettings.simplex_low = util_rand() % 4;
             mapgenSettings.simplex_high = 12 + (util_rand() % (32 - 12));
@@ -898,6 +900,7 @@ static void window_mapgen_simplex_mouseup(rct_window* w, rct_widgetindex widgetI
             mapgenSettings.floor = _randomTerrain ? -1 : _floorTexture;
             mapgenSettings.wall = _randomTerrain ? -1 : _wallTexture;
             mapgenSettings.trees = _placeTrees;
+            mapgenSettings.seed = platform_get_ticks();
 
             mapgenSettings.simplex_low = _simplex_low;
             mapgenSettings.simplex_high = _simplex_high;
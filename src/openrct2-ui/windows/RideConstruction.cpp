@@ -2391,7 +2391,7 @@ static void sub_6CBCE2(
     gMapSizeUnits = 255 * 32;
     gMapSizeMinus2 = (255 * 32) + 286;
     gMapSize = 256;
-    gMapSizeMaxXY = (256 * 32) - 1;
+    gMapSizeMaxXY = MAXIMUM_MAP_SIZE_BIG - 1;
 
     trackBlock = get_track_def_from_ride(ride, trackType);
     while (trackBlock->index != 255)
@@ -3529,7 +3529,7 @@ void ride_construction_toolupdate_construct(int32_t screenX, int32_t screenY)
             LocationXY16* selectedTile = gMapSelectionTiles;
             while (selectedTile->x != -1)
             {
-                if (selectedTile->x < (256 * 32) && selectedTile->y < (256 * 32))
+                if (selectedTile->x < MAXIMUM_MAP_SIZE_BIG && selectedTile->y < MAXIMUM_MAP_SIZE_BIG)
                 {
                     z = map_get_highest_z(selectedTile->x >> 5, selectedTile->y >> 5);
                     if (z > highestZ)
@@ -3754,7 +3754,7 @@ void ride_construction_tooldown_construct(int32_t screenX, int32_t screenY)
         LocationXY16* selectedTile = gMapSelectionTiles;
         while (selectedTile->x != -1)
         {
-            if (selectedTile->x >= (256 * 32) || selectedTile->y >= (256 * 32))
+            if (selectedTile->x >= MAXIMUM_MAP_SIZE_BIG || selectedTile->y >= MAXIMUM_MAP_SIZE_BIG)
                 continue;
 
             z = map_get_highest_z(selectedTile->x >> 5, selectedTile->y >> 5);
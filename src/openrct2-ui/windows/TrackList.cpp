@@ -17,8 +17,10 @@
 #include <openrct2/core/String.hpp>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/localisation/Localisation.h>
+#include <openrct2/platform/platform.h>
 #include <openrct2/rct1/RCT1.h>
 #include <openrct2/ride/TrackDesign.h>
+#include <openrct2/ride/TrackDesignPreviewCache.h>
 #include <openrct2/ride/TrackDesignRepository.h>
 #include <openrct2/sprites.h>
 #include <openrct2/windows/Intent.h>
@@ -99,6 +101,9 @@ static rct_window_event_list window_track_list_events = {
 
 #define TRACK_DESIGN_INDEX_UNLOADED UINT16_MAX
 
+// Time spent rendering missing previews into the cache per window update, at least one design is rendered each update
+constexpr uint32_t TRACK_PREVIEW_CACHE_BATCH_MILLISECONDS = 10;
+
 ride_list_item _window_track_list_item;
 
 static std::vector<track_design_file_ref> _trackDesigns;
@@ -107,9 +112,12 @@ static std::vector<uint16_t> _filteredTrackIds;
 static uint16_t _loadedTrackDesignIndex;
 static rct_track_td6* _loadedTrackDesign;
 static std::vector<uint8_t> _trackDesignPreviewPixels;
+static std::vector<uint8_t> _trackDesignCachePixels;
+static size_t _trackDesignCacheNextIndex;
 
 static void track_list_load_designs(ride_list_item item);
 static bool track_list_load_design_for_preview(utf8* path);
+static void track_list_cache_previews();
 
 /**
  *
@@ -212,6 +220,8 @@ static void window_track_list_close(rct_window* w)
     _loadedTrackDesign = nullptr;
     _trackDesignPreviewPixels.clear();
     _trackDesignPreviewPixels.shrink_to_fit();
+    _trackDesignCachePixels.clear();
+    _trackDesignCachePixels.shrink_to_fit();
 
     // Dispose track list
     for (auto& trackDesign : _trackDesigns)
@@ -323,6 +333,7 @@ static void window_track_list_mouseup(rct_window* w, rct_widgetindex widgetIndex
         case WIDX_TOGGLE_SCENERY:
             gTrackDesignSceneryToggle = !gTrackDesignSceneryToggle;
             _loadedTrackDesignIndex = TRACK_DESIGN_INDEX_UNLOADED;
+            _trackDesignCacheNextIndex = 0;
             window_invalidate(w);
             break;
         case WIDX_BACK:
@@ -435,6 +446,8 @@ static void window_track_list_update(rct_window* w)
         window_invalidate(w);
         w->track_list.reload_track_designs = false;
     }
+
+    track_list_cache_previews();
 }
 
 /**
@@ -799,6 +812,7 @@ static void track_list_load_designs(ride_list_item item)
     }
 
     window_track_list_filter_list();
+    _trackDesignCacheNextIndex = 0;
 }
 
 static bool track_list_load_design_for_preview(utf8* path)
@@ -812,9 +826,61 @@ static bool track_list_load_design_for_preview(utf8* path)
     {
         if (drawing_engine_get_type() != DRAWING_ENGINE_OPENGL)
         {
-            track_design_draw_preview(_loadedTrackDesign, _trackDesignPreviewPixels.data());
+            uint64_t key = track_design_preview_cache_get_key(path);
+            if (!track_design_preview_cache_load(
+                    key, _trackDesignPreviewPixels.data(), &_loadedTrackDesign->cost, &_loadedTrackDesign->track_flags))
+            {
+                track_design_draw_preview(_loadedTrackDesign, _trackDesignPreviewPixels.data());
+                track_design_preview_cache_save(
+                    key, _trackDesignPreviewPixels.data(), _loadedTrackDesign->cost, _loadedTrackDesign->track_flags);
+            }
         }
         return true;
     }
     return false;
 }
+
+/**
+ * Renders the previews of the listed designs that are not in the preview cache yet, a few at a time so the window stays
+ * responsive. The previews are drawn on the preview map, which is only safe on the main thread, so this is spread over the
+ * window updates rather than handed to worker threads. Only done in the track designs manager, in a park the time is
+ * better spent on the game and the selected design is still rendered and cached when it is shown.
+ */
+static void track_list_cache_previews()
+{
+    if (!(gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) || _trackDesignCacheNextIndex >= _trackDesigns.size()
+        || drawing_engine_get_type() == DRAWING_ENGINE_OPENGL)
+    {
+        return;
+    }
+
+    _trackDesignCachePixels.resize(4 * TRACK_PREVIEW_IMAGE_SIZE);
+
+    uint32_t startTicks = platform_get_ticks();
+    bool rendered = false;
+    while (_trackDesignCacheNextIndex < _trackDesigns.size())
+    {
+        if (rendered && platform_get_ticks() - startTicks >= TRACK_PREVIEW_CACHE_BATCH_MILLISECONDS)
+        {
+            break;
+        }
+
+        const utf8* path = _trackDesigns[_trackDesignCacheNextIndex].path;
+        _trackDesignCacheNextIndex++;
+
+        uint64_t key = track_design_preview_cache_get_key(path);
+        if (key == 0 || track_design_preview_cache_exists(key))
+        {
+            continue;
+        }
+
+        rct_track_td6* td6 = track_design_open(path);
+        if (td6 != nullptr)
+        {
+            track_design_draw_preview(td6, _trackDesignCachePixels.data());
+            track_design_preview_cache_save(key, _trackDesignCachePixels.data(), td6->cost, td6->track_flags);
+            track_design_dispose(td6);
+        }
+        rendered = true;
+    }
+}
@@ -69,6 +69,7 @@ static void cheat_set_grass_length(int32_t length)
                 && surfaceElement->GetWaterHeight() == 0 && surfaceElement->CanGrassGrow())
             {
                 surfaceElement->SetGrassLength(length);
+                map_mark_tile_for_update(x * 32, y * 32);
             }
         }
     }
@@ -370,8 +371,7 @@ static void cheat_remove_all_guests()
 
         for (size_t stationIndex = 0; stationIndex < MAX_STATIONS; stationIndex++)
         {
-            ride->stations[stationIndex].QueueLength = 0;
-            ride->stations[stationIndex].LastPeepInQueue = SPRITE_INDEX_NULL;
+            ride_queue_clear(ride, (int32_t)stationIndex);
         }
 
         for (auto trainIndex : ride->vehicles)
@@ -467,6 +467,7 @@ static void cheat_own_all_land()
             if (destOwnership != OWNERSHIP_UNOWNED)
             {
                 surfaceElement->AsSurface()->SetOwnership(destOwnership);
+                map_mark_tile_for_update(coords.x, coords.y);
                 update_park_fences_around_tile(coords);
                 uint16_t baseHeight = surfaceElement->base_height * 8;
                 map_invalidate_tile(coords.x, coords.y, baseHeight, baseHeight + 16);
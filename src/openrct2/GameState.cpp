@@ -30,6 +30,8 @@
 #include "world/MapAnimation.h"
 #include "world/Park.h"
 #include "world/Scenery.h"
+#include "world/TileElementAllocator.h"
+#include "world/TileElementSummary.h"
 
 #include <algorithm>
 
@@ -253,6 +255,8 @@ void GameState::UpdateLogic()
     scenario_update();
     climate_update();
     map_update_tiles();
+    tile_element_allocator_update();
+    tile_element_summary_update();
     // Temporarily remove provisional paths to prevent peep from interacting with them
     map_remove_provisional_elements();
     map_update_path_wide_flags();
@@ -269,7 +273,6 @@ void GameState::UpdateLogic()
 
     research_update();
     ride_ratings_update_all();
-    ride_measurements_update();
     news_item_update_current();
 
     map_animation_invalidate_all();
@@ -16,6 +16,7 @@
 #include "../management/Finance.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
+#include "../world/FootpathConnectivity.h"
 #include "../world/MapAnimation.h"
 #include "../world/Park.h"
 #include "../world/Sprite.h"
@@ -173,6 +174,7 @@ public:
             entranceElement->SetSequenceIndex(index);
             entranceElement->SetEntranceType(ENTRANCE_TYPE_PARK_ENTRANCE);
             entranceElement->SetPathType(gFootpathSelectedId);
+            footpath_connectivity_update_tile(entranceLoc.x / 32, entranceLoc.y / 32);
 
             if (!(flags & GAME_COMMAND_FLAG_GHOST))
             {
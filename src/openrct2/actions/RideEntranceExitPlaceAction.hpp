@@ -14,6 +14,7 @@
 #include "../ride/Ride.h"
 #include "../ride/Station.h"
 #include "../world/Entrance.h"
+#include "../world/FootpathConnectivity.h"
 #include "../world/MapAnimation.h"
 #include "../world/Sprite.h"
 #include "GameAction.h"
@@ -211,6 +212,7 @@ public:
         {
             tileElement->SetGhost(true);
         }
+        footpath_connectivity_update_tile(_loc.x / 32, _loc.y / 32);
 
         if (_isExit)
         {
@@ -221,8 +223,7 @@ public:
         {
             ride_set_entrance_location(
                 ride, _stationNum, { _loc.x / 32, _loc.y / 32, z / 8, (uint8_t)tileElement->GetDirection() });
-            ride->stations[_stationNum].LastPeepInQueue = SPRITE_INDEX_NULL;
-            ride->stations[_stationNum].QueueLength = 0;
+            ride_queue_clear(ride, _stationNum);
 
             map_animation_create(MAP_ANIMATION_TYPE_RIDE_ENTRANCE, _loc.x, _loc.y, z / 8);
         }
@@ -0,0 +1,48 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef USE_BENCHMARK
+
+#    include "../peep/GuestGroups.h"
+#    include "../peep/Peep.h"
+#    include "BenchmarkRunner.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <string>
+#    include <utility>
+#    include <vector>
+
+static void BM_guest_groups(benchmark::State& state, GuestGroupArgumentsFunc getArguments)
+{
+    size_t numGroups = 0;
+    for (auto _ : state)
+    {
+        auto groups = guest_groups_find(getArguments, 240, 56);
+        numGroups = groups.size();
+        benchmark::DoNotOptimize(groups);
+    }
+    state.SetItemsProcessed(state.iterations() * gNumGuestsInPark);
+    state.counters["groups"] = (double)numGroups;
+}
+
+void bench_guest_groups_register(const std::string& parkPath)
+{
+    const std::pair<const char*, GuestGroupArgumentsFunc> views[] = {
+        { "actions", get_arguments_from_action },
+        { "thoughts", get_arguments_from_thought },
+    };
+    for (const auto& view : views)
+    {
+        auto name = parkPath + "/" + view.first;
+        benchmark::RegisterBenchmark(name.c_str(), BM_guest_groups, view.second)->Unit(benchmark::kMicrosecond);
+    }
+}
+
+#endif // USE_BENCHMARK
@@ -0,0 +1,63 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef USE_BENCHMARK
+
+#    include "../world/Map.h"
+#    include "../world/MapGen.h"
+#    include "../world/Surface.h"
+#    include "BenchmarkRunner.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <vector>
+
+static void BM_mapgen_generate(benchmark::State& state)
+{
+    mapgen_settings settings = {};
+    settings.mapSize = (int32_t)state.range(0);
+    settings.height = 12;
+    settings.water_level = 16;
+    settings.floor = TERRAIN_GRASS;
+    settings.wall = TERRAIN_EDGE_ROCK;
+    settings.trees = 1;
+    settings.seed = 1;
+    settings.simplex_low = 6;
+    settings.simplex_high = 10;
+    settings.simplex_base_freq = 1.75f;
+    settings.simplex_octaves = 6;
+
+    for (auto _ : state)
+    {
+        mapgen_generate(&settings);
+    }
+    state.SetItemsProcessed(state.iterations() * settings.mapSize * settings.mapSize);
+
+    // The same seed has to give the same map, which shows up as the same checksum on every run
+    uint32_t checksum = 0;
+    for (int32_t y = 0; y < settings.mapSize; y++)
+    {
+        for (int32_t x = 0; x < settings.mapSize; x++)
+        {
+            checksum = checksum * 31 + map_get_surface_element_at(x, y)->base_height;
+        }
+    }
+    state.counters["checksum"] = (double)checksum;
+}
+
+void bench_mapgen_register(const std::string& parkPath)
+{
+    benchmark::RegisterBenchmark("mapgen_generate", BM_mapgen_generate)
+        ->Arg(64)
+        ->Arg(128)
+        ->Arg(MAXIMUM_MAP_SIZE_TECHNICAL)
+        ->Unit(benchmark::kMillisecond);
+}
+
+#endif // USE_BENCHMARK
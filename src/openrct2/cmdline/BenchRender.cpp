@@ -0,0 +1,207 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef USE_BENCHMARK
+
+#    include "../Game.h"
+#    include "../Intro.h"
+#    include "../OpenRCT2.h"
+#    include "../drawing/Drawing.h"
+#    include "../interface/Viewport.h"
+#    include "../paint/Paint.h"
+#    include "../world/Map.h"
+#    include "../world/Sprite.h"
+#    include "BenchmarkRunner.h"
+
+#    include <benchmark/benchmark.h>
+#    include <chrono>
+#    include <cstdint>
+#    include <string>
+#    include <vector>
+
+constexpr int32_t BENCH_RENDER_VIEWPORT_WIDTH = 1920;
+constexpr int32_t BENCH_RENDER_VIEWPORT_HEIGHT = 1080;
+
+struct BenchRenderView
+{
+    int32_t Rotation;
+    int32_t Zoom;
+};
+
+struct BenchRenderPhaseTimes
+{
+    double Generate = 0;
+    double Arrange = 0;
+    double Draw = 0;
+    double Blit = 0;
+    uint64_t PaintStructs = 0;
+    uint64_t Columns = 0;
+};
+
+using BenchRenderClock = std::chrono::high_resolution_clock;
+
+static double bench_render_elapsed(BenchRenderClock::time_point& last)
+{
+    auto now = BenchRenderClock::now();
+    std::chrono::duration<double> elapsed = now - last;
+    last = now;
+    return elapsed.count();
+}
+
+/**
+ * Creates the drawing area for a viewport centred on the map, in the same form viewport_paint passes to the paint sessions.
+ */
+static rct_drawpixelinfo bench_render_create_dpi(const BenchRenderView& view, std::vector<uint8_t>& bits)
+{
+    int32_t centreX = (gMapSize / 2) * 32 + 16;
+    int32_t centreY = (gMapSize / 2) * 32 + 16;
+    int32_t z = tile_element_height(centreX, centreY) & 0xFFFF;
+
+    int32_t x = 0, y = 0;
+    switch (view.Rotation)
+    {
+        case 0:
+            x = centreY - centreX;
+            y = ((centreX + centreY) / 2) - z;
+            break;
+        case 1:
+            x = -centreY - centreX;
+            y = ((-centreX + centreY) / 2) - z;
+            break;
+        case 2:
+            x = -centreY + centreX;
+            y = ((-centreX - centreY) / 2) - z;
+            break;
+        case 3:
+            x = centreY + centreX;
+            y = ((centreX - centreY) / 2) - z;
+            break;
+    }
+
+    bits.assign(BENCH_RENDER_VIEWPORT_WIDTH * BENCH_RENDER_VIEWPORT_HEIGHT, 0);
+
+    rct_drawpixelinfo dpi;
+    dpi.bits = bits.data();
+    dpi.width = BENCH_RENDER_VIEWPORT_WIDTH << view.Zoom;
+    dpi.height = BENCH_RENDER_VIEWPORT_HEIGHT << view.Zoom;
+    dpi.x = floor2(x - dpi.width / 2, 1 << view.Zoom);
+    dpi.y = floor2(y - dpi.height / 2, 1 << view.Zoom);
+    dpi.pitch = 0;
+    dpi.zoom_level = view.Zoom;
+    return dpi;
+}
+
+/**
+ * Splits the drawing area into the same 32 pixel columns as viewport_paint.
+ */
+static std::vector<rct_drawpixelinfo> bench_render_split_columns(const rct_drawpixelinfo& dpi)
+{
+    std::vector<rct_drawpixelinfo> columns;
+    int32_t rightBorder = dpi.x + dpi.width;
+    for (int32_t columnx = floor2(dpi.x, 32); columnx < rightBorder; columnx += 32)
+    {
+        rct_drawpixelinfo column = dpi;
+        if (columnx >= column.x)
+        {
+            int32_t leftPitch = columnx - column.x;
+            column.width -= leftPitch;
+            column.bits += leftPitch >> column.zoom_level;
+            column.pitch += leftPitch >> column.zoom_level;
+            column.x = columnx;
+        }
+
+        int32_t paintRight = column.x + column.width;
+        if (paintRight >= columnx + 32)
+        {
+            int32_t rightPitch = paintRight - columnx - 32;
+            paintRight -= rightPitch;
+            column.pitch += rightPitch >> column.zoom_level;
+        }
+        column.width = paintRight - column.x;
+        columns.push_back(column);
+    }
+    return columns;
+}
+
+/**
+ * Renders the view once, timing each phase of the paint pipeline separately. The blit phase is the palette conversion of
+ * the finished frame, which is what the software drawing engine does before presenting it.
+ */
+static void bench_render_view(
+    const std::vector<rct_drawpixelinfo>& columns, const std::vector<uint8_t>& bits, std::vector<uint32_t>& frame,
+    BenchRenderPhaseTimes& times)
+{
+    auto last = BenchRenderClock::now();
+    for (auto column : columns)
+    {
+        paint_session* session = paint_session_alloc(&column, 0);
+        paint_session_generate(session);
+        times.Generate += bench_render_elapsed(last);
+        times.PaintStructs += session->NextFreePaintStruct - session->PaintStructs;
+
+        paint_session_arrange(session);
+        times.Arrange += bench_render_elapsed(last);
+
+        paint_draw_structs(session);
+        paint_session_free(session);
+        times.Draw += bench_render_elapsed(last);
+    }
+    times.Columns += columns.size();
+
+    for (size_t i = 0; i < bits.size(); i++)
+    {
+        const auto& entry = gPalette[bits[i]];
+        frame[i] = (entry.red << 16) | (entry.green << 8) | entry.blue;
+    }
+    times.Blit += bench_render_elapsed(last);
+}
+
+static void BM_render_view(benchmark::State& state, BenchRenderView view)
+{
+    gCurrentRotation = view.Rotation;
+    reset_all_sprite_quadrant_placements();
+
+    std::vector<uint8_t> bits;
+    auto dpi = bench_render_create_dpi(view, bits);
+    auto columns = bench_render_split_columns(dpi);
+    std::vector<uint32_t> frame(bits.size());
+
+    BenchRenderPhaseTimes times;
+    for (auto _ : state)
+    {
+        bench_render_view(columns, bits, frame, times);
+        benchmark::DoNotOptimize(frame.data());
+    }
+
+    auto average = benchmark::Counter::kAvgIterations;
+    state.counters["generate_seconds"] = benchmark::Counter(times.Generate, average);
+    state.counters["arrange_seconds"] = benchmark::Counter(times.Arrange, average);
+    state.counters["draw_seconds"] = benchmark::Counter(times.Draw, average);
+    state.counters["blit_seconds"] = benchmark::Counter(times.Blit, average);
+    state.counters["paint_structs"] = benchmark::Counter((double)times.PaintStructs, average);
+    state.counters["columns"] = benchmark::Counter((double)times.Columns, average);
+}
+
+void bench_render_register(const std::string& parkPath)
+{
+    gIntroState = INTRO_STATE_NONE;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+    for (int32_t rotation = 0; rotation < 4; rotation++)
+    {
+        for (int32_t zoom = 0; zoom < 4; zoom++)
+        {
+            auto name = parkPath + "/rotation:" + std::to_string(rotation) + "/zoom:" + std::to_string(zoom);
+            benchmark::RegisterBenchmark(name.c_str(), BM_render_view, BenchRenderView{ rotation, zoom })
+                ->Unit(benchmark::kMillisecond);
+        }
+    }
+}
+
+#endif // USE_BENCHMARK
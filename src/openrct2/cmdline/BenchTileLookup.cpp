@@ -0,0 +1,158 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef USE_BENCHMARK
+
+#    include "../world/Map.h"
+#    include "BenchmarkRunner.h"
+
+#    include <algorithm>
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <string>
+#    include <vector>
+
+// Number of tiles with the most elements that the lookups are run against.
+constexpr size_t BENCH_TILE_LOOKUP_DENSE_TILES = 4096;
+
+/**
+ * One lookup, taken from an existing element so every lookup type sees a mix of hits and misses.
+ */
+struct BenchTileLookupQuery
+{
+    int32_t X;
+    int32_t Y;
+    int32_t Z;
+    int32_t Direction;
+    int32_t TrackType;
+    int32_t Sequence;
+    int32_t EntryIndex;
+    uint8_t Quadrant;
+};
+
+using BenchTileLookupFunc = const void* (*)(const BenchTileLookupQuery& query);
+
+static std::vector<BenchTileLookupQuery> bench_tile_lookup_create_queries()
+{
+    std::vector<std::pair<int32_t, CoordsXY>> tiles;
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            const TileElement* tileElement = map_get_first_element_at(x, y);
+            int32_t count = 0;
+            do
+            {
+                count++;
+            } while (!(tileElement++)->IsLastForTile());
+            tiles.push_back({ count, { x, y } });
+        }
+    }
+
+    size_t numTiles = std::min(tiles.size(), BENCH_TILE_LOOKUP_DENSE_TILES);
+    std::partial_sort(tiles.begin(), tiles.begin() + numTiles, tiles.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    std::vector<BenchTileLookupQuery> queries;
+    for (size_t i = 0; i < numTiles; i++)
+    {
+        CoordsXY tile = tiles[i].second;
+        const TileElement* tileElement = map_get_first_element_at(tile.x, tile.y);
+        do
+        {
+            BenchTileLookupQuery query{};
+            query.X = tile.x;
+            query.Y = tile.y;
+            query.Z = tileElement->base_height;
+            query.Direction = tileElement->GetDirection();
+            switch (tileElement->GetType())
+            {
+                case TILE_ELEMENT_TYPE_TRACK:
+                    query.TrackType = tileElement->AsTrack()->GetTrackType();
+                    query.Sequence = tileElement->AsTrack()->GetSequenceIndex();
+                    break;
+                case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                    query.EntryIndex = tileElement->AsSmallScenery()->GetEntryIndex();
+                    query.Quadrant = tileElement->AsSmallScenery()->GetSceneryQuadrant();
+                    break;
+            }
+            queries.push_back(query);
+        } while (!(tileElement++)->IsLastForTile());
+    }
+    return queries;
+}
+
+static const void* bench_tile_lookup_path(const BenchTileLookupQuery& query)
+{
+    return map_get_path_element_at(query.X, query.Y, query.Z);
+}
+
+static const void* bench_tile_lookup_track(const BenchTileLookupQuery& query)
+{
+    return map_get_track_element_at(query.X * 32, query.Y * 32, query.Z);
+}
+
+static const void* bench_tile_lookup_track_of_type_seq(const BenchTileLookupQuery& query)
+{
+    return map_get_track_element_at_of_type_seq(query.X * 32, query.Y * 32, query.Z, query.TrackType, query.Sequence);
+}
+
+static const void* bench_tile_lookup_wall(const BenchTileLookupQuery& query)
+{
+    return map_get_wall_element_at(query.X * 32, query.Y * 32, query.Z, query.Direction);
+}
+
+static const void* bench_tile_lookup_small_scenery(const BenchTileLookupQuery& query)
+{
+    return map_get_small_scenery_element_at(query.X * 32, query.Y * 32, query.Z, query.EntryIndex, query.Quadrant);
+}
+
+static const void* bench_tile_lookup_banner(const BenchTileLookupQuery& query)
+{
+    return map_get_banner_element_at(query.X, query.Y, query.Z, query.Direction);
+}
+
+static void BM_tile_lookup(
+    benchmark::State& state, BenchTileLookupFunc func, const std::vector<BenchTileLookupQuery>& queries)
+{
+    int64_t hits = 0;
+    for (auto _ : state)
+    {
+        for (const auto& query : queries)
+        {
+            const void* result = func(query);
+            benchmark::DoNotOptimize(result);
+            hits += (result != nullptr);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * queries.size());
+    state.counters["hits"] = benchmark::Counter((double)hits, benchmark::Counter::kAvgIterations);
+}
+
+void bench_tile_lookup_register(const std::string& parkPath)
+{
+    auto queries = bench_tile_lookup_create_queries();
+    const std::pair<const char*, BenchTileLookupFunc> lookups[] = {
+        { "path", bench_tile_lookup_path },
+        { "track", bench_tile_lookup_track },
+        { "track_of_type_seq", bench_tile_lookup_track_of_type_seq },
+        { "wall", bench_tile_lookup_wall },
+        { "small_scenery", bench_tile_lookup_small_scenery },
+        { "banner", bench_tile_lookup_banner },
+    };
+    for (const auto& lookup : lookups)
+    {
+        auto name = parkPath + "/" + lookup.first;
+        benchmark::RegisterBenchmark(name.c_str(), BM_tile_lookup, lookup.second, queries)
+            ->Unit(benchmark::kMicrosecond);
+    }
+}
+
+#endif // USE_BENCHMARK
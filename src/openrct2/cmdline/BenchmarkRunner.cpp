@@ -0,0 +1,186 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../drawing/Drawing.h"
+#    include "../platform/platform.h"
+#    include "BenchmarkRunner.h"
+
+#    include <benchmark/benchmark.h>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+struct BenchmarkCommand
+{
+    bool RequiresPark;
+    bool RequiresDrawing;
+    BenchmarkRegisterFunc Register;
+};
+
+static int cmdline_run_benchmarks(int argc, const char** argv, const BenchmarkCommand& command)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // The first existing file is the park, anything else is considered a benchmark option.
+    std::string parkPath;
+    for (int i = 0; i < argc; i++)
+    {
+        if (command.RequiresPark && parkPath.empty() && platform_file_exists(argv[i]))
+        {
+            parkPath = argv[i];
+        }
+        else
+        {
+            argv_for_benchmark.push_back((char*)argv[i]);
+        }
+    }
+    if (command.RequiresPark && parkPath.empty())
+    {
+        log_error("No park file given.");
+        return -1;
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        return -1;
+    }
+
+    if (command.RequiresDrawing)
+    {
+        drawing_engine_init();
+    }
+
+    int result = 0;
+    if (command.RequiresPark && !context->LoadParkFromFile(parkPath))
+    {
+        log_error("Failed to load park!");
+        result = -1;
+    }
+    else
+    {
+        command.Register(parkPath);
+
+        // Update argc with all the changes made
+        argc = (int)argv_for_benchmark.size();
+        ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+        if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        {
+            result = -1;
+        }
+        else
+        {
+            ::benchmark::RunSpecifiedBenchmarks();
+        }
+    }
+
+    if (command.RequiresDrawing)
+    {
+        drawing_engine_dispose();
+    }
+    return result;
+}
+
+static exitcode_t cmdline_handle_benchmark_command(CommandLineArgEnumerator* argEnumerator, const BenchmarkCommand& command)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_run_benchmarks(argc, argv, command);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+static exitcode_t HandleBenchRender(CommandLineArgEnumerator* argEnumerator)
+{
+    return cmdline_handle_benchmark_command(argEnumerator, { true, true, bench_render_register });
+}
+
+static exitcode_t HandleBenchTileLookup(CommandLineArgEnumerator* argEnumerator)
+{
+    return cmdline_handle_benchmark_command(argEnumerator, { true, false, bench_tile_lookup_register });
+}
+
+static exitcode_t HandleBenchGuestGroups(CommandLineArgEnumerator* argEnumerator)
+{
+    return cmdline_handle_benchmark_command(argEnumerator, { true, false, bench_guest_groups_register });
+}
+
+static exitcode_t HandleBenchMapGen(CommandLineArgEnumerator* argEnumerator)
+{
+    return cmdline_handle_benchmark_command(argEnumerator, { false, false, bench_mapgen_register });
+}
+
+#    define BENCHMARK_OPTIONS                                                                                                  \
+        "[--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] [--benchmark_repetitions=<num_repetitions>] "          \
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>]"
+
+const CommandLineCommand CommandLine::BenchRenderCommands[]{
+    DefineCommand("", "<file> " BENCHMARK_OPTIONS, nullptr, HandleBenchRender),
+    CommandTableEnd,
+};
+
+const CommandLineCommand CommandLine::BenchTileLookupCommands[]{
+    DefineCommand("", "<file> " BENCHMARK_OPTIONS, nullptr, HandleBenchTileLookup),
+    CommandTableEnd,
+};
+
+const CommandLineCommand CommandLine::BenchGuestGroupsCommands[]{
+    DefineCommand("", "<file> " BENCHMARK_OPTIONS, nullptr, HandleBenchGuestGroups),
+    CommandTableEnd,
+};
+
+const CommandLineCommand CommandLine::BenchMapGenCommands[]{
+    DefineCommand("", BENCHMARK_OPTIONS, nullptr, HandleBenchMapGen),
+    CommandTableEnd,
+};
+
+#else
+static exitcode_t HandleBenchmarkNotEnabled(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+
+const CommandLineCommand CommandLine::BenchRenderCommands[]{
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchmarkNotEnabled),
+    CommandTableEnd,
+};
+
+const CommandLineCommand CommandLine::BenchTileLookupCommands[]{
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchmarkNotEnabled),
+    CommandTableEnd,
+};
+
+const CommandLineCommand CommandLine::BenchGuestGroupsCommands[]{
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchmarkNotEnabled),
+    CommandTableEnd,
+};
+
+const CommandLineCommand CommandLine::BenchMapGenCommands[]{
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchmarkNotEnabled),
+    CommandTableEnd,
+};
+#endif // USE_BENCHMARK
@@ -0,0 +1,29 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef USE_BENCHMARK
+
+#    include "../common.h"
+
+#    include <string>
+
+/**
+ * Registers the Google benchmarks of a command. BenchmarkRunner.cpp sets up the context and loads the park given on the
+ * command line before calling it, and runs the benchmarks afterwards. parkPath is empty for commands without a park.
+ */
+using BenchmarkRegisterFunc = void (*)(const std::string& parkPath);
+
+void bench_render_register(const std::string& parkPath);
+void bench_tile_lookup_register(const std::string& parkPath);
+void bench_guest_groups_register(const std::string& parkPath);
+void bench_mapgen_register(const std::string& parkPath);
+
+#endif // USE_BENCHMARK
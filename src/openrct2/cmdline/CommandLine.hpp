@@ -118,6 +118,10 @@ namespace CommandLine
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
+    extern const CommandLineCommand BenchRenderCommands[];
+    extern const CommandLineCommand BenchTileLookupCommands[];
+    extern const CommandLineCommand BenchGuestGroupsCommands[];
+    extern const CommandLineCommand BenchMapGenCommands[];
     extern const CommandLineCommand SimulateCommands[];
 
     extern const CommandLineExample RootExamples[];
@@ -140,6 +140,10 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
+    DefineSubCommand("benchrender",     CommandLine::BenchRenderCommands      ),
+    DefineSubCommand("benchtilelookup", CommandLine::BenchTileLookupCommands  ),
+    DefineSubCommand("benchguestgroups", CommandLine::BenchGuestGroupsCommands),
+    DefineSubCommand("benchmapgen",     CommandLine::BenchMapGenCommands      ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
     CommandTableEnd
 };
@@ -24,6 +24,7 @@ static constexpr const CommandLineOptionDefinition ScreenshotOptionsDef[]
     { CMDLINE_TYPE_SWITCH,  &options.fix_vandalism, NAC, "fix-vandalism", "fix vandalism for the screenshot" },
     { CMDLINE_TYPE_SWITCH,  &options.remove_litter, NAC, "remove-litter", "remove litter for the screenshot" },
     { CMDLINE_TYPE_SWITCH,  &options.tidy_up_park,  NAC, "tidy-up-park",  "clear grass, water plants, fix vandalism and remove litter" },
+    { CMDLINE_TYPE_INTEGER, &options.tile_height,   NAC, "tile-height",   "number of rows to render at a time, limits peak memory use (default 1024)" },
     OptionTableEnd
 };
 
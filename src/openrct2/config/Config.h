@@ -45,6 +45,7 @@ struct GeneralConfiguration
     bool render_weather_gloom;
     bool disable_lightning_effect;
     bool show_guest_purchases;
+    int32_t zoomed_sprite_cache_size;
 
     // Localisation
     int32_t language;
@@ -161,7 +161,7 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void WritePng(std::ostream& ostream, const Image& image, uint32_t bandHeight, const ImageBandReaderFunc& readBand)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -223,12 +223,20 @@ namespace Imaging
                 PNG_FILTER_TYPE_DEFAULT);
             png_write_info(png_ptr, info_ptr);
 
-            // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+            // Write pixels, one band at a time
+            for (uint32_t top = 0; top < image.Height; top += bandHeight)
             {
-                png_write_row(png_ptr, (png_byte*)pixels);
-                pixels += image.Stride;
+                auto height = std::min(bandHeight, image.Height - top);
+                auto pixels = readBand(top, height);
+                if (pixels == nullptr)
+                {
+                    throw std::runtime_error("Unable to read image band.");
+                }
+                for (uint32_t y = 0; y < height; y++)
+                {
+                    png_write_row(png_ptr, (png_byte*)pixels);
+                    pixels += image.Stride;
+                }
             }
 
             png_write_end(png_ptr, nullptr);
@@ -243,6 +251,14 @@ namespace Imaging
         }
     }
 
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        auto readBand = [&image](uint32_t top, uint32_t) -> const uint8_t* {
+            return image.Pixels.data() + (size_t)top * image.Stride;
+        };
+        WritePng(ostream, image, std::max<uint32_t>(image.Height, 1), readBand);
+    }
+
     IMAGE_FORMAT GetImageFormatFromPath(const std::string_view& path)
     {
         if (String::EndsWith(path, ".png", true))
@@ -343,4 +359,34 @@ namespace Imaging
                 throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
         }
     }
+
+    void WriteToFile(
+        const std::string_view& path, const Image& image, uint32_t bandHeight, const ImageBandReaderFunc& readBand,
+        IMAGE_FORMAT format)
+    {
+        if (bandHeight == 0)
+        {
+            throw std::invalid_argument("bandHeight can not be zero.");
+        }
+
+        switch (format)
+        {
+            case IMAGE_FORMAT::AUTOMATIC:
+                WriteToFile(path, image, bandHeight, readBand, GetImageFormatFromPath(path));
+                break;
+            case IMAGE_FORMAT::PNG:
+            {
+#if defined(_WIN32) && !defined(__MINGW32__)
+                auto pathW = String::ToUtf16(path);
+                std::ofstream fs(pathW, std::ios::binary);
+#else
+                std::ofstream fs(path.data(), std::ios::binary);
+#endif
+                WritePng(fs, image, bandHeight, readBand);
+                break;
+            }
+            default:
+                throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
+        }
+    }
 } // namespace Imaging
@@ -52,6 +52,8 @@ struct Image
 };
 
 using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
+// Returns a pointer to the given band of rows, each row is image.Stride bytes apart
+using ImageBandReaderFunc = std::function<const uint8_t*(uint32_t top, uint32_t height)>;
 
 namespace Imaging
 {
@@ -59,6 +61,9 @@ namespace Imaging
     Image ReadFromFile(const std::string_view& path, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     void WriteToFile(const std::string_view& path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
+    void WriteToFile(
+        const std::string_view& path, const Image& image, uint32_t bandHeight, const ImageBandReaderFunc& readBand,
+        IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
 } // namespace Imaging
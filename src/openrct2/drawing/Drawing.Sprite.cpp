@@ -278,6 +278,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
+    gfx_zoomed_sprite_cache_clear();
     SafeFree(_g1.data);
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
@@ -285,6 +286,7 @@ void gfx_unload_g1()
 
 void gfx_unload_g2()
 {
+    gfx_zoomed_sprite_cache_clear();
     SafeFree(_g2.data);
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
@@ -292,6 +294,7 @@ void gfx_unload_g2()
 
 void gfx_unload_csg()
 {
+    gfx_zoomed_sprite_cache_clear();
     SafeFree(_csg.data);
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
@@ -753,6 +756,26 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
 
     if (g1->flags & G1_FLAG_RLE_COMPRESSION)
     {
+        if (zoom_level != 0)
+        {
+            // Draw the pre-filtered sprite at zoom level 0 instead, it samples exactly the same pixels
+            int32_t phase_x = source_start_x & ~zoom_mask;
+            int32_t phase_y = source_start_y & ~zoom_mask;
+            const rct_g1_element* zoomed = gfx_get_zoomed_sprite(image_element, g1, zoom_level, phase_x, phase_y);
+            if (zoomed != nullptr)
+            {
+                int32_t zoom_amount = 1 << zoom_level;
+                rct_drawpixelinfo zoomed_dpi = *dpi;
+                zoomed_dpi.width = dpi->width >> zoom_level;
+                zoomed_dpi.zoom_level = 0;
+                gfx_rle_sprite_to_buffer(
+                    zoomed->offset, dest_pointer, palette_pointer, &zoomed_dpi, image_type,
+                    (source_start_y - phase_y) / zoom_amount, (height + zoom_amount - 1) >> zoom_level,
+                    (source_start_x - phase_x) / zoom_amount, (width + zoom_amount - 1) >> zoom_level);
+                return;
+            }
+        }
+
         // We have to use a different method to move the source pointer for
         // rle encoded sprites so that will be handled within this function
         gfx_rle_sprite_to_buffer(
@@ -884,6 +907,7 @@ void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1)
     openrct2_assert(g1 != nullptr, "g1 was nullptr");
 #endif
 
+    gfx_zoomed_sprite_cache_invalidate(imageId);
     if (imageId == SPR_TEMP)
     {
         _g1Temp = *g1;
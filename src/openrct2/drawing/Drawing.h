@@ -323,6 +323,13 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
 void FASTCALL
     gfx_draw_sprite_raw_masked_software(rct_drawpixelinfo* dpi, int32_t x, int32_t y, int32_t maskImage, int32_t colourImage);
 
+// zoomed sprite cache
+const rct_g1_element* gfx_get_zoomed_sprite(
+    int32_t imageId, const rct_g1_element* g1, int32_t zoomLevel, int32_t phaseX, int32_t phaseY);
+void gfx_zoomed_sprite_cache_invalidate(int32_t imageId);
+void gfx_zoomed_sprite_cache_clear();
+size_t gfx_zoomed_sprite_cache_get_size();
+
 // string
 void gfx_draw_string(rct_drawpixelinfo* dpi, const_utf8string buffer, uint8_t colour, int32_t x, int32_t y);
 
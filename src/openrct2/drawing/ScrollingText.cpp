@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../interface/Colour.h"
 #include "../localisation/Localisation.h"
@@ -17,6 +18,10 @@
 #include "TTF.h"
 
 #include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #pragma pack(push, 1)
 /* size: 0xA12 */
@@ -34,15 +39,76 @@ assert_struct_size(rct_draw_scroll_text, 0xA12);
 #pragma pack(pop)
 
 #define MAX_SCROLLING_TEXT_ENTRIES 32
+#define MAX_SCROLLING_TEXT_COLUMN_ENTRIES 1024
+
+struct ScrollingTextKey
+{
+    rct_string_id StringId;
+    uint32_t Args0;
+    uint32_t Args1;
+    uint16_t Position;
+    uint16_t Mode;
+
+    bool operator==(const ScrollingTextKey& other) const
+    {
+        return StringId == other.StringId && Args0 == other.Args0 && Args1 == other.Args1 && Position == other.Position
+            && Mode == other.Mode;
+    }
+};
+
+struct ScrollingTextKeyHash
+{
+    size_t operator()(const ScrollingTextKey& key) const
+    {
+        uint64_t args = ((uint64_t)key.Args1 << 32) | key.Args0;
+        uint64_t view = ((uint64_t)key.StringId << 32) | ((uint64_t)key.Position << 16) | key.Mode;
+        return std::hash<uint64_t>()(args ^ (view * 0x9E3779B97F4A7C15ULL));
+    }
+};
+
+// A single column of a rendered string, one pixel per bitmap row
+struct ScrollingTextColumn
+{
+    uint8_t Pixels[8];
+    uint8_t DrawMask;
+    uint8_t BlendMask;
+};
+
+// All the columns of a formatted string. Colour codes carry over when the sprite font text wraps around, so the second
+// pass over the string can differ from the first; every pass after that is identical to the second one.
+struct ScrollingTextColumns
+{
+    std::vector<ScrollingTextColumn> Columns;
+    int32_t RepeatStart = 0;
+    uint32_t LastUseTick = 0;
+};
+
+struct ScrollingTextColumnSettings
+{
+    bool TrueType;
+    bool Hinting;
+    const void* Font;
+
+    bool operator!=(const ScrollingTextColumnSettings& other) const
+    {
+        return TrueType != other.TrueType || Hinting != other.Hinting || Font != other.Font;
+    }
+};
 
 static rct_draw_scroll_text _drawScrollTextList[MAX_SCROLLING_TEXT_ENTRIES];
 static uint8_t _characterBitmaps[FONT_SPRITE_GLYPH_COUNT + SPR_G2_GLYPH_COUNT][8];
 static uint32_t _drawSCrollNextIndex = 0;
 
-static void scrolling_text_set_bitmap_for_sprite(
-    utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets);
-static void scrolling_text_set_bitmap_for_ttf(
-    utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets);
+// Maps the text currently held by each of the scrolling text sprites back to its index in _drawScrollTextList
+static std::unordered_map<ScrollingTextKey, int32_t, ScrollingTextKeyHash> _drawScrollTextIndices;
+
+// Columns of recently drawn strings keyed by the starting colour and the formatted text, so scrolling a string only has
+// to copy a different window of columns into the sprite
+static std::unordered_map<std::string, ScrollingTextColumns> _scrollingTextColumns;
+static ScrollingTextColumnSettings _scrollingTextColumnSettings = {};
+
+static void scrolling_text_build_columns_for_sprite(const utf8* text, ScrollingTextColumns& columns);
+static void scrolling_text_build_columns_for_ttf(const utf8* text, ScrollingTextColumns& columns);
 
 void scrolling_text_initialise_bitmaps()
 {
@@ -118,6 +184,8 @@ void scrolling_text_initialise_bitmaps()
             gfx_set_g1_element(imageId, &g1);
         }
     }
+
+    scrolling_text_invalidate();
 }
 
 static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
@@ -133,29 +201,23 @@ static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
     }
 }
 
-static int32_t scrolling_text_get_matching_or_oldest(rct_string_id stringId, uint16_t scroll, uint16_t scrollingMode)
+static ScrollingTextKey scrolling_text_get_key(const rct_draw_scroll_text* scrollText)
+{
+    return { scrollText->string_id, scrollText->string_args_0, scrollText->string_args_1, scrollText->position,
+             scrollText->mode };
+}
+
+static int32_t scrolling_text_get_oldest()
 {
     uint32_t oldestId = 0xFFFFFFFF;
-    int32_t scrollIndex = -1;
+    int32_t scrollIndex = 0;
     for (int32_t i = 0; i < MAX_SCROLLING_TEXT_ENTRIES; i++)
     {
-        rct_draw_scroll_text* scrollText = &_drawScrollTextList[i];
-        if (oldestId >= scrollText->id)
+        if (oldestId >= _drawScrollTextList[i].id)
         {
-            oldestId = scrollText->id;
+            oldestId = _drawScrollTextList[i].id;
             scrollIndex = i;
         }
-
-        // If exact match return the matching index
-        uint32_t stringArgs0, stringArgs1;
-        std::memcpy(&stringArgs0, gCommonFormatArgs + 0, sizeof(uint32_t));
-        std::memcpy(&stringArgs1, gCommonFormatArgs + 4, sizeof(uint32_t));
-        if (scrollText->string_id == stringId && scrollText->string_args_0 == stringArgs0
-            && scrollText->string_args_1 == stringArgs1 && scrollText->position == scroll && scrollText->mode == scrollingMode)
-        {
-            scrollText->id = _drawSCrollNextIndex;
-            return i + SPR_SCROLLING_TEXT_START;
-        }
     }
     return scrollIndex;
 }
@@ -1460,6 +1522,131 @@ void scrolling_text_invalidate()
         scrollText.string_args_0 = 0;
         scrollText.string_args_1 = 0;
     }
+    _drawScrollTextIndices.clear();
+    _scrollingTextColumns.clear();
+}
+
+static ScrollingTextColumnSettings scrolling_text_get_column_settings()
+{
+    ScrollingTextColumnSettings settings = {};
+    settings.TrueType = LocalisationService_UseTrueTypeFont();
+    settings.Hinting = gConfigFonts.enable_hinting;
+#ifndef NO_TTF
+    if (settings.TrueType)
+    {
+        settings.Font = ttf_get_font_from_sprite_base(FONT_SPRITE_BASE_TINY)->font;
+    }
+#endif
+    return settings;
+}
+
+static void scrolling_text_prune_columns()
+{
+    for (auto it = _scrollingTextColumns.begin(); it != _scrollingTextColumns.end();)
+    {
+        if (it->second.LastUseTick < gCurrentDrawCount - 64)
+        {
+            it = _scrollingTextColumns.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+
+    // Everything is still in use, start again rather than growing without bound
+    if (_scrollingTextColumns.size() >= MAX_SCROLLING_TEXT_COLUMN_ENTRIES)
+    {
+        _scrollingTextColumns.clear();
+    }
+}
+
+static const ScrollingTextColumns& scrolling_text_get_columns(const utf8* text)
+{
+    auto settings = scrolling_text_get_column_settings();
+    if (settings != _scrollingTextColumnSettings)
+    {
+        _scrollingTextColumns.clear();
+        _scrollingTextColumnSettings = settings;
+    }
+
+    std::string key(1, (char)gCommonFormatArgs[7]);
+    key.append(text);
+    auto it = _scrollingTextColumns.find(key);
+    if (it != _scrollingTextColumns.end())
+    {
+        it->second.LastUseTick = gCurrentDrawCount;
+        return it->second;
+    }
+
+    if (_scrollingTextColumns.size() >= MAX_SCROLLING_TEXT_COLUMN_ENTRIES)
+    {
+        scrolling_text_prune_columns();
+    }
+
+    ScrollingTextColumns columns;
+    if (settings.TrueType)
+    {
+        scrolling_text_build_columns_for_ttf(text, columns);
+    }
+    else
+    {
+        scrolling_text_build_columns_for_sprite(text, columns);
+    }
+    columns.LastUseTick = gCurrentDrawCount;
+    return _scrollingTextColumns.emplace(std::move(key), std::move(columns)).first->second;
+}
+
+/**
+ * Copies the window of columns starting at the scroll offset into the bitmap, following the scrolling mode's positions.
+ */
+static void scrolling_text_draw_columns(
+    const ScrollingTextColumns& columns, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets)
+{
+    int32_t count = (int32_t)columns.Columns.size();
+    if (count == 0)
+        return;
+
+    int32_t x = scroll;
+    if (x >= count)
+    {
+        int32_t repeatLength = count - columns.RepeatStart;
+        x = columns.RepeatStart + (scroll - count) % repeatLength;
+    }
+
+    while (true)
+    {
+        int16_t scrollPosition = *scrollPositionOffsets;
+        if (scrollPosition == -1)
+            return;
+
+        if (scrollPosition > -1)
+        {
+            const ScrollingTextColumn& column = columns.Columns[x];
+            uint8_t* dst = &bitmap[scrollPosition];
+            for (int32_t row = 0; row < 8; row++)
+            {
+                if (column.DrawMask & (1 << row))
+                {
+                    if (column.BlendMask & (1 << row))
+                    {
+                        *dst = blendColours(column.Pixels[row], *dst);
+                    }
+                    else
+                    {
+                        *dst = column.Pixels[row];
+                    }
+                }
+
+                // Jump to next row
+                dst += 64;
+            }
+        }
+        scrollPositionOffsets++;
+
+        if (++x >= count)
+            x = columns.RepeatStart;
+    }
 }
 
 /**
@@ -1481,22 +1668,35 @@ int32_t scrolling_text_setup(paint_session* session, rct_string_id stringId, uin
 
     _drawSCrollNextIndex++;
 
-    int32_t scrollIndex = scrolling_text_get_matching_or_oldest(stringId, scroll, scrollingMode);
-    if (scrollIndex >= SPR_SCROLLING_TEXT_START)
-        return scrollIndex;
-
-    // Setup scrolling text
     uint32_t stringArgs0, stringArgs1;
     std::memcpy(&stringArgs0, gCommonFormatArgs + 0, sizeof(uint32_t));
     std::memcpy(&stringArgs1, gCommonFormatArgs + 4, sizeof(uint32_t));
 
+    ScrollingTextKey key = { stringId, stringArgs0, stringArgs1, scroll, scrollingMode };
+    auto match = _drawScrollTextIndices.find(key);
+    if (match != _drawScrollTextIndices.end())
+    {
+        _drawScrollTextList[match->second].id = _drawSCrollNextIndex;
+        return SPR_SCROLLING_TEXT_START + match->second;
+    }
+
+    // Setup scrolling text
+    int32_t scrollIndex = scrolling_text_get_oldest();
     rct_draw_scroll_text* scrollText = &_drawScrollTextList[scrollIndex];
+
+    auto previous = _drawScrollTextIndices.find(scrolling_text_get_key(scrollText));
+    if (previous != _drawScrollTextIndices.end() && previous->second == scrollIndex)
+    {
+        _drawScrollTextIndices.erase(previous);
+    }
+
     scrollText->string_id = stringId;
     scrollText->string_args_0 = stringArgs0;
     scrollText->string_args_1 = stringArgs1;
     scrollText->position = scroll;
     scrollText->mode = scrollingMode;
     scrollText->id = _drawSCrollNextIndex;
+    _drawScrollTextIndices[key] = scrollIndex;
 
     // Create the string to draw
     utf8 scrollString[256];
@@ -1505,37 +1705,20 @@ int32_t scrolling_text_setup(paint_session* session, rct_string_id stringId, uin
     const int16_t* scrollingModePositions = _scrollPositions[scrollingMode];
 
     std::fill_n(scrollText->bitmap, 320 * 8, 0x00);
-    if (LocalisationService_UseTrueTypeFont())
-    {
-        scrolling_text_set_bitmap_for_ttf(scrollString, scroll, scrollText->bitmap, scrollingModePositions);
-    }
-    else
-    {
-        scrolling_text_set_bitmap_for_sprite(scrollString, scroll, scrollText->bitmap, scrollingModePositions);
-    }
+    scrolling_text_draw_columns(scrolling_text_get_columns(scrollString), scroll, scrollText->bitmap, scrollingModePositions);
 
     uint32_t imageId = SPR_SCROLLING_TEXT_START + scrollIndex;
     drawing_engine_invalidate_image(imageId);
     return imageId;
 }
 
-static void scrolling_text_set_bitmap_for_sprite(
-    utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets)
+static void scrolling_text_add_columns_for_sprite(
+    const utf8* text, uint8_t& characterColour, std::vector<ScrollingTextColumn>& columns)
 {
-    uint8_t characterColour = scrolling_text_get_colour(gCommonFormatArgs[7]);
-
-    utf8* ch = text;
-    while (true)
+    const utf8* ch = text;
+    uint32_t codepoint;
+    while ((codepoint = utf8_get_next(ch, &ch)) != 0)
     {
-        uint32_t codepoint = utf8_get_next(ch, (const utf8**)&ch);
-
-        // If at the end of the string loop back to the start
-        if (codepoint == 0)
-        {
-            ch = text;
-            continue;
-        }
-
         // Set any change in colour
         if (codepoint <= FORMAT_COLOUR_CODE_END && codepoint >= FORMAT_COLOUR_CODE_START)
         {
@@ -1556,50 +1739,52 @@ static void scrolling_text_set_bitmap_for_sprite(
         uint8_t* characterBitmap = font_sprite_get_codepoint_bitmap(codepoint);
         for (; characterWidth != 0; characterWidth--, characterBitmap++)
         {
-            // Skip any non-displayed columns
-            if (scroll != 0)
+            ScrollingTextColumn column = {};
+            for (int32_t row = 0; row < 8; row++)
             {
-                scroll--;
-                continue;
-            }
-
-            int16_t scrollPosition = *scrollPositionOffsets;
-            if (scrollPosition == -1)
-                return;
-            if (scrollPosition > -1)
-            {
-                uint8_t* dst = &bitmap[scrollPosition];
-                for (uint8_t char_bitmap = *characterBitmap; char_bitmap != 0; char_bitmap >>= 1)
+                if (*characterBitmap & (1 << row))
                 {
-                    if (char_bitmap & 1)
-                        *dst = characterColour;
-
-                    // Jump to next row
-                    dst += 64;
+                    column.Pixels[row] = characterColour;
+                    column.DrawMask |= 1 << row;
                 }
             }
-            scrollPositionOffsets++;
+            columns.push_back(column);
         }
     }
 }
 
-static void scrolling_text_set_bitmap_for_ttf(utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets)
+static void scrolling_text_build_columns_for_sprite(const utf8* text, ScrollingTextColumns& columns)
+{
+    uint8_t characterColour = scrolling_text_get_colour(gCommonFormatArgs[7]);
+    scrolling_text_add_columns_for_sprite(text, characterColour, columns.Columns);
+
+    std::vector<ScrollingTextColumn> repeat;
+    scrolling_text_add_columns_for_sprite(text, characterColour, repeat);
+    if (std::memcmp(repeat.data(), columns.Columns.data(), repeat.size() * sizeof(ScrollingTextColumn)) != 0)
+    {
+        columns.RepeatStart = (int32_t)columns.Columns.size();
+        columns.Columns.insert(columns.Columns.end(), repeat.begin(), repeat.end());
+    }
+}
+
+static void scrolling_text_build_columns_for_ttf(const utf8* text, ScrollingTextColumns& columns)
 {
 #ifndef NO_TTF
     TTFFontDescriptor* fontDesc = ttf_get_font_from_sprite_base(FONT_SPRITE_BASE_TINY);
     if (fontDesc->font == nullptr)
     {
-        scrolling_text_set_bitmap_for_sprite(text, scroll, bitmap, scrollPositionOffsets);
+        scrolling_text_build_columns_for_sprite(text, columns);
         return;
     }
 
     // Currently only supports one colour
     uint8_t colour = 0;
 
-    utf8* dstCh = text;
-    utf8* ch = text;
+    utf8 drawText[256];
+    utf8* dstCh = drawText;
+    const utf8* ch = text;
     int32_t codepoint;
-    while ((codepoint = utf8_get_next(ch, (const utf8**)&ch)) != 0)
+    while ((codepoint = utf8_get_next(ch, &ch)) != 0)
     {
         if (utf8_is_format_code(codepoint))
         {
@@ -1628,7 +1813,7 @@ static void scrolling_text_set_bitmap_for_ttf(utf8* text, int32_t scroll, uint8_
         }
     }
 
-    TTFSurface* surface = ttf_surface_cache_get_or_add(fontDesc->font, text);
+    TTFSurface* surface = ttf_render_string(fontDesc->font, drawText);
     if (surface == nullptr)
     {
         return;
@@ -1647,45 +1832,27 @@ static void scrolling_text_set_bitmap_for_ttf(utf8* text, int32_t scroll, uint8_
 
     bool use_hinting = gConfigFonts.enable_hinting && fontDesc->hinting_threshold > 0;
 
-    for (int32_t x = 0;; x++)
+    columns.Columns.resize(width);
+    for (int32_t x = 0; x < width; x++)
     {
-        if (x >= width)
-            x = 0;
-
-        // Skip any non-displayed columns
-        if (scroll == 0)
+        ScrollingTextColumn& column = columns.Columns[x];
+        for (int32_t y = min_vpos; y < max_vpos; y++)
         {
-            int16_t scrollPosition = *scrollPositionOffsets;
-            if (scrollPosition == -1)
-                return;
-
-            if (scrollPosition > -1)
+            int32_t row = y - min_vpos;
+            uint8_t src_pixel = src[y * pitch + x];
+            if ((!use_hinting && src_pixel != 0) || src_pixel > 140)
             {
-                uint8_t* dst = &bitmap[scrollPosition];
-
-                for (int32_t y = min_vpos; y < max_vpos; y++)
-                {
-                    uint8_t src_pixel = src[y * pitch + x];
-                    if ((!use_hinting && src_pixel != 0) || src_pixel > 140)
-                    {
-                        // Centre of the glyph: use full colour.
-                        *dst = colour;
-                    }
-                    else if (use_hinting && src_pixel > fontDesc->hinting_threshold)
-                    {
-                        // Simulate font hinting by shading the background colour instead.
-                        *dst = blendColours(colour, *dst);
-                    }
-
-                    // Jump to next row
-                    dst += 64;
-                }
+                // Centre of the glyph: use full colour.
+                column.Pixels[row] = colour;
+                column.DrawMask |= 1 << row;
+            }
+            else if (use_hinting && src_pixel > fontDesc->hinting_threshold)
+            {
+                // Simulate font hinting by shading the background colour instead.
+                column.Pixels[row] = colour;
+                column.DrawMask |= 1 << row;
+                column.BlendMask |= 1 << row;
             }
-            scrollPositionOffsets++;
-        }
-        else
-        {
-            scroll--;
         }
     }
 #endif // NO_TTF
@@ -24,41 +24,13 @@
 
 static bool _ttfInitialised = false;
 
-#    define TTF_SURFACE_CACHE_SIZE 256
-#    define TTF_GETWIDTH_CACHE_SIZE 1024
-
-struct ttf_cache_entry
-{
-    TTFSurface* surface;
-    TTF_Font* font;
-    utf8* text;
-    uint32_t lastUseTick;
-};
-
-struct ttf_getwidth_cache_entry
-{
-    uint32_t width;
-    TTF_Font* font;
-    utf8* text;
-    uint32_t lastUseTick;
-};
-
-static ttf_cache_entry _ttfSurfaceCache[TTF_SURFACE_CACHE_SIZE] = {};
-static int32_t _ttfSurfaceCacheCount = 0;
-static int32_t _ttfSurfaceCacheHitCount = 0;
-static int32_t _ttfSurfaceCacheMissCount = 0;
-
-static ttf_getwidth_cache_entry _ttfGetWidthCache[TTF_GETWIDTH_CACHE_SIZE] = {};
-static int32_t _ttfGetWidthCacheCount = 0;
-static int32_t _ttfGetWidthCacheHitCount = 0;
-static int32_t _ttfGetWidthCacheMissCount = 0;
+// Glyphs are cached per font by the FreeType port, so strings are composed from cached glyphs every time they are drawn.
+// Only the most recently composed string is kept, which is all the callers need as they blit it straight away.
+static TTFSurface* _ttfStringSurface = nullptr;
 
 static TTF_Font* ttf_open_font(const utf8* fontPath, int32_t ptSize);
 static void ttf_close_font(TTF_Font* font);
-static uint32_t ttf_surface_cache_hash(TTF_Font* font, const utf8* text);
-static void ttf_surface_cache_dispose(ttf_cache_entry* entry);
-static void ttf_surface_cache_dispose_all();
-static void ttf_getwidth_cache_dispose_all();
+static void ttf_string_surface_dispose();
 static bool ttf_get_size(TTF_Font* font, const utf8* text, int32_t* width, int32_t* height);
 static TTFSurface* ttf_render(TTF_Font* font, const utf8* text);
 
@@ -101,8 +73,7 @@ void ttf_dispose()
 {
     if (_ttfInitialised)
     {
-        ttf_surface_cache_dispose_all();
-        ttf_getwidth_cache_dispose_all();
+        ttf_string_surface_dispose();
 
         for (int32_t i = 0; i < FONT_SIZE_COUNT; i++)
         {
@@ -129,35 +100,12 @@ static void ttf_close_font(TTF_Font* font)
     TTF_CloseFont(font);
 }
 
-static uint32_t ttf_surface_cache_hash(TTF_Font* font, const utf8* text)
-{
-    uint32_t hash = (uint32_t)((((uintptr_t)font * 23) ^ 0xAAAAAAAA) & 0xFFFFFFFF);
-    for (const utf8* ch = text; *ch != 0; ch++)
-    {
-        hash = ror32(hash, 3) ^ (*ch * 13);
-    }
-    return hash;
-}
-
-static void ttf_surface_cache_dispose(ttf_cache_entry* entry)
-{
-    if (entry->surface != nullptr)
-    {
-        ttf_free_surface(entry->surface);
-        free(entry->text);
-
-        entry->surface = nullptr;
-        entry->font = nullptr;
-        entry->text = nullptr;
-    }
-}
-
-static void ttf_surface_cache_dispose_all()
+static void ttf_string_surface_dispose()
 {
-    for (int32_t i = 0; i < TTF_SURFACE_CACHE_SIZE; i++)
+    if (_ttfStringSurface != nullptr)
     {
-        ttf_surface_cache_dispose(&_ttfSurfaceCache[i]);
-        _ttfSurfaceCacheCount--;
+        ttf_free_surface(_ttfStringSurface);
+        _ttfStringSurface = nullptr;
     }
 }
 
@@ -174,132 +122,49 @@ void ttf_toggle_hinting()
         bool use_hinting = gConfigFonts.enable_hinting && fontDesc->hinting_threshold;
         TTF_SetFontHinting(fontDesc->font, use_hinting ? 1 : 0);
     }
-
-    if (_ttfSurfaceCacheCount)
-    {
-        ttf_surface_cache_dispose_all();
-    }
 }
 
-TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, const utf8* text)
+/**
+ * Composes the string from the font's cached glyphs. The returned surface is only valid until the next call.
+ */
+TTFSurface* ttf_render_string(TTF_Font* font, const utf8* text)
 {
-    ttf_cache_entry* entry;
-
-    uint32_t hash = ttf_surface_cache_hash(font, text);
-    int32_t index = hash % TTF_SURFACE_CACHE_SIZE;
-    for (int32_t i = 0; i < TTF_SURFACE_CACHE_SIZE; i++)
-    {
-        entry = &_ttfSurfaceCache[index];
-
-        // Check if entry is a hit
-        if (entry->surface == nullptr)
-            break;
-        if (entry->font == font && strcmp(entry->text, text) == 0)
-        {
-            _ttfSurfaceCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
-            return entry->surface;
-        }
-
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
-        {
-            break;
-        }
-
-        // Check if next entry is a hit
-        if (++index >= TTF_SURFACE_CACHE_SIZE)
-            index = 0;
-    }
-
-    // Cache miss, replace entry with new surface
-    entry = &_ttfSurfaceCache[index];
-    ttf_surface_cache_dispose(entry);
-
-    TTFSurface* surface = ttf_render(font, text);
-    if (surface == nullptr)
-    {
-        return nullptr;
-    }
-
-    _ttfSurfaceCacheMissCount++;
-    // printf("CACHE HITS: %d   MISSES: %d)\n", _ttfSurfaceCacheHitCount, _ttfSurfaceCacheMissCount);
-
-    _ttfSurfaceCacheCount++;
-    entry->surface = surface;
-    entry->font = font;
-    entry->text = _strdup(text);
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->surface;
+    ttf_string_surface_dispose();
+    _ttfStringSurface = ttf_render(font, text);
+    return _ttfStringSurface;
 }
 
-static void ttf_getwidth_cache_dispose(ttf_getwidth_cache_entry* entry)
+uint32_t ttf_get_string_width(TTF_Font* font, const utf8* text)
 {
-    if (entry->text != nullptr)
-    {
-        free(entry->text);
-
-        entry->width = 0;
-        entry->font = nullptr;
-        entry->text = nullptr;
-    }
+    int32_t width = 0;
+    int32_t height = 0;
+    ttf_get_size(font, text, &width, &height);
+    return width;
 }
 
-static void ttf_getwidth_cache_dispose_all()
+void ttf_get_glyph_cache_stats(uint32_t* hits, uint32_t* misses, size_t* glyphs)
 {
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
+    *hits = 0;
+    *misses = 0;
+    *glyphs = 0;
+    if (!_ttfInitialised)
     {
-        ttf_getwidth_cache_dispose(&_ttfGetWidthCache[i]);
-        _ttfGetWidthCacheCount--;
+        return;
     }
-}
 
-uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, const utf8* text)
-{
-    ttf_getwidth_cache_entry* entry;
-
-    uint32_t hash = ttf_surface_cache_hash(font, text);
-    int32_t index = hash % TTF_GETWIDTH_CACHE_SIZE;
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
+    for (int32_t i = 0; i < FONT_SIZE_COUNT; i++)
     {
-        entry = &_ttfGetWidthCache[index];
-
-        // Check if entry is a hit
-        if (entry->text == nullptr)
-            break;
-        if (entry->font == font && strcmp(entry->text, text) == 0)
-        {
-            _ttfGetWidthCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
-            return entry->width;
-        }
-
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
+        TTFFontDescriptor* fontDesc = &(gCurrentTTFFontSet->size[i]);
+        if (fontDesc->font != nullptr)
         {
-            break;
+            uint32_t fontHits, fontMisses;
+            size_t fontGlyphs;
+            TTF_GetGlyphCacheStats(fontDesc->font, &fontHits, &fontMisses, &fontGlyphs);
+            *hits += fontHits;
+            *misses += fontMisses;
+            *glyphs += fontGlyphs;
         }
-
-        // Check if next entry is a hit
-        if (++index >= TTF_GETWIDTH_CACHE_SIZE)
-            index = 0;
     }
-
-    // Cache miss, replace entry with new width
-    entry = &_ttfGetWidthCache[index];
-    ttf_getwidth_cache_dispose(entry);
-
-    int32_t width, height;
-    ttf_get_size(font, text, &width, &height);
-
-    _ttfGetWidthCacheMissCount++;
-
-    _ttfGetWidthCacheCount++;
-    entry->width = width;
-    entry->font = font;
-    entry->text = _strdup(text);
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->width;
 }
 
 TTFFontDescriptor* ttf_get_font_from_sprite_base(uint16_t spriteBase)
@@ -26,8 +26,9 @@ struct TTFSurface
 
 TTFFontDescriptor* ttf_get_font_from_sprite_base(uint16_t spriteBase);
 void ttf_toggle_hinting();
-TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, const utf8* text);
-uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, const utf8* text);
+TTFSurface* ttf_render_string(TTF_Font* font, const utf8* text);
+uint32_t ttf_get_string_width(TTF_Font* font, const utf8* text);
+void ttf_get_glyph_cache_stats(uint32_t* hits, uint32_t* misses, size_t* glyphs);
 bool ttf_provides_glyph(const TTF_Font* font, codepoint_t codepoint);
 void ttf_free_surface(TTFSurface* surface);
 
@@ -39,6 +40,7 @@ int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h);
 TTFSurface* TTF_RenderUTF8_Solid(TTF_Font* font, const char* text, uint32_t colour);
 TTFSurface* TTF_RenderUTF8_Shaded(TTF_Font* font, const char* text, uint32_t fg, uint32_t bg);
 void TTF_CloseFont(TTF_Font* font);
+void TTF_GetGlyphCacheStats(const TTF_Font* font, uint32_t* hits, uint32_t* misses, size_t* count);
 void TTF_SetFontHinting(TTF_Font* font, int hinting);
 int TTF_GetFontHinting(const TTF_Font* font);
 void TTF_Quit(void);
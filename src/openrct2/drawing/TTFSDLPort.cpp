@@ -33,6 +33,7 @@ misrepresented as being the original software.
 #    include <stdio.h>
 #    include <stdlib.h>
 #    include <string.h>
+#    include <unordered_map>
 
 #    pragma clang diagnostic push
 #    pragma clang diagnostic ignored "-Wdocumentation"
@@ -122,9 +123,11 @@ struct _TTF_Font
     int underline_offset;
     int underline_height;
 
-    /* Cache for style-transformed glyphs */
+    /* Cache for style-transformed glyphs, one entry per code point so glyphs never evict each other */
     c_glyph* current;
-    c_glyph cache[257]; /* 257 is a prime */
+    std::unordered_map<uint16_t, c_glyph>* glyphs;
+    uint32_t glyph_hits;
+    uint32_t glyph_misses;
 
     /* We are responsible for closing the font stream */
     FILE* src;
@@ -391,6 +394,7 @@ static TTF_Font* TTF_OpenFontIndexRW(FILE* src, int freesrc, int ptsize, long in
         return NULL;
     }
     std::fill_n((uint8_t*)font, sizeof(*font), 0x00);
+    font->glyphs = new std::unordered_map<uint16_t, c_glyph>();
 
     font->src = src;
     font->freesrc = freesrc;
@@ -557,16 +561,12 @@ static void Flush_Glyph(c_glyph* glyph)
 
 static void Flush_Cache(TTF_Font* font)
 {
-    int i;
-    int size = sizeof(font->cache) / sizeof(font->cache[0]);
-
-    for (i = 0; i < size; ++i)
+    for (auto& entry : *font->glyphs)
     {
-        if (font->cache[i].cached)
-        {
-            Flush_Glyph(&font->cache[i]);
-        }
+        Flush_Glyph(&entry.second);
     }
+    font->glyphs->clear();
+    font->current = NULL;
 }
 
 static FT_Error Load_Glyph(TTF_Font* font, uint16_t ch, c_glyph* cached, int want)
@@ -962,18 +962,19 @@ static FT_Error Load_Glyph(TTF_Font* font, uint16_t ch, c_glyph* cached, int wan
 static FT_Error Find_Glyph(TTF_Font* font, uint16_t ch, int want)
 {
     int retval = 0;
-    int hsize = sizeof(font->cache) / sizeof(font->cache[0]);
 
-    int h = ch % hsize;
-    font->current = &font->cache[h];
-
-    if (font->current->cached != ch)
-        Flush_Glyph(font->current);
+    /* Elements of an unordered_map are never moved, so current stays valid until the cache is flushed */
+    font->current = &(*font->glyphs)[ch];
 
     if ((font->current->stored & want) != want)
     {
+        font->glyph_misses++;
         retval = Load_Glyph(font, ch, font->current, want);
     }
+    else
+    {
+        font->glyph_hits++;
+    }
     return retval;
 }
 
@@ -981,7 +982,11 @@ void TTF_CloseFont(TTF_Font* font)
 {
     if (font)
     {
-        Flush_Cache(font);
+        if (font->glyphs != NULL)
+        {
+            Flush_Cache(font);
+            delete font->glyphs;
+        }
         if (font->face)
         {
             FT_Done_Face(font->face);
@@ -1525,6 +1530,13 @@ TTFSurface* TTF_RenderUTF8_Shaded(TTF_Font* font, const char* text, [[maybe_unus
     return textbuf;
 }
 
+void TTF_GetGlyphCacheStats(const TTF_Font* font, uint32_t* hits, uint32_t* misses, size_t* count)
+{
+    *hits = font->glyph_hits;
+    *misses = font->glyph_misses;
+    *count = font->glyphs->size();
+}
+
 void TTF_SetFontHinting(TTF_Font* font, int hinting)
 {
     if (hinting == TTF_HINTING_LIGHT)
@@ -0,0 +1,292 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../config/Config.h"
+#include "../sprites.h"
+#include "Drawing.h"
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// The RLE blitter samples every (1 << zoom)th pixel of the full sized sprite, starting at a phase that depends on where the
+// sprite lands relative to the drawing area. These entries hold that exact sample grid re-encoded as a zoom level 0 RLE sprite,
+// so drawing a zoomed out view only has to walk the pixels that actually end up on screen.
+struct ZoomedSpriteEntry
+{
+    rct_g1_element Element;
+    std::vector<uint8_t> Data;
+    std::list<uint64_t>::iterator LruPosition;
+};
+
+// Extra bytes accounted per entry on top of the pixel data, approximating the map and LRU node overhead.
+constexpr size_t ZOOMED_SPRITE_ENTRY_OVERHEAD = 96;
+constexpr int32_t ZOOMED_SPRITE_MAX_ZOOM_LEVEL = 3;
+
+static std::unordered_map<uint64_t, ZoomedSpriteEntry> _zoomedSprites;
+static std::list<uint64_t> _zoomedSpritesLru;
+static size_t _zoomedSpritesSize;
+
+static uint64_t zoomed_sprite_cache_key(int32_t imageId, int32_t zoomLevel, int32_t phaseX, int32_t phaseY)
+{
+    return ((uint64_t)(uint32_t)imageId << 8) | (uint64_t)(zoomLevel << 6) | (uint64_t)(phaseX << 3) | (uint64_t)phaseY;
+}
+
+static size_t zoomed_sprite_cache_get_budget()
+{
+    if (gConfigGeneral.zoomed_sprite_cache_size <= 0)
+    {
+        return 0;
+    }
+    return (size_t)gConfigGeneral.zoomed_sprite_cache_size * 1024 * 1024;
+}
+
+static size_t zoomed_sprite_cache_entry_size(const ZoomedSpriteEntry& entry)
+{
+    return entry.Data.capacity() + ZOOMED_SPRITE_ENTRY_OVERHEAD;
+}
+
+static void zoomed_sprite_cache_remove(std::unordered_map<uint64_t, ZoomedSpriteEntry>::iterator it)
+{
+    _zoomedSpritesSize -= zoomed_sprite_cache_entry_size(it->second);
+    _zoomedSpritesLru.erase(it->second.LruPosition);
+    _zoomedSprites.erase(it);
+}
+
+static void zoomed_sprite_cache_evict(size_t budget)
+{
+    while (_zoomedSpritesSize > budget && !_zoomedSpritesLru.empty())
+    {
+        auto it = _zoomedSprites.find(_zoomedSpritesLru.back());
+        zoomed_sprite_cache_remove(it);
+    }
+}
+
+/**
+ * Decodes a single row of an RLE sprite into pixels and a mask of which pixels are present.
+ */
+static void zoomed_sprite_decode_row(const rct_g1_element* g1, int32_t y, uint8_t* pixels, uint8_t* present)
+{
+    std::fill_n(present, g1->width, 0);
+
+    const uint8_t* source = g1->offset;
+    const uint16_t lineOffset = source[y * 2] | (source[y * 2 + 1] << 8);
+    const uint8_t* lineData = source + lineOffset;
+
+    uint8_t isEndOfLine = 0;
+    while (!isEndOfLine)
+    {
+        uint8_t dataSize = *lineData++;
+        uint8_t firstPixelX = *lineData++;
+        isEndOfLine = dataSize & 0x80;
+        dataSize &= 0x7F;
+
+        int32_t numPixels = std::min<int32_t>(dataSize, g1->width - firstPixelX);
+        for (int32_t i = 0; i < numPixels; i++)
+        {
+            pixels[firstPixelX + i] = lineData[i];
+            present[firstPixelX + i] = 1;
+        }
+        lineData += dataSize;
+    }
+}
+
+/**
+ * Builds the RLE data for the sample grid starting at (phaseX, phaseY) with a stride of (1 << zoomLevel) pixels.
+ * Returns false if the sprite can not be represented, in which case the caller falls back to the full sized sprite.
+ */
+static bool zoomed_sprite_build(
+    const rct_g1_element* g1, int32_t zoomLevel, int32_t phaseX, int32_t phaseY, std::vector<uint8_t>& data, int32_t* outWidth,
+    int32_t* outHeight)
+{
+    int32_t zoomAmount = 1 << zoomLevel;
+    if (g1->width <= phaseX || g1->height <= phaseY)
+    {
+        return false;
+    }
+
+    int32_t width = (g1->width - phaseX + zoomAmount - 1) >> zoomLevel;
+    int32_t height = (g1->height - phaseY + zoomAmount - 1) >> zoomLevel;
+    if (width > 256)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> rowPixels(g1->width);
+    std::vector<uint8_t> rowPresent(g1->width);
+
+    data.clear();
+    data.resize(height * 2);
+    for (int32_t row = 0; row < height; row++)
+    {
+        size_t lineOffset = data.size();
+        if (lineOffset > UINT16_MAX)
+        {
+            return false;
+        }
+        data[row * 2] = lineOffset & 0xFF;
+        data[row * 2 + 1] = (lineOffset >> 8) & 0xFF;
+
+        zoomed_sprite_decode_row(g1, phaseY + (row << zoomLevel), rowPixels.data(), rowPresent.data());
+
+        size_t lastChunk = SIZE_MAX;
+        int32_t column = 0;
+        while (column < width)
+        {
+            int32_t sourceX = phaseX + (column << zoomLevel);
+            if (!rowPresent[sourceX])
+            {
+                column++;
+                continue;
+            }
+
+            lastChunk = data.size();
+            data.push_back(0);
+            data.push_back((uint8_t)column);
+            uint8_t chunkSize = 0;
+            while (column < width && chunkSize < 0x7F)
+            {
+                sourceX = phaseX + (column << zoomLevel);
+                if (!rowPresent[sourceX])
+                {
+                    break;
+                }
+                data.push_back(rowPixels[sourceX]);
+                chunkSize++;
+                column++;
+            }
+            data[lastChunk] = chunkSize;
+        }
+
+        if (lastChunk == SIZE_MAX)
+        {
+            // Empty lines still need a terminating chunk
+            data.push_back(0x80);
+            data.push_back(0);
+        }
+        else
+        {
+            data[lastChunk] |= 0x80;
+        }
+    }
+
+    *outWidth = width;
+    *outHeight = height;
+    return true;
+}
+
+/**
+ * Gets a pre-filtered version of an RLE sprite for the given zoom level and sample phase, building it on first use.
+ * The returned element is a zoom level 0 RLE sprite where pixel (x, y) is pixel (phaseX + (x << zoomLevel), phaseY +
+ * (y << zoomLevel)) of the original sprite. Returns nullptr if the cache is disabled or the sprite is not eligible.
+ */
+const rct_g1_element* gfx_get_zoomed_sprite(
+    int32_t imageId, const rct_g1_element* g1, int32_t zoomLevel, int32_t phaseX, int32_t phaseY)
+{
+    if (zoomLevel <= 0 || zoomLevel > ZOOMED_SPRITE_MAX_ZOOM_LEVEL || !(g1->flags & G1_FLAG_RLE_COMPRESSION)
+        || g1->offset == nullptr)
+    {
+        return nullptr;
+    }
+
+    // The temporary sprite and the scrolling text bitmaps are rewritten in place, so they can not be cached.
+    if (imageId == SPR_TEMP || (imageId >= SPR_SCROLLING_TEXT_START && imageId < SPR_SCROLLING_TEXT_DEFAULT))
+    {
+        return nullptr;
+    }
+
+    size_t budget = zoomed_sprite_cache_get_budget();
+    if (budget == 0)
+    {
+        if (!_zoomedSprites.empty())
+        {
+            gfx_zoomed_sprite_cache_clear();
+        }
+        return nullptr;
+    }
+
+    uint64_t key = zoomed_sprite_cache_key(imageId, zoomLevel, phaseX, phaseY);
+    auto it = _zoomedSprites.find(key);
+    if (it != _zoomedSprites.end())
+    {
+        _zoomedSpritesLru.splice(_zoomedSpritesLru.begin(), _zoomedSpritesLru, it->second.LruPosition);
+        return it->second.Element.offset != nullptr ? &it->second.Element : nullptr;
+    }
+
+    ZoomedSpriteEntry entry = {};
+    int32_t width = 0;
+    int32_t height = 0;
+    if (zoomed_sprite_build(g1, zoomLevel, phaseX, phaseY, entry.Data, &width, &height))
+    {
+        entry.Data.shrink_to_fit();
+        entry.Element.width = width;
+        entry.Element.height = height;
+        entry.Element.flags = G1_FLAG_RLE_COMPRESSION;
+    }
+    else
+    {
+        // Remember sprites that can not be filtered so they are not rebuilt every frame
+        entry.Data.clear();
+        entry.Data.shrink_to_fit();
+    }
+
+    size_t entrySize = zoomed_sprite_cache_entry_size(entry);
+    if (entrySize > budget)
+    {
+        return nullptr;
+    }
+    zoomed_sprite_cache_evict(budget - entrySize);
+
+    _zoomedSpritesLru.push_front(key);
+    entry.LruPosition = _zoomedSpritesLru.begin();
+    auto& inserted = _zoomedSprites.emplace(key, std::move(entry)).first->second;
+    if (!inserted.Data.empty())
+    {
+        inserted.Element.offset = inserted.Data.data();
+    }
+    _zoomedSpritesSize += entrySize;
+    return inserted.Element.offset != nullptr ? &inserted.Element : nullptr;
+}
+
+void gfx_zoomed_sprite_cache_invalidate(int32_t imageId)
+{
+    if (_zoomedSprites.empty())
+    {
+        return;
+    }
+
+    for (int32_t zoomLevel = 1; zoomLevel <= ZOOMED_SPRITE_MAX_ZOOM_LEVEL; zoomLevel++)
+    {
+        int32_t zoomAmount = 1 << zoomLevel;
+        for (int32_t phaseY = 0; phaseY < zoomAmount; phaseY++)
+        {
+            for (int32_t phaseX = 0; phaseX < zoomAmount; phaseX++)
+            {
+                auto it = _zoomedSprites.find(zoomed_sprite_cache_key(imageId, zoomLevel, phaseX, phaseY));
+                if (it != _zoomedSprites.end())
+                {
+                    zoomed_sprite_cache_remove(it);
+                }
+            }
+        }
+    }
+}
+
+void gfx_zoomed_sprite_cache_clear()
+{
+    _zoomedSprites.clear();
+    _zoomedSpritesLru.clear();
+    _zoomedSpritesSize = 0;
+}
+
+size_t gfx_zoomed_sprite_cache_get_size()
+{
+    return _zoomedSpritesSize;
+}
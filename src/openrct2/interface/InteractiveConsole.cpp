@@ -19,10 +19,12 @@
 #include "../actions/RideSetSetting.hpp"
 #include "../actions/StaffSetCostumeAction.hpp"
 #include "../config/Config.h"
+#include "../core/File.h"
 #include "../core/Guard.hpp"
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/Font.h"
+#include "../drawing/TTF.h"
 #include "../interface/Chat.h"
 #include "../interface/Colour.h"
 #include "../localisation/Localisation.h"
@@ -40,9 +42,12 @@
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
+#include "../world/Footpath.h"
+#include "../world/FootpathConnectivity.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
+#include "../world/TileElementAllocator.h"
 #include "Viewport.h"
 
 #include <algorithm>
@@ -51,6 +56,7 @@
 #include <cstdlib>
 #include <deque>
 #include <exception>
+#include <iterator>
 #include <string>
 #include <thread>
 #include <vector>
@@ -146,6 +152,48 @@ static int32_t cc_rides(InteractiveConsole& console, const arguments_t& argv)
                     ride->mode, name);
             }
         }
+        else if (argv[0] == "measurements")
+        {
+            if (argv.size() < 3 || (argv[2] != "csv" && argv[2] != "json"))
+            {
+                console.WriteFormatLine("rides measurements <ride id> <csv|json> [file]");
+                return 0;
+            }
+
+            bool int_valid = false;
+            int32_t ride_index = console_parse_int(argv[1], &int_valid);
+            Ride* ride = (int_valid && ride_index >= 0 && ride_index < MAX_RIDES) ? get_ride(ride_index) : nullptr;
+            if (ride == nullptr || ride->type == RIDE_TYPE_NULL)
+            {
+                console.WriteFormatLine("No ride found with index %s", argv[1].c_str());
+            }
+            else if (ride->measurement_index >= MAX_RIDE_MEASUREMENTS)
+            {
+                console.WriteFormatLine("No measurements recorded for ride %d, open its measurements tab first", ride_index);
+            }
+            else
+            {
+                const rct_ride_measurement* measurement = get_ride_measurement(ride->measurement_index);
+                std::string data = argv[2] == "csv" ? ride_measurement_export_csv(measurement)
+                                                    : ride_measurement_export_json(measurement);
+                if (argv.size() > 3)
+                {
+                    try
+                    {
+                        File::WriteAllBytes(argv[3], data.data(), data.size());
+                        console.WriteFormatLine("Wrote %u samples to %s", measurement->num_items, argv[3].c_str());
+                    }
+                    catch (const std::exception& e)
+                    {
+                        console.WriteLineError(e.what());
+                    }
+                }
+                else
+                {
+                    console.WriteLine(data);
+                }
+            }
+        }
         else if (argv[0] == "set")
         {
             if (argv.size() < 4)
@@ -362,7 +410,7 @@ static int32_t cc_rides(InteractiveConsole& console, const arguments_t& argv)
     }
     else
     {
-        console.WriteFormatLine("subcommands: list, set");
+        console.WriteFormatLine("subcommands: list, measurements, set");
     }
     return 0;
 }
@@ -1194,8 +1242,7 @@ static int32_t cc_remove_park_fences(InteractiveConsole& console, [[maybe_unused
 
 static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
-    map_reorganise_elements();
-    int32_t tileElementCount = gNextFreeTileElement - gTileElements - 1;
+    auto stats = tile_element_allocator_get_stats();
 
     int32_t rideCount = 0;
     for (int32_t i = 0; i < MAX_RIDES; ++i)
@@ -1232,13 +1279,71 @@ static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] cons
     }
 
     console.WriteFormatLine("Sprites: %d/%d", spriteCount, MAX_SPRITES);
-    console.WriteFormatLine("Map Elements: %d/%d", tileElementCount, MAX_TILE_ELEMENTS);
+    console.WriteFormatLine("Map Elements: %d (%d can be saved)", stats.ElementCount, MAX_TILE_ELEMENTS);
     console.WriteFormatLine("Banners: %d/%zu", bannerCount, MAX_BANNERS);
     console.WriteFormatLine("Rides: %d/%d", rideCount, MAX_RIDES);
     console.WriteFormatLine("Staff: %d/%d", staffCount, STAFF_MAX_COUNT);
     return 0;
 }
 
+static int32_t cc_show_map_memory(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    static constexpr const char* elementTypeNames[] = {
+        "Surface", "Path", "Track", "Small scenery", "Entrance", "Wall", "Large scenery", "Banner", "Corrupt",
+    };
+
+    auto stats = tile_element_allocator_get_stats();
+    console.WriteFormatLine(
+        "Map elements: %d in %d slots, %d extra chunks (%zu KiB)", stats.ElementCount, stats.SlotCount,
+        stats.ExtraChunkCount, stats.SlotCount * sizeof(TileElement) / 1024);
+    for (size_t i = 0; i < stats.ElementCountByType.size(); i++)
+    {
+        int32_t count = stats.ElementCountByType[i];
+        if (count != 0)
+        {
+            const char* name = i < std::size(elementTypeNames) ? elementTypeNames[i] : "Unknown";
+            console.WriteFormatLine("  %s: %d (%zu KiB)", name, count, count * sizeof(TileElement) / 1024);
+        }
+    }
+    return 0;
+}
+
+static int32_t cc_count_stranded_paths(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    console.WriteFormatLine(
+        "%d path elements are not connected to any park entrance.", footpath_connectivity_count_stranded_paths());
+    return 0;
+}
+
+static int32_t cc_verify_path_wide_flags(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    int32_t numMismatches = footpath_verify_path_wide_flags();
+    if (numMismatches == 0)
+    {
+        console.WriteLine("Wide flags of all paths match a full update.");
+    }
+    else
+    {
+        console.WriteFormatLine("Wide flags of the paths on %d tiles do not match a full update, see the log.", numMismatches);
+    }
+    return 0;
+}
+
+static int32_t cc_show_font_cache(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifndef NO_TTF
+    uint32_t hits, misses;
+    size_t glyphs;
+    ttf_get_glyph_cache_stats(&hits, &misses, &glyphs);
+    console.WriteFormatLine("Cached glyphs: %zu", glyphs);
+    console.WriteFormatLine("Glyph hits: %u", hits);
+    console.WriteFormatLine("Glyph misses: %u", misses);
+#else
+    console.WriteLine("TrueType fonts are not supported in this build.");
+#endif
+    return 0;
+}
+
 static int32_t cc_for_date([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     int32_t year = 0;
@@ -1581,6 +1686,7 @@ static constexpr const console_command console_command_table[] = {
     { "abort", cc_abort, "Calls std::abort(), for testing purposes only.", "abort" },
     { "clear", cc_clear, "Clears the console.", "clear" },
     { "close", cc_close, "Closes the console.", "close" },
+    { "count_stranded_paths", cc_count_stranded_paths, "Counts the paths that are not connected to any park entrance.", "count_stranded_paths" },
     { "date", cc_for_date, "Sets the date to a given date.", "Format <year>[ <month>[ <day>]]." },
     { "dereference", cc_dereference, "Dereferences a nullptr, for testing purposes only", "dereference" },
     { "echo", cc_echo, "Echoes the text to the console.", "echo <text>" },
@@ -1602,11 +1708,14 @@ static constexpr const console_command console_command_table[] = {
     { "save_park", cc_save_park, "Save current state of park. If no name specified default path will be used.", "save_park [name]" },
     { "say", cc_say, "Say to other players.", "say <message>" },
     { "set", cc_set, "Sets the variable to the specified value.", "set <variable> <value>" },
+    { "show_font_cache", cc_show_font_cache, "Shows the TrueType glyph cache usage.", "show_font_cache" },
     { "show_limits", cc_show_limits, "Shows the map data counts and limits.", "show_limits" },
+    { "show_map_memory", cc_show_map_memory, "Shows how much memory the map elements use by type.", "show_map_memory" },
     { "staff", cc_staff, "Staff management.", "staff <subcommand>" },
     { "terminate", cc_terminate, "Calls std::terminate(), for testing purposes only.", "terminate" },
     { "twitch", cc_twitch, "Twitch API", "twitch" },
     { "variables", cc_variables, "Lists all the variables that can be used with get and sometimes set.", "variables" },
+    { "verify_path_wide_flags", cc_verify_path_wide_flags, "Checks the wide flags of all paths against a full update.", "verify_path_wide_flags" },
     { "windows", cc_windows, "Lists all the windows that can be opened.", "windows" },
     { "replay_startrecord", cc_replay_startrecord, "Starts recording a new replay.", "replay_startrecord <name> [max_ticks]"},
     { "replay_stoprecord", cc_replay_stoprecord, "Stops recording a new replay.", "replay_stoprecord"},
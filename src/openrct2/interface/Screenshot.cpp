@@ -26,14 +26,19 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <vector>
 
 using namespace OpenRCT2;
 
 uint8_t gScreenshotCountdown = 0;
 
+// Number of rows rendered at a time for screenshots that are streamed to disk
+constexpr int32_t SCREENSHOT_DEFAULT_TILE_HEIGHT = 1024;
+
 static bool WriteDpiToFile(const std::string_view& path, const rct_drawpixelinfo* dpi, const rct_palette& palette)
 {
     auto const pixels8 = dpi->bits;
@@ -57,6 +62,49 @@ static bool WriteDpiToFile(const std::string_view& path, const rct_drawpixelinfo
     }
 }
 
+/**
+ * Renders the viewport in horizontal bands and streams each band into the PNG encoder as it is completed, so only one band
+ * is held in memory at a time regardless of the size of the viewport.
+ */
+static bool WriteViewportToFile(
+    const std::string_view& path, rct_viewport* viewport, int32_t tileHeight, const rct_palette& palette)
+{
+    try
+    {
+        int32_t bandHeight = std::clamp(tileHeight, 1, std::max<int32_t>(viewport->height, 1));
+        std::vector<uint8_t> band((size_t)viewport->width * bandHeight);
+
+        Image image;
+        image.Width = viewport->width;
+        image.Height = viewport->height;
+        image.Depth = 8;
+        image.Stride = viewport->width;
+        image.Palette = std::make_unique<rct_palette>(palette);
+
+        auto renderBand = [viewport, &band](uint32_t top, uint32_t height) -> const uint8_t* {
+            std::fill(band.begin(), band.end(), 0);
+
+            rct_drawpixelinfo dpi;
+            dpi.x = 0;
+            dpi.y = top;
+            dpi.width = viewport->width;
+            dpi.height = height;
+            dpi.pitch = 0;
+            dpi.zoom_level = 0;
+            dpi.bits = band.data();
+            viewport_render(&dpi, viewport, 0, top, viewport->width, top + height);
+            return band.data();
+        };
+        Imaging::WriteToFile(path, image, bandHeight, renderBand, IMAGE_FORMAT::PNG);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write png: %s", e.what());
+        return false;
+    }
+}
+
 /**
  *
  *  rct2: 0x006E3AEC
@@ -284,17 +332,6 @@ void screenshot_giant()
     // Ensure sprites appear regardless of rotation
     reset_all_sprite_quadrant_placements();
 
-    rct_drawpixelinfo dpi;
-    dpi.x = 0;
-    dpi.y = 0;
-    dpi.width = resolutionWidth;
-    dpi.height = resolutionHeight;
-    dpi.pitch = 0;
-    dpi.zoom_level = 0;
-    dpi.bits = (uint8_t*)malloc(dpi.width * dpi.height);
-
-    viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
-
     // Get a free screenshot path
     char path[MAX_PATH];
     if (screenshot_get_next_path(path, MAX_PATH) == -1)
@@ -307,9 +344,11 @@ void screenshot_giant()
     rct_palette renderedPalette;
     screenshot_get_rendered_palette(&renderedPalette);
 
-    WriteDpiToFile(path, &dpi, renderedPalette);
-
-    free(dpi.bits);
+    if (!WriteViewportToFile(path, &viewport, SCREENSHOT_DEFAULT_TILE_HEIGHT, renderedPalette))
+    {
+        context_show_error(STR_SCREENSHOT_FAILED, STR_NONE);
+        return;
+    }
 
     // Show user that screenshot saved successfully
     set_format_arg(0, rct_string_id, STR_STRING);
@@ -578,18 +617,17 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
             climate_force_weather(customWeather);
         }
 
+        if (options->tile_height < 0)
+        {
+            std::printf("Tile height must be a positive number of pixels.\n");
+            drawing_engine_dispose();
+            return -1;
+        }
+        int32_t tileHeight = options->tile_height != 0 ? options->tile_height : SCREENSHOT_DEFAULT_TILE_HEIGHT;
+
         // Ensure sprites appear regardless of rotation
         reset_all_sprite_quadrant_placements();
 
-        rct_drawpixelinfo dpi;
-        dpi.x = 0;
-        dpi.y = 0;
-        dpi.width = resolutionWidth;
-        dpi.height = resolutionHeight;
-        dpi.pitch = 0;
-        dpi.zoom_level = 0;
-        dpi.bits = (uint8_t*)malloc(dpi.width * dpi.height);
-
         if (options->hide_guests)
         {
             viewport.flags |= VIEWPORT_FLAG_INVISIBLE_PEEPS;
@@ -625,15 +663,16 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
             game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_REMOVELITTER, 0, GAME_COMMAND_CHEAT, 0, 0);
         }
 
-        viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
-
         rct_palette renderedPalette;
         screenshot_get_rendered_palette(&renderedPalette);
 
-        WriteDpiToFile(outputPath, &dpi, renderedPalette);
+        bool written = WriteViewportToFile(outputPath, &viewport, tileHeight, renderedPalette);
 
-        free(dpi.bits);
         drawing_engine_dispose();
+        if (!written)
+        {
+            return -1;
+        }
     }
     return 1;
 }
@@ -28,6 +28,7 @@ struct ScreenshotOptions
     bool fix_vandalism = false;
     bool remove_litter = false;
     bool tidy_up_park = false;
+    int32_t tile_height = 0;
 };
 
 void screenshot_check();
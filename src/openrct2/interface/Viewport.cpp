@@ -1816,7 +1816,7 @@ void screen_get_map_xy_with_z(int16_t screenX, int16_t screenY, int16_t z, int16
     screenY = viewport->view_y + ((screenY - viewport->y) << viewport->zoom);
 
     LocationXY16 mapPosition = viewport_coord_to_map_coord(screenX, screenY + z, 0);
-    if (mapPosition.x < 0 || mapPosition.x >= (256 * 32) || mapPosition.y < 0 || mapPosition.y > (256 * 32))
+    if (mapPosition.x < 0 || mapPosition.x >= MAXIMUM_MAP_SIZE_BIG || mapPosition.y < 0 || mapPosition.y > MAXIMUM_MAP_SIZE_BIG)
     {
         *mapX = LOCATION_NULL;
         return;
@@ -20,6 +20,7 @@
 #include "../network/network.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
+#include "../ride/RideSpatialIndex.h"
 #include "../ride/ShopItem.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
@@ -1615,30 +1616,10 @@ std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
     else
     {
         // Take nearby rides into consideration
-        constexpr auto radius = 10 * 32;
-        int32_t cx = floor2(x, 32);
-        int32_t cy = floor2(y, 32);
-        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += 32)
-        {
-            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += 32)
-            {
-                if (map_is_location_valid({ tileX, tileY }))
-                {
-                    auto tileElement = map_get_first_element_at(tileX >> 5, tileY >> 5);
-                    if (tileElement != nullptr)
-                    {
-                        do
-                        {
-                            if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
-                            {
-                                auto rideIndex = tileElement->AsTrack()->GetRideIndex();
-                                rideConsideration[rideIndex] = true;
-                            }
-                        } while (!(tileElement++)->IsLastForTile());
-                    }
-                }
-            }
-        }
+        constexpr auto radius = 10;
+        int32_t cx = x >> 5;
+        int32_t cy = y >> 5;
+        rideConsideration = ride_spatial_index_get_rides_in_area(cx - radius, cy - radius, cx + radius, cy + radius);
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
         int32_t i;
@@ -2644,14 +2625,14 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
     uint16_t nearby_music = 0;
     uint16_t num_rubbish = 0;
 
-    int16_t initial_x = std::max(centre_x - 160, 0);
-    int16_t initial_y = std::max(centre_y - 160, 0);
-    int16_t final_x = std::min(centre_x + 160, 8192);
-    int16_t final_y = std::min(centre_y + 160, 8192);
+    int32_t initial_x = std::max(centre_x - 160, 0);
+    int32_t initial_y = std::max(centre_y - 160, 0);
+    int32_t final_x = std::min(centre_x + 160, MAXIMUM_MAP_SIZE_BIG);
+    int32_t final_y = std::min(centre_y + 160, MAXIMUM_MAP_SIZE_BIG);
 
-    for (int16_t x = initial_x; x < final_x; x += 32)
+    for (int32_t x = initial_x; x < final_x; x += 32)
     {
-        for (int16_t y = initial_y; y < final_y; y += 32)
+        for (int32_t y = initial_y; y < final_y; y += 32)
         {
             TileElement* tileElement = map_get_first_element_at(x / 32, y / 32);
 
@@ -2888,27 +2869,17 @@ static void peep_head_for_nearest_ride_type(Guest* peep, int32_t rideType)
     else
     {
         // Take nearby rides into consideration
-        int32_t cx = floor2(peep->x, 32);
-        int32_t cy = floor2(peep->y, 32);
-        for (int32_t x = cx - 320; x <= cx + 320; x += 32)
+        int32_t cx = peep->x >> 5;
+        int32_t cy = peep->y >> 5;
+        auto nearbyRides = ride_spatial_index_get_rides_in_area(cx - 10, cy - 10, cx + 10, cy + 10);
+        for (int32_t i = 0; i < MAX_RIDES; i++)
         {
-            for (int32_t y = cy - 320; y <= cy + 320; y += 32)
+            if (nearbyRides[i])
             {
-                if (x >= 0 && y >= 0 && x < (256 * 32) && y < (256 * 32))
+                ride = get_ride(i);
+                if (ride->type == rideType)
                 {
-                    TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
-                    do
-                    {
-                        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-                            continue;
-
-                        ride_id_t rideIndex = tileElement->AsTrack()->GetRideIndex();
-                        ride = get_ride(rideIndex);
-                        if (ride->type == rideType)
-                        {
-                            rideConsideration[rideIndex >> 5] |= (1u << (rideIndex & 0x1F));
-                        }
-                    } while (!(tileElement++)->IsLastForTile());
+                    rideConsideration[i >> 5] |= (1u << (i & 0x1F));
                 }
             }
         }
@@ -3017,27 +2988,17 @@ static void peep_head_for_nearest_ride_with_flags(Guest* peep, int32_t rideTypeF
     else
     {
         // Take nearby rides into consideration
-        int32_t cx = floor2(peep->x, 32);
-        int32_t cy = floor2(peep->y, 32);
-        for (int32_t x = cx - 320; x <= cx + 320; x += 32)
+        int32_t cx = peep->x >> 5;
+        int32_t cy = peep->y >> 5;
+        auto nearbyRides = ride_spatial_index_get_rides_in_area(cx - 10, cy - 10, cx + 10, cy + 10);
+        for (int32_t i = 0; i < MAX_RIDES; i++)
         {
-            for (int32_t y = cy - 320; y <= cy + 320; y += 32)
+            if (nearbyRides[i])
             {
-                if (x >= 0 && y >= 0 && x < (256 * 32) && y < (256 * 32))
+                ride = get_ride(i);
+                if (ride_type_has_flag(ride->type, rideTypeFlags))
                 {
-                    TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
-                    do
-                    {
-                        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-                            continue;
-
-                        ride_id_t rideIndex = tileElement->AsTrack()->GetRideIndex();
-                        ride = get_ride(rideIndex);
-                        if (ride_type_has_flag(ride->type, rideTypeFlags))
-                        {
-                            rideConsideration[rideIndex >> 5] |= (1u << (rideIndex & 0x1F));
-                        }
-                    } while (!(tileElement++)->IsLastForTile());
+                    rideConsideration[i >> 5] |= (1u << (i & 0x1F));
                 }
             }
         }
@@ -0,0 +1,75 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GuestGroups.h"
+
+#include "../sprites.h"
+#include "Peep.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+/**
+ * Groups the guests in the park by the format arguments the given function returns for them, as shown by the
+ * summarised guest list. Guests whose arguments have no string are left out. Only the first maxGroups sets of arguments
+ * in guest order get a group, and the largest groups come first. Guests are only visited once, with the group of each
+ * set of arguments looked up in a hash map.
+ */
+std::vector<GuestGroup> guest_groups_find(GuestGroupArgumentsFunc getArguments, size_t maxGroups, size_t maxFaces)
+{
+    constexpr size_t NO_GROUP = SIZE_MAX;
+
+    std::vector<GuestGroup> groups;
+    std::unordered_map<uint64_t, size_t> groupIndices;
+
+    uint16_t spriteIndex;
+    Peep* peep;
+    FOR_ALL_GUESTS (spriteIndex, peep)
+    {
+        if (peep->outside_of_park != 0)
+            continue;
+
+        uint32_t argument1, argument2;
+        getArguments(peep, &argument1, &argument2);
+
+        size_t groupIndex;
+        uint64_t key = ((uint64_t)argument2 << 32) | argument1;
+        auto it = groupIndices.find(key);
+        if (it != groupIndices.end())
+        {
+            groupIndex = it->second;
+        }
+        else
+        {
+            groupIndex = NO_GROUP;
+            if ((argument1 & 0xFFFF) != 0 && groups.size() < maxGroups)
+            {
+                groupIndex = groups.size();
+                groups.push_back({ argument1, argument2, 0, {} });
+            }
+            groupIndices.emplace(key, groupIndex);
+        }
+
+        if (groupIndex == NO_GROUP)
+            continue;
+
+        GuestGroup& group = groups[groupIndex];
+        group.NumGuests++;
+        if (group.Faces.size() < maxFaces)
+        {
+            group.Faces.push_back(get_peep_face_sprite_small(peep) - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY);
+        }
+    }
+
+    // Groups of the same size stay in the order their first guests were found in
+    std::stable_sort(groups.begin(), groups.end(), [](const GuestGroup& a, const GuestGroup& b) {
+        return a.NumGuests > b.NumGuests;
+    });
+    return groups;
+}
@@ -0,0 +1,29 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <vector>
+
+struct Peep;
+
+struct GuestGroup
+{
+    uint32_t Argument1;
+    uint32_t Argument2;
+    int32_t NumGuests;
+    // Small face sprites of the first guests in the group, relative to SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY
+    std::vector<uint8_t> Faces;
+};
+
+using GuestGroupArgumentsFunc = void (*)(Peep* peep, uint32_t* argument_1, uint32_t* argument_2);
+
+std::vector<GuestGroup> guest_groups_find(GuestGroupArgumentsFunc getArguments, size_t maxGroups, size_t maxFaces);
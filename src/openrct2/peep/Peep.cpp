@@ -46,6 +46,7 @@
 #include "Staff.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <limits>
 
@@ -2062,6 +2063,27 @@ void peep_thought_set_format_args(rct_peep_thought* thought)
     }
 }
 
+/**
+ * Gets the format arguments of the guest's most recent thought as two uint32_ts, or zeroes if the guest has not had a
+ * thought recently.
+ */
+void get_arguments_from_thought(Peep* peep, uint32_t* argument_1, uint32_t* argument_2)
+{
+    rct_peep_thought* thought = &peep->thoughts[0];
+    if (thought->freshness <= 5 && thought->type != PEEP_THOUGHT_TYPE_NONE)
+    {
+        std::memset(gCommonFormatArgs, 0, sizeof(*argument_1) + sizeof(*argument_2));
+        peep_thought_set_format_args(thought);
+        std::memcpy(argument_1, gCommonFormatArgs, sizeof(*argument_1));
+        std::memcpy(argument_2, gCommonFormatArgs + sizeof(*argument_1), sizeof(*argument_2));
+    }
+    else
+    {
+        *argument_1 = 0;
+        *argument_2 = 0;
+    }
+}
+
 /** rct2: 0x00982004 */
 static constexpr const bool peep_allow_pick_up[] = {
     true,  // PEEP_STATE_FALLING
@@ -2491,10 +2513,7 @@ static void peep_interact_with_entrance(Peep* peep, int16_t x, int16_t y, TileEl
         peep->action_sprite_image_offset = _unk_F1AEF0;
         peep->interaction_ride_index = rideIndex;
 
-        uint16_t previous_last = ride->stations[stationNum].LastPeepInQueue;
-        ride->stations[stationNum].LastPeepInQueue = peep->sprite_index;
-        peep->next_in_queue = previous_last;
-        ride->stations[stationNum].QueueLength++;
+        ride_queue_add_guest(ride, stationNum, peep);
 
         peep->current_ride = rideIndex;
         peep->current_ride_station = stationNum;
@@ -2931,10 +2950,7 @@ static void peep_interact_with_path(Peep* peep, int16_t x, int16_t y, TileElemen
                     peep->interaction_ride_index = rideIndex;
 
                     // Add the peep to the ride queue.
-                    uint16_t old_last_peep = ride->stations[stationNum].LastPeepInQueue;
-                    ride->stations[stationNum].LastPeepInQueue = peep->sprite_index;
-                    peep->next_in_queue = old_last_peep;
-                    ride->stations[stationNum].QueueLength++;
+                    ride_queue_add_guest(ride, stationNum, peep);
 
                     peep_decrement_num_riders(peep);
                     peep->current_ride = rideIndex;
@@ -3295,7 +3311,7 @@ static bool peep_has_valid_xy(Peep* peep)
 {
     if (peep->x != LOCATION_NULL)
     {
-        if (peep->x < (256 * 32) && peep->y < (256 * 32))
+        if (peep->x < MAXIMUM_MAP_SIZE_BIG && peep->y < MAXIMUM_MAP_SIZE_BIG)
         {
             return true;
         }
@@ -3603,6 +3619,10 @@ void peep_update_name_sort(Peep* peep)
 finish_peep_sort:
     // This is required at the moment because this function reorders peeps in the sprite list
     sprite_position_tween_reset();
+    if (peep->type == PEEP_TYPE_STAFF)
+    {
+        staff_registry_invalidate();
+    }
 }
 
 void peep_sort()
@@ -3639,6 +3659,7 @@ void peep_sort()
     gSpriteListHead[SPRITE_LIST_PEEP] = peep_list[0];
 
     free(peep_list);
+    staff_registry_invalidate();
 
     i = 0;
     FOR_ALL_PEEPS (sprite_index, peep)
@@ -3914,32 +3935,7 @@ static void peep_release_balloon(Guest* peep, int16_t spawn_height)
 void Peep::RemoveFromQueue()
 {
     Ride* ride = get_ride(current_ride);
-
-    auto& station = ride->stations[current_ride_station];
-    // Make sure we don't underflow, building while paused might reset it to 0 where peeps have
-    // not yet left the queue.
-    if (station.QueueLength > 0)
-    {
-        station.QueueLength--;
-    }
-
-    if (sprite_index == station.LastPeepInQueue)
-    {
-        station.LastPeepInQueue = next_in_queue;
-        return;
-    }
-
-    auto spriteId = station.LastPeepInQueue;
-    while (spriteId != SPRITE_INDEX_NULL)
-    {
-        Peep* other_peep = GET_PEEP(spriteId);
-        if (sprite_index == other_peep->next_in_queue)
-        {
-            other_peep->next_in_queue = next_in_queue;
-            return;
-        }
-        spriteId = other_peep->next_in_queue;
-    }
+    ride_queue_remove_guest(ride, current_ride_station, this);
 }
 
 /**
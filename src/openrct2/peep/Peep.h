@@ -943,6 +943,7 @@ void peep_applause();
 Peep* peep_generate(int32_t x, int32_t y, int32_t z);
 void get_arguments_from_action(Peep* peep, uint32_t* argument_1, uint32_t* argument_2);
 void peep_thought_set_format_args(rct_peep_thought* thought);
+void get_arguments_from_thought(Peep* peep, uint32_t* argument_1, uint32_t* argument_2);
 int32_t get_peep_face_sprite_small(Peep* peep);
 int32_t get_peep_face_sprite_large(Peep* peep);
 int32_t peep_check_easteregg_name(int32_t index, Peep* peep);
@@ -39,7 +39,9 @@
 #include "Peep.h"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
+#include <vector>
 
 // clang-format off
 const rct_string_id StaffCostumeNames[] = {
@@ -66,6 +68,23 @@ colour_t gStaffHandymanColour;
 colour_t gStaffMechanicColour;
 colour_t gStaffSecurityColour;
 
+// Breakdown dispatch and inspections need the mechanics whose patrol covers a ride's exit, which used to mean walking every
+// peep in the park. Staff are instead kept in a registry per type, with the members that have a patrol area also listed
+// under each patrol quad they cover. Lists hold positions in the staff's sprite list order so that queries return staff in
+// the same order as iterating the sprite list. The registry is rebuilt on the next query after staff are hired, fired,
+// renamed or have their patrol edited.
+constexpr int32_t STAFF_PATROL_QUAD_COUNT = STAFF_PATROL_AREA_SIZE * 32;
+
+struct StaffTypeRegistry
+{
+    std::vector<uint16_t> Members;
+    std::vector<uint16_t> UnrestrictedMembers;
+    std::array<std::vector<uint16_t>, STAFF_PATROL_QUAD_COUNT> PatrolMembers;
+};
+
+static std::array<StaffTypeRegistry, STAFF_TYPE_COUNT> _staffRegistry;
+static bool _staffRegistryInvalidated = true;
+
 /**
  *
  *  rct2: 0x006BD3A4
@@ -345,6 +364,7 @@ static money32 staff_hire_new_staff_member(
         }
 
         *newPeep_sprite_index = newPeep->sprite_index;
+        staff_registry_invalidate();
     }
     return 0;
 }
@@ -495,6 +515,8 @@ void staff_update_greyed_patrol_areas()
 {
     Peep* peep;
 
+    staff_registry_invalidate();
+
     for (int32_t staff_type = 0; staff_type < STAFF_TYPE_COUNT; ++staff_type)
     {
         int32_t staffPatrolOffset = (staff_type + STAFF_MAX_COUNT) * STAFF_PATROL_AREA_SIZE;
@@ -520,6 +542,105 @@ void staff_update_greyed_patrol_areas()
     }
 }
 
+static int32_t staff_get_patrol_quad_index(int32_t x, int32_t y)
+{
+    return ((x & 0x1F80) >> 7) | ((y & 0x1F80) >> 1);
+}
+
+static void staff_registry_refresh()
+{
+    if (!_staffRegistryInvalidated)
+        return;
+
+    for (auto& registry : _staffRegistry)
+    {
+        registry.Members.clear();
+        registry.UnrestrictedMembers.clear();
+        for (auto& quad : registry.PatrolMembers)
+        {
+            quad.clear();
+        }
+    }
+
+    uint16_t spriteIndex;
+    Peep* peep;
+    FOR_ALL_STAFF (spriteIndex, peep)
+    {
+        if (peep->staff_type >= STAFF_TYPE_COUNT || peep->staff_id >= STAFF_MAX_COUNT)
+            continue;
+
+        auto& registry = _staffRegistry[peep->staff_type];
+        uint16_t ordinal = (uint16_t)registry.Members.size();
+        registry.Members.push_back(spriteIndex);
+
+        if (!(gStaffModes[peep->staff_id] & 2))
+        {
+            registry.UnrestrictedMembers.push_back(ordinal);
+            continue;
+        }
+
+        const uint32_t* patrolArea = &gStaffPatrolAreas[peep->staff_id * STAFF_PATROL_AREA_SIZE];
+        for (int32_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
+        {
+            for (uint32_t bits = patrolArea[i]; bits != 0; bits &= bits - 1)
+            {
+                int32_t bitIndex = bitscanforward((int32_t)bits);
+                registry.PatrolMembers[i * 32 + bitIndex].push_back(ordinal);
+            }
+        }
+    }
+    _staffRegistryInvalidated = false;
+}
+
+/**
+ * Marks the staff registry as needing to be rebuilt. Needs calling whenever staff are added to or removed from the peep
+ * sprite list, change position in it, or have their patrol area or mode changed.
+ */
+void staff_registry_invalidate()
+{
+    _staffRegistryInvalidated = true;
+}
+
+/**
+ * Gets the sprite indices of all staff of the given type, in sprite list order.
+ */
+std::vector<uint16_t> staff_registry_get_members(uint8_t staffType)
+{
+    if (staffType >= STAFF_TYPE_COUNT)
+        return {};
+
+    staff_registry_refresh();
+    return _staffRegistry[staffType].Members;
+}
+
+/**
+ * Gets the sprite indices of the staff of the given type for which staff_is_location_in_patrol would pass, in sprite list
+ * order.
+ */
+std::vector<uint16_t> staff_registry_get_members_in_patrol(uint8_t staffType, int32_t x, int32_t y)
+{
+    std::vector<uint16_t> result;
+    if (staffType >= STAFF_TYPE_COUNT || !map_is_location_owned_or_has_rights(x, y))
+        return result;
+
+    staff_registry_refresh();
+    const auto& registry = _staffRegistry[staffType];
+    const auto& unrestricted = registry.UnrestrictedMembers;
+    const auto& patrolling = registry.PatrolMembers[staff_get_patrol_quad_index(x, y)];
+
+    // Both lists are sorted by position in the sprite list, merge them to keep that order
+    std::vector<uint16_t> ordinals;
+    ordinals.reserve(unrestricted.size() + patrolling.size());
+    std::merge(unrestricted.begin(), unrestricted.end(), patrolling.begin(), patrolling.end(), std::back_inserter(ordinals));
+
+    result.reserve(ordinals.size());
+    for (uint16_t ordinal : ordinals)
+    {
+        result.push_back(registry.Members[ordinal]);
+    }
+    return result;
+}
+
 static bool staff_is_location_in_patrol_area(Peep* peep, int32_t x, int32_t y)
 {
     // Patrol quads are stored in a bit map (8 patrol quads per byte)
@@ -1594,6 +1715,7 @@ void Staff::UpdateMowing()
         if (surfaceElement != nullptr && surfaceElement->CanGrassGrow())
         {
             surfaceElement->SetGrassLength(GRASS_LENGTH_MOWED);
+            map_mark_tile_for_update(next_x, next_y);
             map_invalidate_tile_zoom0(next_x, next_y, surfaceElement->base_height * 8, surfaceElement->base_height * 8 + 16);
         }
         staff_lawns_mown++;
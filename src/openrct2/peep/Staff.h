@@ -13,6 +13,8 @@
 #include "../common.h"
 #include "Peep.h"
 
+#include <vector>
+
 #define STAFF_MAX_COUNT 200
 // The number of elements in the gStaffPatrolAreas array per staff member. Every bit in the array represents a 4x4 square.
 // Right now, it's a 32-bit array like in RCT2. 32 * 128 = 4096 bits, which is also the number of 4x4 squares on a 256x256 map.
@@ -88,6 +90,9 @@ void staff_reset_modes();
 void staff_set_name(uint16_t spriteIndex, const char* name);
 uint16_t hire_new_staff_member(uint8_t staffType);
 void staff_update_greyed_patrol_areas();
+void staff_registry_invalidate();
+std::vector<uint16_t> staff_registry_get_members(uint8_t staffType);
+std::vector<uint16_t> staff_registry_get_members_in_patrol(uint8_t staffType, int32_t x, int32_t y);
 bool staff_is_location_in_patrol(Peep* mechanic, int32_t x, int32_t y);
 bool staff_is_location_on_patrol_edge(Peep* mechanic, int32_t x, int32_t y);
 bool staff_can_ignore_wide_flag(Peep* mechanic, int32_t x, int32_t y, uint8_t z, TileElement* path);
@@ -1373,6 +1373,7 @@ private:
         {
             FixPeepNextInQueue(peep, spriteIndexMap);
         }
+        ride_queue_invalidate_all();
 
         // Fix the news items in advance
         for (i = 0; i < MAX_NEWS_ITEMS; i++)
@@ -2684,7 +2685,7 @@ private:
     void ClearExtraTileEntries()
     {
         // Reset the map tile pointers
-        std::fill(std::begin(gTileElementTilePointers), std::end(gTileElementTilePointers), nullptr);
+        std::fill_n(gTileElementTilePointers, MAX_TILE_TILE_ELEMENT_POINTERS, nullptr);
 
         // Get the first free map element
         TileElement* nextFreeTileElement = gTileElements;
@@ -2736,6 +2737,8 @@ private:
         }
 
         gNextFreeTileElement = nextFreeTileElement;
+        gTileElementChunks->clear();
+        map_storage_changed();
     }
 
     void FixWalls()
@@ -44,6 +44,7 @@
 #include "../world/MapAnimation.h"
 #include "../world/Park.h"
 #include "../world/Sprite.h"
+#include "../world/TileElementAllocator.h"
 
 #include <algorithm>
 #include <cstring>
@@ -193,6 +194,17 @@ void S6Exporter::Export()
     _s6.scenario_srand_0 = state.s0;
     _s6.scenario_srand_1 = state.s1;
 
+    // Only the elements in the park's own array fit in the file, which they all do after reorganising unless the park
+    // has more of them than the format allows
+    if (!tile_element_allocator_fits_legacy_storage())
+    {
+        map_reorganise_elements();
+        if (!tile_element_allocator_fits_legacy_storage())
+        {
+            log_error("The park has more than %d map elements, which is the most a saved park can have.", MAX_TILE_ELEMENTS);
+            throw std::runtime_error("Too many map elements to save park.");
+        }
+    }
     std::memcpy(_s6.tile_elements, gTileElements, sizeof(_s6.tile_elements));
 
     _s6.next_free_tile_element_pointer_index = gNextFreeTileElementPointerIndex;
@@ -362,7 +374,8 @@ void S6Exporter::Export()
     _s6.ride_ratings_calc_data = gRideRatingsCalcData;
     std::memcpy(_s6.ride_measurements, gRideMeasurements, sizeof(_s6.ride_measurements));
     _s6.next_guest_index = gNextGuestNumber;
-    _s6.grass_and_scenery_tilepos = gGrassSceneryTileLoopPosition;
+    // The format only holds 16 bits, which covers every position of a 256x256 map
+    _s6.grass_and_scenery_tilepos = (uint16_t)gGrassSceneryTileLoopPosition;
     std::memcpy(_s6.patrol_areas, gStaffPatrolAreas, sizeof(_s6.patrol_areas));
     std::memcpy(_s6.staff_modes, gStaffModes, sizeof(_s6.staff_modes));
     // unk_13CA73E
@@ -400,6 +400,7 @@ public:
         gGrassSceneryTileLoopPosition = _s6.grass_and_scenery_tilepos;
         std::memcpy(gStaffPatrolAreas, _s6.patrol_areas, sizeof(_s6.patrol_areas));
         std::memcpy(gStaffModes, _s6.staff_modes, sizeof(_s6.staff_modes));
+        staff_registry_invalidate();
         // unk_13CA73E
         // pad_13CA73F
         gUnk13CA740 = _s6.byte_13CA740;
@@ -495,6 +496,7 @@ public:
                 ImportRide(dst, src, index);
             }
         }
+        ride_queue_invalidate_all();
     }
 
     void ImportRide(Ride* dst, const rct2_ride* src, const ride_id_t rideIndex)
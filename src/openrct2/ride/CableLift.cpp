@@ -19,10 +19,10 @@
 
 #include <algorithm>
 
-static void cable_lift_update_moving_to_end_of_station(rct_vehicle* vehicle);
-static void cable_lift_update_waiting_to_depart(rct_vehicle* vehicle);
+static void cable_lift_update_moving_to_end_of_station(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void cable_lift_update_waiting_to_depart(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void cable_lift_update_departing(rct_vehicle* vehicle);
-static void cable_lift_update_travelling(rct_vehicle* vehicle);
+static void cable_lift_update_travelling(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void cable_lift_update_arriving(rct_vehicle* vehicle);
 
 rct_vehicle* cable_lift_segment_create(
@@ -91,24 +91,24 @@ rct_vehicle* cable_lift_segment_create(
     return current;
 }
 
-void cable_lift_update(rct_vehicle* vehicle)
+void cable_lift_update(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     switch (vehicle->status)
     {
         case VEHICLE_STATUS_MOVING_TO_END_OF_STATION:
-            cable_lift_update_moving_to_end_of_station(vehicle);
+            cable_lift_update_moving_to_end_of_station(state, vehicle);
             break;
         case VEHICLE_STATUS_WAITING_FOR_PASSENGERS:
             // Stays in this state until a train puts it into next state
             break;
         case VEHICLE_STATUS_WAITING_TO_DEPART:
-            cable_lift_update_waiting_to_depart(vehicle);
+            cable_lift_update_waiting_to_depart(state, vehicle);
             break;
         case VEHICLE_STATUS_DEPARTING:
             cable_lift_update_departing(vehicle);
             break;
         case VEHICLE_STATUS_TRAVELLING:
-            cable_lift_update_travelling(vehicle);
+            cable_lift_update_travelling(state, vehicle);
             break;
         case VEHICLE_STATUS_ARRIVING:
             cable_lift_update_arriving(vehicle);
@@ -120,7 +120,7 @@ void cable_lift_update(rct_vehicle* vehicle)
  *
  *  rct2: 0x006DF8A4
  */
-static void cable_lift_update_moving_to_end_of_station(rct_vehicle* vehicle)
+static void cable_lift_update_moving_to_end_of_station(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     if (vehicle->velocity >= -439800)
         vehicle->acceleration = -2932;
@@ -131,7 +131,7 @@ static void cable_lift_update_moving_to_end_of_station(rct_vehicle* vehicle)
         vehicle->acceleration = 0;
     }
 
-    if (!(cable_lift_update_track_motion(vehicle) & (1 << 0)))
+    if (!(cable_lift_update_track_motion(state, vehicle) & (1 << 0)))
         return;
 
     vehicle->velocity = 0;
@@ -143,7 +143,7 @@ static void cable_lift_update_moving_to_end_of_station(rct_vehicle* vehicle)
  *
  *  rct2: 0x006DF8F1
  */
-static void cable_lift_update_waiting_to_depart(rct_vehicle* vehicle)
+static void cable_lift_update_waiting_to_depart(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     if (vehicle->velocity >= -58640)
         vehicle->acceleration = -14660;
@@ -154,7 +154,7 @@ static void cable_lift_update_waiting_to_depart(rct_vehicle* vehicle)
         vehicle->acceleration = 0;
     }
 
-    cable_lift_update_track_motion(vehicle);
+    cable_lift_update_track_motion(state, vehicle);
 
     // Next check to see if the second part of the cable lift
     // is at the front of the passenger vehicle to simulate the
@@ -193,7 +193,7 @@ static void cable_lift_update_departing(rct_vehicle* vehicle)
  *
  *  rct2: 0x006DF99C
  */
-static void cable_lift_update_travelling(rct_vehicle* vehicle)
+static void cable_lift_update_travelling(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     rct_vehicle* passengerVehicle = GET_VEHICLE(vehicle->cable_lift_target);
 
@@ -202,7 +202,7 @@ static void cable_lift_update_travelling(rct_vehicle* vehicle)
     if (passengerVehicle->update_flags & VEHICLE_UPDATE_FLAG_BROKEN_TRAIN)
         return;
 
-    if (!(cable_lift_update_track_motion(vehicle) & (1 << 1)))
+    if (!(cable_lift_update_track_motion(state, vehicle) & (1 << 1)))
         return;
 
     vehicle->velocity = 0;
@@ -222,15 +222,15 @@ static void cable_lift_update_arriving(rct_vehicle* vehicle)
         vehicle->status = VEHICLE_STATUS_MOVING_TO_END_OF_STATION;
 }
 
-static bool sub_6DF01A_loop(rct_vehicle* vehicle)
+static bool sub_6DF01A_loop(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     Ride* ride = get_ride(vehicle->ride);
-    for (; vehicle->remaining_distance >= 13962; _vehicleUnkF64E10++)
+    for (; vehicle->remaining_distance >= 13962; state.UnkF64E10++)
     {
         uint8_t trackType = vehicle->track_type >> 2;
         if (trackType == TRACK_ELEM_CABLE_LIFT_HILL && vehicle->track_progress == 160)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
+            state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
         }
 
         uint16_t trackProgress = vehicle->track_progress + 1;
@@ -239,8 +239,8 @@ static bool sub_6DF01A_loop(rct_vehicle* vehicle)
         uint16_t trackTotalProgress = vehicle_get_move_info_size(vehicle->var_CD, vehicle->track_type);
         if (trackProgress >= trackTotalProgress)
         {
-            _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
-            _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_end;
+            state.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
+            state.BankEndF64E37 = TrackDefinitions[trackType].bank_end;
             TileElement* trackElement = map_get_track_element_at_of_type_seq(
                 vehicle->track_x, vehicle->track_y, vehicle->track_z / 8, trackType, 0);
 
@@ -256,8 +256,8 @@ static bool sub_6DF01A_loop(rct_vehicle* vehicle)
             if (!track_block_get_next(&input, &output, &outputZ, &outputDirection))
                 return false;
 
-            if (TrackDefinitions[output.element->AsTrack()->GetTrackType()].vangle_start != _vehicleVAngleEndF64E36
-                || TrackDefinitions[output.element->AsTrack()->GetTrackType()].bank_start != _vehicleBankEndF64E37)
+            if (TrackDefinitions[output.element->AsTrack()->GetTrackType()].vangle_start != state.VAngleEndF64E36
+                || TrackDefinitions[output.element->AsTrack()->GetTrackType()].bank_start != state.BankEndF64E37)
                 return false;
 
             vehicle->track_x = output.x;
@@ -278,17 +278,17 @@ static bool sub_6DF01A_loop(rct_vehicle* vehicle)
 
         uint8_t bx = 0;
         unk.z += RideData5[ride->type].z_offset;
-        if (unk.x != unk_F64E20.x)
+        if (unk.x != state.UnkF64E20.x)
             bx |= (1 << 0);
-        if (unk.y != unk_F64E20.y)
+        if (unk.y != state.UnkF64E20.y)
             bx |= (1 << 1);
-        if (unk.z != unk_F64E20.z)
+        if (unk.z != state.UnkF64E20.z)
             bx |= (1 << 2);
 
         vehicle->remaining_distance -= dword_9A2930[bx];
-        unk_F64E20.x = unk.x;
-        unk_F64E20.y = unk.y;
-        unk_F64E20.z = unk.z;
+        state.UnkF64E20.x = unk.x;
+        state.UnkF64E20.y = unk.y;
+        state.UnkF64E20.z = unk.z;
 
         vehicle->sprite_direction = moveInfo->direction;
         vehicle->bank_rotation = moveInfo->bank_rotation;
@@ -302,10 +302,10 @@ static bool sub_6DF01A_loop(rct_vehicle* vehicle)
     return true;
 }
 
-static bool sub_6DF21B_loop(rct_vehicle* vehicle)
+static bool sub_6DF21B_loop(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     Ride* ride = get_ride(vehicle->ride);
-    for (; vehicle->remaining_distance < 0; _vehicleUnkF64E10++)
+    for (; vehicle->remaining_distance < 0; state.UnkF64E10++)
     {
         uint16_t trackProgress = vehicle->track_progress - 1;
         const rct_vehicle_info* moveInfo;
@@ -313,8 +313,8 @@ static bool sub_6DF21B_loop(rct_vehicle* vehicle)
         if ((int16_t)trackProgress == -1)
         {
             uint8_t trackType = vehicle->track_type >> 2;
-            _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_start;
-            _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_start;
+            state.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_start;
+            state.BankEndF64E37 = TrackDefinitions[trackType].bank_start;
 
             TileElement* trackElement = map_get_track_element_at_of_type_seq(
                 vehicle->track_x, vehicle->track_y, vehicle->track_z / 8, trackType, 0);
@@ -329,8 +329,8 @@ static bool sub_6DF21B_loop(rct_vehicle* vehicle)
             if (!track_block_get_previous(input.x, input.y, input.element, &output))
                 return false;
 
-            if (TrackDefinitions[output.begin_element->AsTrack()->GetTrackType()].vangle_end != _vehicleVAngleEndF64E36
-                || TrackDefinitions[output.begin_element->AsTrack()->GetTrackType()].bank_end != _vehicleBankEndF64E37)
+            if (TrackDefinitions[output.begin_element->AsTrack()->GetTrackType()].vangle_end != state.VAngleEndF64E36
+                || TrackDefinitions[output.begin_element->AsTrack()->GetTrackType()].bank_end != state.BankEndF64E37)
                 return false;
 
             vehicle->track_x = output.begin_x;
@@ -341,7 +341,7 @@ static bool sub_6DF21B_loop(rct_vehicle* vehicle)
 
             if (output.begin_element->AsTrack()->GetTrackType() == TRACK_ELEM_END_STATION)
             {
-                _vehicleMotionTrackFlags = VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+                state.MotionTrackFlags = VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
             }
 
             moveInfo = vehicle_get_move_info(vehicle->var_CD, vehicle->track_type, 0);
@@ -359,17 +359,17 @@ static bool sub_6DF21B_loop(rct_vehicle* vehicle)
 
         uint8_t bx = 0;
         unk.z += RideData5[ride->type].z_offset;
-        if (unk.x != unk_F64E20.x)
+        if (unk.x != state.UnkF64E20.x)
             bx |= (1 << 0);
-        if (unk.y != unk_F64E20.y)
+        if (unk.y != state.UnkF64E20.y)
             bx |= (1 << 1);
-        if (unk.z != unk_F64E20.z)
+        if (unk.z != state.UnkF64E20.z)
             bx |= (1 << 2);
 
         vehicle->remaining_distance += dword_9A2930[bx];
-        unk_F64E20.x = unk.x;
-        unk_F64E20.y = unk.y;
-        unk_F64E20.z = unk.z;
+        state.UnkF64E20.x = unk.x;
+        state.UnkF64E20.y = unk.y;
+        state.UnkF64E20.z = unk.z;
 
         vehicle->sprite_direction = moveInfo->direction;
         vehicle->bank_rotation = moveInfo->bank_rotation;
@@ -383,20 +383,26 @@ static bool sub_6DF21B_loop(rct_vehicle* vehicle)
     return true;
 }
 
+int32_t cable_lift_update_track_motion(rct_vehicle* cableLift)
+{
+    VehicleUpdateState state;
+    return cable_lift_update_track_motion(state, cableLift);
+}
+
 /**
  *
  *  rct2: 0x006DEF56
  */
-int32_t cable_lift_update_track_motion(rct_vehicle* cableLift)
+int32_t cable_lift_update_track_motion(VehicleUpdateState& state, rct_vehicle* cableLift)
 {
-    _vehicleF64E2C = 0;
-    gCurrentVehicle = cableLift;
-    _vehicleMotionTrackFlags = 0;
-    _vehicleStationIndex = 0xFF;
+    state.F64E2C = 0;
+    state.CurrentVehicle = cableLift;
+    state.MotionTrackFlags = 0;
+    state.StationIndex = 0xFF;
 
     cableLift->velocity += cableLift->acceleration;
-    _vehicleVelocityF64E08 = cableLift->velocity;
-    _vehicleVelocityF64E0C = (cableLift->velocity / 1024) * 42;
+    state.VelocityF64E08 = cableLift->velocity;
+    state.VelocityF64E0C = (cableLift->velocity / 1024) * 42;
 
     rct_vehicle* frontVehicle = cableLift;
     if (cableLift->velocity < 0)
@@ -404,61 +410,61 @@ int32_t cable_lift_update_track_motion(rct_vehicle* cableLift)
         frontVehicle = vehicle_get_tail(cableLift);
     }
 
-    _vehicleFrontVehicle = frontVehicle;
+    state.FrontVehicle = frontVehicle;
 
     for (rct_vehicle* vehicle = frontVehicle;;)
     {
         vehicle->acceleration = dword_9A2970[vehicle->vehicle_sprite_type];
-        _vehicleUnkF64E10 = 1;
-        vehicle->remaining_distance += _vehicleVelocityF64E0C;
+        state.UnkF64E10 = 1;
+        vehicle->remaining_distance += state.VelocityF64E0C;
 
         if (vehicle->remaining_distance < 0 || vehicle->remaining_distance >= 13962)
         {
-            unk_F64E20.x = vehicle->x;
-            unk_F64E20.y = vehicle->y;
-            unk_F64E20.z = vehicle->z;
+            state.UnkF64E20.x = vehicle->x;
+            state.UnkF64E20.y = vehicle->y;
+            state.UnkF64E20.z = vehicle->z;
             invalidate_sprite_2((rct_sprite*)vehicle);
 
             while (true)
             {
                 if (vehicle->remaining_distance < 0)
                 {
-                    if (sub_6DF21B_loop(vehicle) == true)
+                    if (sub_6DF21B_loop(state, vehicle) == true)
                     {
                         break;
                     }
                     else
                     {
-                        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                        _vehicleVelocityF64E0C -= vehicle->remaining_distance - 13962;
+                        state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                        state.VelocityF64E0C -= vehicle->remaining_distance - 13962;
                         vehicle->remaining_distance = 13962;
                         vehicle->acceleration += dword_9A2970[vehicle->vehicle_sprite_type];
-                        _vehicleUnkF64E10++;
+                        state.UnkF64E10++;
                         continue;
                     }
                 }
                 else
                 {
-                    if (sub_6DF01A_loop(vehicle) == true)
+                    if (sub_6DF01A_loop(state, vehicle) == true)
                     {
                         break;
                     }
                     else
                     {
-                        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                        _vehicleVelocityF64E0C -= vehicle->remaining_distance + 1;
+                        state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                        state.VelocityF64E0C -= vehicle->remaining_distance + 1;
                         vehicle->remaining_distance = -1;
                         vehicle->acceleration += dword_9A2970[vehicle->vehicle_sprite_type];
-                        _vehicleUnkF64E10++;
+                        state.UnkF64E10++;
                     }
                 }
             }
-            sprite_move(unk_F64E20.x, unk_F64E20.y, unk_F64E20.z, (rct_sprite*)vehicle);
+            sprite_move(state.UnkF64E20.x, state.UnkF64E20.y, state.UnkF64E20.z, (rct_sprite*)vehicle);
 
             invalidate_sprite_2((rct_sprite*)vehicle);
         }
-        vehicle->acceleration /= _vehicleUnkF64E10;
-        if (_vehicleVelocityF64E08 >= 0)
+        vehicle->acceleration /= state.UnkF64E10;
+        if (state.VelocityF64E08 >= 0)
         {
             if (vehicle->next_vehicle_on_train == SPRITE_INDEX_NULL)
                 break;
@@ -500,5 +506,5 @@ int32_t cable_lift_update_track_motion(rct_vehicle* cableLift)
     newAcceleration -= edx / massTotal;
 
     cableLift->acceleration = newAcceleration;
-    return _vehicleMotionTrackFlags;
+    return state.MotionTrackFlags;
 }
@@ -16,7 +16,8 @@
 rct_vehicle* cable_lift_segment_create(
     ride_id_t rideIndex, int32_t x, int32_t y, int32_t z, int32_t direction, uint16_t var_44, int32_t remaining_distance,
     bool head);
-void cable_lift_update(rct_vehicle* vehicle);
+void cable_lift_update(VehicleUpdateState& state, rct_vehicle* vehicle);
 int32_t cable_lift_update_track_motion(rct_vehicle* cableLift);
+int32_t cable_lift_update_track_motion(VehicleUpdateState& state, rct_vehicle* cableLift);
 
 #endif
@@ -24,6 +24,8 @@
 #include "../common.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/Json.hpp"
+#include "../core/String.hpp"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
@@ -362,30 +364,114 @@ int32_t ride_get_max_queue_time(Ride* ride)
     return (int32_t)queueTime;
 }
 
-Peep* ride_get_queue_head_guest(Ride* ride, int32_t stationIndex)
+// Guests queuing at a station are linked from the back of the queue through next_in_queue, which is what gets saved.
+// Finding the guest at the front, or the guest behind a given one, used to mean walking the whole queue, which happened
+// every time a guest left a queue. The reverse links, the guest at the front and the number of linked guests are kept
+// alongside the saved links, and are rebuilt from them after a park is loaded or a queue is reset.
+constexpr uint16_t RIDE_QUEUE_STATION_NONE = 0xFFFF;
+
+struct RideQueueState
 {
-    Peep* peep;
-    Peep* result = nullptr;
+    uint16_t Front = SPRITE_INDEX_NULL;
+    uint16_t Length = 0;
+};
+
+static RideQueueState _rideQueues[MAX_RIDES][MAX_STATIONS];
+static uint16_t _rideQueueGuestBehind[MAX_SPRITES];
+static uint16_t _rideQueueGuestStation[MAX_SPRITES];
+static bool _rideQueuesInvalidated = true;
+
+static uint16_t ride_queue_get_station_key(const Ride* ride, int32_t stationIndex)
+{
+    return (uint16_t)(ride->id * MAX_STATIONS + stationIndex);
+}
+
+static bool ride_queue_is_guest_in_station(uint16_t spriteIndex, uint16_t stationKey)
+{
+    return spriteIndex < MAX_SPRITES && _rideQueueGuestStation[spriteIndex] == stationKey;
+}
+
+static void ride_queue_rebuild_station(Ride* ride, int32_t stationIndex)
+{
+    auto& queue = _rideQueues[ride->id][stationIndex];
+    queue = {};
+
+    uint16_t stationKey = ride_queue_get_station_key(ride, stationIndex);
+    uint16_t behindIndex = SPRITE_INDEX_NULL;
     uint16_t spriteIndex = ride->stations[stationIndex].LastPeepInQueue;
+    Peep* peep;
     while ((peep = try_get_guest(spriteIndex)) != nullptr)
     {
+        // Stop at a corrupt queue that links back into itself
+        if (_rideQueueGuestStation[spriteIndex] == stationKey)
+            break;
+
+        _rideQueueGuestBehind[spriteIndex] = behindIndex;
+        _rideQueueGuestStation[spriteIndex] = stationKey;
+        queue.Front = spriteIndex;
+        queue.Length++;
+
+        behindIndex = spriteIndex;
         spriteIndex = peep->next_in_queue;
-        result = peep;
     }
-    return result;
 }
 
-static void ride_update_queue_length(Ride* ride, int32_t stationIndex)
+static void ride_queue_refresh()
 {
-    uint16_t count = 0;
-    Peep* peep;
-    uint16_t spriteIndex = ride->stations[stationIndex].LastPeepInQueue;
-    while ((peep = try_get_guest(spriteIndex)) != nullptr)
+    if (!_rideQueuesInvalidated)
+        return;
+
+    std::fill(std::begin(_rideQueueGuestBehind), std::end(_rideQueueGuestBehind), SPRITE_INDEX_NULL);
+    std::fill(std::begin(_rideQueueGuestStation), std::end(_rideQueueGuestStation), RIDE_QUEUE_STATION_NONE);
+    for (int32_t i = 0; i < MAX_RIDES; i++)
     {
-        spriteIndex = peep->next_in_queue;
-        count++;
+        auto ride = get_ride(i);
+        for (int32_t stationIndex = 0; stationIndex < MAX_STATIONS; stationIndex++)
+        {
+            ride_queue_rebuild_station(ride, stationIndex);
+        }
+    }
+    _rideQueuesInvalidated = false;
+}
+
+/**
+ * Removes the guest from the reverse links, given the guest that was behind it in the queue.
+ */
+static void ride_queue_unlink_guest(RideQueueState& queue, uint16_t stationKey, Peep* peep, uint16_t behindIndex)
+{
+    if (queue.Front == peep->sprite_index)
+    {
+        queue.Front = behindIndex;
+    }
+    else if (ride_queue_is_guest_in_station(peep->next_in_queue, stationKey))
+    {
+        _rideQueueGuestBehind[peep->next_in_queue] = behindIndex;
+    }
+    else
+    {
+        _rideQueuesInvalidated = true;
+    }
+
+    _rideQueueGuestBehind[peep->sprite_index] = SPRITE_INDEX_NULL;
+    _rideQueueGuestStation[peep->sprite_index] = RIDE_QUEUE_STATION_NONE;
+    if (queue.Length > 0)
+    {
+        queue.Length--;
     }
-    ride->stations[stationIndex].QueueLength = count;
+}
+
+/**
+ * Marks the queue state as needing to be rebuilt from the saved next_in_queue links.
+ */
+void ride_queue_invalidate_all()
+{
+    _rideQueuesInvalidated = true;
+}
+
+Peep* ride_get_queue_head_guest(Ride* ride, int32_t stationIndex)
+{
+    ride_queue_refresh();
+    return try_get_guest(_rideQueues[ride->id][stationIndex].Front);
 }
 
 void ride_queue_insert_guest_at_front(Ride* ride, int32_t stationIndex, Peep* peep)
@@ -396,15 +482,128 @@ void ride_queue_insert_guest_at_front(Ride* ride, int32_t stationIndex, Peep* pe
 
     peep->next_in_queue = SPRITE_INDEX_NULL;
     Peep* queueHeadGuest = ride_get_queue_head_guest(ride, peep->current_ride_station);
+    auto& queue = _rideQueues[ride->id][peep->current_ride_station];
+    uint16_t behindIndex = SPRITE_INDEX_NULL;
     if (queueHeadGuest == nullptr)
     {
         ride->stations[peep->current_ride_station].LastPeepInQueue = peep->sprite_index;
+        if (queue.Length != 0)
+        {
+            _rideQueuesInvalidated = true;
+            queue.Length = 0;
+        }
     }
     else
     {
         queueHeadGuest->next_in_queue = peep->sprite_index;
+        behindIndex = queueHeadGuest->sprite_index;
+    }
+
+    _rideQueueGuestBehind[peep->sprite_index] = behindIndex;
+    _rideQueueGuestStation[peep->sprite_index] = ride_queue_get_station_key(ride, peep->current_ride_station);
+    queue.Front = peep->sprite_index;
+    queue.Length++;
+    ride->stations[peep->current_ride_station].QueueLength = queue.Length;
+}
+
+/**
+ * Adds the guest to the back of the station's queue.
+ */
+void ride_queue_add_guest(Ride* ride, int32_t stationIndex, Peep* peep)
+{
+    ride_queue_refresh();
+
+    auto& station = ride->stations[stationIndex];
+    auto& queue = _rideQueues[ride->id][stationIndex];
+    uint16_t stationKey = ride_queue_get_station_key(ride, stationIndex);
+    uint16_t previousLast = station.LastPeepInQueue;
+    station.LastPeepInQueue = peep->sprite_index;
+    peep->next_in_queue = previousLast;
+    station.QueueLength++;
+
+    if (ride_queue_is_guest_in_station(previousLast, stationKey))
+    {
+        _rideQueueGuestBehind[previousLast] = peep->sprite_index;
+    }
+    else if (previousLast == SPRITE_INDEX_NULL)
+    {
+        queue.Front = peep->sprite_index;
+    }
+    else
+    {
+        _rideQueuesInvalidated = true;
+    }
+
+    _rideQueueGuestBehind[peep->sprite_index] = SPRITE_INDEX_NULL;
+    _rideQueueGuestStation[peep->sprite_index] = stationKey;
+    queue.Length++;
+}
+
+/**
+ * Removes the guest from the station's queue, linking the guest behind it to the guest in front of it.
+ */
+void ride_queue_remove_guest(Ride* ride, int32_t stationIndex, Peep* peep)
+{
+    ride_queue_refresh();
+
+    auto& station = ride->stations[stationIndex];
+    auto& queue = _rideQueues[ride->id][stationIndex];
+    uint16_t stationKey = ride_queue_get_station_key(ride, stationIndex);
+
+    // Make sure we don't underflow, building while paused might reset it to 0 where peeps have
+    // not yet left the queue.
+    if (station.QueueLength > 0)
+    {
+        station.QueueLength--;
+    }
+
+    bool inQueue = ride_queue_is_guest_in_station(peep->sprite_index, stationKey);
+    if (peep->sprite_index == station.LastPeepInQueue)
+    {
+        station.LastPeepInQueue = peep->next_in_queue;
+        if (inQueue)
+        {
+            ride_queue_unlink_guest(queue, stationKey, peep, SPRITE_INDEX_NULL);
+        }
+        else
+        {
+            _rideQueuesInvalidated = true;
+        }
+        return;
+    }
+
+    uint16_t behindIndex = inQueue ? _rideQueueGuestBehind[peep->sprite_index] : SPRITE_INDEX_NULL;
+    Peep* behindPeep = try_get_guest(behindIndex);
+    if (behindPeep == nullptr || behindPeep->next_in_queue != peep->sprite_index)
+    {
+        // The reverse links are missing or out of date, fall back to searching the queue and rebuild them on the next query
+        _rideQueuesInvalidated = true;
+        auto spriteId = station.LastPeepInQueue;
+        while (spriteId != SPRITE_INDEX_NULL)
+        {
+            Peep* otherPeep = GET_PEEP(spriteId);
+            if (otherPeep->next_in_queue == peep->sprite_index)
+            {
+                otherPeep->next_in_queue = peep->next_in_queue;
+                return;
+            }
+            spriteId = otherPeep->next_in_queue;
+        }
+        return;
     }
-    ride_update_queue_length(ride, peep->current_ride_station);
+
+    behindPeep->next_in_queue = peep->next_in_queue;
+    ride_queue_unlink_guest(queue, stationKey, peep, behindIndex);
+}
+
+/**
+ * Empties the station's queue without updating the guests that were in it.
+ */
+void ride_queue_clear(Ride* ride, int32_t stationIndex)
+{
+    ride->stations[stationIndex].QueueLength = 0;
+    ride->stations[stationIndex].LastPeepInQueue = SPRITE_INDEX_NULL;
+    _rideQueuesInvalidated = true;
 }
 
 /**
@@ -606,44 +805,20 @@ bool track_block_get_next(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32
     ride_id_t rideIndex = input->element->AsTrack()->GetRideIndex();
     Ride* ride = get_ride(rideIndex);
 
-    const rct_preview_track* trackBlock = get_track_def_from_ride(ride, input->element->AsTrack()->GetTrackType());
+    int32_t trackType = input->element->AsTrack()->GetTrackType();
+    const rct_preview_track* trackBlock = get_track_def_from_ride(ride, trackType);
     uint8_t sequence = input->element->AsTrack()->GetSequenceIndex();
     trackBlock += sequence;
 
-    const rct_track_coordinates* trackCoordinate = get_track_coord_from_ride(ride, input->element->AsTrack()->GetTrackType());
-
-    int32_t x = input->x;
-    int32_t y = input->y;
-    int32_t OriginZ = input->element->base_height * 8;
+    const rct_track_coordinates* trackCoordinate = get_track_coord_from_ride(ride, trackType);
 
     uint8_t rotation = input->element->GetDirection();
-    switch (rotation)
-    {
-        case 0:
-            x += trackCoordinate->x;
-            x -= trackBlock->x;
-            y += trackCoordinate->y;
-            y -= trackBlock->y;
-            break;
-        case 1:
-            x += trackCoordinate->y;
-            x -= trackBlock->y;
-            y -= trackCoordinate->x;
-            y += trackBlock->x;
-            break;
-        case 2:
-            x -= trackCoordinate->x;
-            x += trackBlock->x;
-            y -= trackCoordinate->y;
-            y += trackBlock->y;
-            break;
-        case 3:
-            x -= trackCoordinate->y;
-            x += trackBlock->y;
-            y += trackCoordinate->x;
-            y -= trackBlock->x;
-            break;
-    }
+    CoordsXY blockOffset = get_track_block_offset_from_ride(ride, trackType, sequence, rotation);
+    CoordsXY coordOffset = get_track_coord_offset_from_ride(ride, trackType, rotation);
+
+    int32_t x = input->x + coordOffset.x - blockOffset.x;
+    int32_t y = input->y + coordOffset.y - blockOffset.y;
+    int32_t OriginZ = input->element->base_height * 8;
 
     OriginZ -= trackBlock->z;
     OriginZ += trackCoordinate->z_end;
@@ -713,29 +888,12 @@ bool track_block_get_previous_from_zero(
         nextRotation = tileElement->GetDirectionWithOffset(nextTrackCoordinate->rotation_begin)
             | (nextTrackCoordinate->rotation_begin & (1 << 2));
         outTrackBeginEnd->begin_element = tileElement;
-        outTrackBeginEnd->begin_x = x;
-        outTrackBeginEnd->begin_y = y;
+        CoordsXY nextCoordOffset = get_track_coord_offset_from_ride(
+            ride, tileElement->AsTrack()->GetTrackType(), nextRotation);
+        outTrackBeginEnd->begin_x = x - nextCoordOffset.x;
+        outTrackBeginEnd->begin_y = y - nextCoordOffset.y;
         outTrackBeginEnd->end_x = x;
         outTrackBeginEnd->end_y = y;
-        switch (nextRotation & 3)
-        {
-            case 0:
-                outTrackBeginEnd->begin_x -= nextTrackCoordinate->x;
-                outTrackBeginEnd->begin_y -= nextTrackCoordinate->y;
-                break;
-            case 1:
-                outTrackBeginEnd->begin_x -= nextTrackCoordinate->y;
-                outTrackBeginEnd->begin_y += nextTrackCoordinate->x;
-                break;
-            case 2:
-                outTrackBeginEnd->begin_x += nextTrackCoordinate->x;
-                outTrackBeginEnd->begin_y += nextTrackCoordinate->y;
-                break;
-            case 3:
-                outTrackBeginEnd->begin_x += nextTrackCoordinate->y;
-                outTrackBeginEnd->begin_y -= nextTrackCoordinate->x;
-                break;
-        }
 
         outTrackBeginEnd->begin_z = tileElement->base_height * 8;
         outTrackBeginEnd->begin_z += get_track_def_from_ride(ride, tileElement->AsTrack()->GetTrackType())->z
@@ -767,34 +925,19 @@ bool track_block_get_previous(int32_t x, int32_t y, TileElement* tileElement, tr
     ride_id_t rideIndex = tileElement->AsTrack()->GetRideIndex();
     Ride* ride = get_ride(rideIndex);
 
-    const rct_preview_track* trackBlock = get_track_def_from_ride(ride, tileElement->AsTrack()->GetTrackType());
+    int32_t trackType = tileElement->AsTrack()->GetTrackType();
+    const rct_preview_track* trackBlock = get_track_def_from_ride(ride, trackType);
     uint8_t sequence = tileElement->AsTrack()->GetSequenceIndex();
     trackBlock += sequence;
 
-    const rct_track_coordinates* trackCoordinate = get_track_coord_from_ride(ride, tileElement->AsTrack()->GetTrackType());
+    const rct_track_coordinates* trackCoordinate = get_track_coord_from_ride(ride, trackType);
 
     int32_t z = tileElement->base_height * 8;
 
     uint8_t rotation = tileElement->GetDirection();
-    switch (rotation)
-    {
-        case 0:
-            x -= trackBlock->x;
-            y -= trackBlock->y;
-            break;
-        case 1:
-            x -= trackBlock->y;
-            y += trackBlock->x;
-            break;
-        case 2:
-            x += trackBlock->x;
-            y += trackBlock->y;
-            break;
-        case 3:
-            x += trackBlock->y;
-            y -= trackBlock->x;
-            break;
-    }
+    CoordsXY blockOffset = get_track_block_offset_from_ride(ride, trackType, sequence, rotation);
+    x -= blockOffset.x;
+    y -= blockOffset.y;
 
     z -= trackBlock->z;
     z += trackCoordinate->z_begin;
@@ -987,6 +1130,7 @@ void ride_init_all()
         ride->id = i;
         ride->type = RIDE_TYPE_NULL;
     }
+    ride_queue_invalidate_all();
 
     for (int32_t i = 0; i < MAX_RIDE_MEASUREMENTS; i++)
     {
@@ -2868,13 +3012,18 @@ Peep* ride_find_closest_mechanic(Ride* ride, int32_t forInspection)
 Peep* find_closest_mechanic(int32_t x, int32_t y, int32_t forInspection)
 {
     uint32_t closestDistance, distance;
-    uint16_t spriteIndex;
-    Peep *peep, *closestMechanic = nullptr;
+    Peep* closestMechanic = nullptr;
+
+    // Only the mechanics whose patrol covers the location are candidates when it is inside the park
+    auto candidates = map_is_location_in_park({ x, y })
+        ? staff_registry_get_members_in_patrol(STAFF_TYPE_MECHANIC, x & 0xFFE0, y & 0xFFE0)
+        : staff_registry_get_members(STAFF_TYPE_MECHANIC);
 
     closestDistance = UINT_MAX;
-    FOR_ALL_STAFF (spriteIndex, peep)
+    for (uint16_t spriteIndex : candidates)
     {
-        if (peep->staff_type != STAFF_TYPE_MECHANIC)
+        Peep* peep = GET_PEEP(spriteIndex);
+        if (peep->type != PEEP_TYPE_STAFF || peep->staff_type != STAFF_TYPE_MECHANIC)
             continue;
 
         if (!forInspection)
@@ -2896,10 +3045,6 @@ Peep* find_closest_mechanic(int32_t x, int32_t y, int32_t forInspection)
                 continue;
         }
 
-        if (map_is_location_in_park({ x, y }))
-            if (!staff_is_location_in_patrol(peep, x & 0xFFE0, y & 0xFFE0))
-                continue;
-
         if (peep->x == LOCATION_NULL)
             continue;
 
@@ -3133,53 +3278,118 @@ static void ride_measurement_update(rct_ride_measurement* measurement)
 }
 
 /**
- *
+ * Samples the ride's measurement after the given train has been updated, if it is the train being measured. When no
+ * train is being measured yet, the first train to depart becomes the measured one. This replaces checking every
+ * measured ride each tick, so only the measured train does any work.
  *  rct2: 0x006B6456
  */
-void ride_measurements_update()
+void ride_measurement_update_train(rct_vehicle* vehicle)
 {
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
-    // For each ride measurement
-    for (int32_t i = 0; i < MAX_RIDE_MEASUREMENTS; i++)
-    {
-        rct_ride_measurement* measurement = get_ride_measurement(i);
-        if (measurement->ride_index == RIDE_ID_NULL)
-            continue;
+    if (vehicle->sprite_identifier != SPRITE_IDENTIFIER_VEHICLE)
+        return;
 
-        Ride* ride = get_ride(measurement->ride_index);
-        if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_ON_TRACK))
-            continue;
+    Ride* ride = get_ride(vehicle->ride);
+    if (ride == nullptr || ride->measurement_index >= MAX_RIDE_MEASUREMENTS)
+        return;
+
+    rct_ride_measurement* measurement = get_ride_measurement(ride->measurement_index);
+    if (measurement->ride_index != ride->id)
+        return;
+
+    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_ON_TRACK))
+        return;
 
-        if (measurement->flags & RIDE_MEASUREMENT_FLAG_RUNNING)
+    if (measurement->flags & RIDE_MEASUREMENT_FLAG_RUNNING)
+    {
+        if (ride->vehicles[measurement->vehicle_index] == vehicle->sprite_index)
         {
             ride_measurement_update(measurement);
         }
-        else
+    }
+    else if (vehicle->status == VEHICLE_STATUS_DEPARTING || vehicle->status == VEHICLE_STATUS_TRAVELLING_CABLE_LIFT)
+    {
+        for (int32_t i = 0; i < ride->num_vehicles; i++)
         {
-            // For each vehicle
-            for (int32_t j = 0; j < ride->num_vehicles; j++)
+            if (ride->vehicles[i] == vehicle->sprite_index)
             {
-                uint16_t vehicleSpriteIdx = ride->vehicles[j];
-                if (vehicleSpriteIdx == SPRITE_INDEX_NULL)
-                    continue;
-
-                rct_vehicle* vehicle = GET_VEHICLE(vehicleSpriteIdx);
-                if (vehicle->status == VEHICLE_STATUS_DEPARTING || vehicle->status == VEHICLE_STATUS_TRAVELLING_CABLE_LIFT)
-                {
-                    measurement->vehicle_index = j;
-                    measurement->current_station = vehicle->current_station;
-                    measurement->flags |= RIDE_MEASUREMENT_FLAG_RUNNING;
-                    measurement->flags &= ~RIDE_MEASUREMENT_FLAG_UNLOADING;
-                    ride_measurement_update(measurement);
-                    break;
-                }
+                measurement->vehicle_index = i;
+                measurement->current_station = vehicle->current_station;
+                measurement->flags |= RIDE_MEASUREMENT_FLAG_RUNNING;
+                measurement->flags &= ~RIDE_MEASUREMENT_FLAG_UNLOADING;
+                ride_measurement_update(measurement);
+                break;
             }
         }
     }
 }
 
+/**
+ * Exports the recorded samples as CSV, one row per sample. Samples are taken every other tick. Velocity is in mph,
+ * altitude in the map's height units (z / 8) and G forces in g.
+ */
+std::string ride_measurement_export_csv(const rct_ride_measurement* measurement)
+{
+    bool hasGForces = (measurement->flags & RIDE_MEASUREMENT_FLAG_G_FORCES) != 0;
+    std::string result = hasGForces ? "tick,velocity,altitude,vertical_g,lateral_g\n" : "tick,velocity,altitude\n";
+    for (int32_t i = 0; i < measurement->num_items && i < RIDE_MEASUREMENT_MAX_ITEMS; i++)
+    {
+        result += String::StdFormat(
+            "%d,%.2f,%d", i * 2, measurement->velocity[i] * 9 / 20.0, measurement->altitude[i]);
+        if (hasGForces)
+        {
+            result += String::StdFormat(
+                ",%.2f,%.2f", measurement->vertical[i] * 8 / 100.0, measurement->lateral[i] * 8 / 100.0);
+        }
+        result += "\n";
+    }
+    return result;
+}
+
+/**
+ * Exports the recorded samples as JSON, with the same values as ride_measurement_export_csv.
+ */
+std::string ride_measurement_export_json(const rct_ride_measurement* measurement)
+{
+    bool hasGForces = (measurement->flags & RIDE_MEASUREMENT_FLAG_G_FORCES) != 0;
+    json_t* samples = json_array();
+    for (int32_t i = 0; i < measurement->num_items && i < RIDE_MEASUREMENT_MAX_ITEMS; i++)
+    {
+        json_t* sample = json_object();
+        json_object_set_new(sample, "tick", json_integer(i * 2));
+        json_object_set_new(sample, "velocity", json_real(measurement->velocity[i] * 9 / 20.0));
+        json_object_set_new(sample, "altitude", json_integer(measurement->altitude[i]));
+        if (hasGForces)
+        {
+            json_object_set_new(sample, "vertical_g", json_real(measurement->vertical[i] * 8 / 100.0));
+            json_object_set_new(sample, "lateral_g", json_real(measurement->lateral[i] * 8 / 100.0));
+        }
+        json_array_append_new(samples, sample);
+    }
+
+    json_t* root = json_object();
+    json_object_set_new(root, "ride", json_integer(measurement->ride_index));
+    json_object_set_new(root, "current_item", json_integer(measurement->current_item));
+    json_object_set_new(root, "samples", samples);
+
+    size_t flags = JSON_INDENT(2);
+#ifdef JSON_REAL_PRECISION
+    flags |= JSON_REAL_PRECISION(4);
+#endif
+
+    std::string result;
+    char* dump = json_dumps(root, flags);
+    if (dump != nullptr)
+    {
+        result = dump;
+        free(dump);
+    }
+    json_decref(root);
+    return result;
+}
+
 static rct_ride_measurement* ride_get_existing_measurement(ride_id_t rideIndex)
 {
     for (int32_t i = 0; i < MAX_RIDE_MEASUREMENTS; i++)
@@ -6539,7 +6749,7 @@ void ride_get_entrance_or_exit_position_from_screen_position(
         {
             mapX = _unkF44188.x + CoordsDirectionDelta[direction].x;
             mapY = _unkF44188.y + CoordsDirectionDelta[direction].y;
-            if (mapX >= 0 && mapY >= 0 && mapX < (256 * 32) && mapY < (256 * 32))
+            if (mapX >= 0 && mapY >= 0 && mapX < MAXIMUM_MAP_SIZE_BIG && mapY < MAXIMUM_MAP_SIZE_BIG)
             {
                 tileElement = map_get_first_element_at(mapX >> 5, mapY >> 5);
                 do
@@ -7227,11 +7437,14 @@ void sub_6CB945(Ride* ride)
                 continue;
             }
 
-            const rct_preview_track* trackBlock = get_track_def_from_ride(ride, tileElement->AsTrack()->GetTrackType());
-            while ((++trackBlock)->index != 0xFF)
+            int32_t trackType = tileElement->AsTrack()->GetTrackType();
+            const rct_preview_track* trackBlock = get_track_def_from_ride(ride, trackType);
+            for (int32_t sequence = 1; (++trackBlock)->index != 0xFF; sequence++)
             {
+                CoordsXY blockOffset = get_track_block_offset_from_ride(ride, trackType, sequence, direction);
                 LocationXYZ16 blockLocation = location;
-                map_offset_with_rotation(&blockLocation.x, &blockLocation.y, trackBlock->x, trackBlock->y, direction);
+                blockLocation.x += blockOffset.x;
+                blockLocation.y += blockOffset.y;
 
                 bool trackFound = false;
                 tileElement = map_get_first_element_at(blockLocation.x >> 5, blockLocation.y >> 5);
@@ -18,6 +18,8 @@
 #include "RideTypes.h"
 #include "Vehicle.h"
 
+#include <string>
+
 interface IObjectManager;
 class StationObject;
 struct Peep;
@@ -1001,6 +1003,10 @@ int32_t ride_get_total_queue_length(Ride* ride);
 int32_t ride_get_max_queue_time(Ride* ride);
 Peep* ride_get_queue_head_guest(Ride* ride, int32_t stationIndex);
 void ride_queue_insert_guest_at_front(Ride* ride, int32_t stationIndex, Peep* peep);
+void ride_queue_add_guest(Ride* ride, int32_t stationIndex, Peep* peep);
+void ride_queue_remove_guest(Ride* ride, int32_t stationIndex, Peep* peep);
+void ride_queue_clear(Ride* ride, int32_t stationIndex);
+void ride_queue_invalidate_all();
 void ride_init_all();
 void reset_all_ride_build_dates();
 void ride_update_favourited_stat();
@@ -1029,7 +1035,9 @@ rct_ride_entry* get_ride_entry_by_ride(const Ride* ride);
 uint8_t* get_ride_entry_indices_for_ride_type(uint8_t rideType);
 void reset_type_to_ride_entry_index_map(IObjectManager& objectManager);
 void ride_measurement_clear(Ride* ride);
-void ride_measurements_update();
+void ride_measurement_update_train(rct_vehicle* vehicle);
+std::string ride_measurement_export_csv(const rct_ride_measurement* measurement);
+std::string ride_measurement_export_json(const rct_ride_measurement* measurement);
 rct_ride_measurement* ride_get_measurement(Ride* ride, rct_string_id* message);
 void ride_breakdown_add_news_item(Ride* ride);
 Peep* ride_find_closest_mechanic(Ride* ride, int32_t forInspection);
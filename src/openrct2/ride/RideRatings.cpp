@@ -65,42 +65,50 @@ enum
     PROXIMITY_COUNT
 };
 
-using ride_ratings_calculation = void (*)(Ride* ride);
+using ride_ratings_calculation = void (*)(rct_ride_rating_calc_data& calcData, Ride* ride);
 
 rct_ride_rating_calc_data gRideRatingsCalcData;
 
 static ride_ratings_calculation ride_ratings_get_calculate_func(uint8_t rideType);
 
-static void ride_ratings_update_state();
-static void ride_ratings_update_state_0();
-static void ride_ratings_update_state_1();
-static void ride_ratings_update_state_2();
-static void ride_ratings_update_state_3();
-static void ride_ratings_update_state_4();
-static void ride_ratings_update_state_5();
-static void ride_ratings_begin_proximity_loop();
-static void ride_ratings_calculate(Ride* ride);
+static void ride_ratings_update_state(rct_ride_rating_calc_data& calcData);
+static void ride_ratings_update_state_0(rct_ride_rating_calc_data& calcData);
+static void ride_ratings_update_state_1(rct_ride_rating_calc_data& calcData);
+static void ride_ratings_update_state_2(rct_ride_rating_calc_data& calcData);
+static void ride_ratings_update_state_3(rct_ride_rating_calc_data& calcData);
+static void ride_ratings_update_state_4(rct_ride_rating_calc_data& calcData);
+static void ride_ratings_update_state_5(rct_ride_rating_calc_data& calcData);
+static void ride_ratings_begin_proximity_loop(rct_ride_rating_calc_data& calcData);
+static void ride_ratings_calculate(rct_ride_rating_calc_data& calcData, Ride* ride);
 static void ride_ratings_calculate_value(Ride* ride);
-static void ride_ratings_score_close_proximity(TileElement* inputTileElement);
+static void ride_ratings_score_close_proximity(rct_ride_rating_calc_data& calcData, TileElement* inputTileElement);
 
 static void ride_ratings_add(rating_tuple* rating, int32_t excitement, int32_t intensity, int32_t nausea);
 
 /**
- * This is a small hack function to keep calling the ride rating processor until
- * the given ride's ratings have been calculated. What ever is currently being
- * processed will be overwritten.
- * Only purpose of this function currently is for testing.
+ * Runs the whole ratings calculation for the given ride using its own calculation state, so the ride currently being
+ * rated in the background is left untouched.
  */
 void ride_ratings_update_ride(ride_id_t rideIndex)
+{
+    rct_ride_rating_calc_data calcData = {};
+    ride_ratings_update_ride(calcData, rideIndex);
+}
+
+/**
+ * Runs the whole ratings calculation for the given ride using the given calculation state. Only the ride itself is
+ * written to, so rides can be rated independently of each other as long as each uses its own state.
+ */
+void ride_ratings_update_ride(rct_ride_rating_calc_data& calcData, ride_id_t rideIndex)
 {
     Ride* ride = get_ride(rideIndex);
     if (ride->type != RIDE_TYPE_NULL && ride->status != RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.current_ride = rideIndex;
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_INITIALISE;
-        while (gRideRatingsCalcData.state != RIDE_RATINGS_STATE_FIND_NEXT_RIDE)
+        calcData.current_ride = rideIndex;
+        calcData.state = RIDE_RATINGS_STATE_INITIALISE;
+        while (calcData.state != RIDE_RATINGS_STATE_FIND_NEXT_RIDE)
         {
-            ride_ratings_update_state();
+            ride_ratings_update_state(calcData);
         }
     }
 }
@@ -114,30 +122,30 @@ void ride_ratings_update_all()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
-    ride_ratings_update_state();
+    ride_ratings_update_state(gRideRatingsCalcData);
 }
 
-static void ride_ratings_update_state()
+static void ride_ratings_update_state(rct_ride_rating_calc_data& calcData)
 {
-    switch (gRideRatingsCalcData.state)
+    switch (calcData.state)
     {
         case RIDE_RATINGS_STATE_FIND_NEXT_RIDE:
-            ride_ratings_update_state_0();
+            ride_ratings_update_state_0(calcData);
             break;
         case RIDE_RATINGS_STATE_INITIALISE:
-            ride_ratings_update_state_1();
+            ride_ratings_update_state_1(calcData);
             break;
         case RIDE_RATINGS_STATE_2:
-            ride_ratings_update_state_2();
+            ride_ratings_update_state_2(calcData);
             break;
         case RIDE_RATINGS_STATE_CALCULATE:
-            ride_ratings_update_state_3();
+            ride_ratings_update_state_3(calcData);
             break;
         case RIDE_RATINGS_STATE_4:
-            ride_ratings_update_state_4();
+            ride_ratings_update_state_4(calcData);
             break;
         case RIDE_RATINGS_STATE_5:
-            ride_ratings_update_state_5();
+            ride_ratings_update_state_5(calcData);
             break;
     }
 }
@@ -146,9 +154,9 @@ static void ride_ratings_update_state()
  *
  *  rct2: 0x006B5A5C
  */
-static void ride_ratings_update_state_0()
+static void ride_ratings_update_state_0(rct_ride_rating_calc_data& calcData)
 {
-    int32_t currentRide = gRideRatingsCalcData.current_ride;
+    int32_t currentRide = calcData.current_ride;
 
     currentRide++;
     if (currentRide == RIDE_ID_NULL)
@@ -159,47 +167,47 @@ static void ride_ratings_update_state_0()
     Ride* ride = get_ride(currentRide);
     if (ride->type != RIDE_TYPE_NULL && ride->status != RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_INITIALISE;
+        calcData.state = RIDE_RATINGS_STATE_INITIALISE;
     }
-    gRideRatingsCalcData.current_ride = currentRide;
+    calcData.current_ride = currentRide;
 }
 
 /**
  *
  *  rct2: 0x006B5A94
  */
-static void ride_ratings_update_state_1()
+static void ride_ratings_update_state_1(rct_ride_rating_calc_data& calcData)
 {
-    gRideRatingsCalcData.proximity_total = 0;
+    calcData.proximity_total = 0;
     for (int32_t i = 0; i < PROXIMITY_COUNT; i++)
     {
-        gRideRatingsCalcData.proximity_scores[i] = 0;
+        calcData.proximity_scores[i] = 0;
     }
-    gRideRatingsCalcData.num_brakes = 0;
-    gRideRatingsCalcData.num_reversers = 0;
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_2;
-    gRideRatingsCalcData.station_flags = 0;
-    ride_ratings_begin_proximity_loop();
+    calcData.num_brakes = 0;
+    calcData.num_reversers = 0;
+    calcData.state = RIDE_RATINGS_STATE_2;
+    calcData.station_flags = 0;
+    ride_ratings_begin_proximity_loop(calcData);
 }
 
 /**
  *
  *  rct2: 0x006B5C66
  */
-static void ride_ratings_update_state_2()
+static void ride_ratings_update_state_2(rct_ride_rating_calc_data& calcData)
 {
-    const ride_id_t rideIndex = gRideRatingsCalcData.current_ride;
+    const ride_id_t rideIndex = calcData.current_ride;
     Ride* ride = get_ride(rideIndex);
     if (ride->type == RIDE_TYPE_NULL || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
-    int32_t x = gRideRatingsCalcData.proximity_x / 32;
-    int32_t y = gRideRatingsCalcData.proximity_y / 32;
-    int32_t z = gRideRatingsCalcData.proximity_z / 8;
-    int32_t trackType = gRideRatingsCalcData.proximity_track_type;
+    int32_t x = calcData.proximity_x / 32;
+    int32_t y = calcData.proximity_y / 32;
+    int32_t z = calcData.proximity_z / 8;
+    int32_t trackType = calcData.proximity_track_type;
 
     TileElement* tileElement = map_get_first_element_at(x, y);
     do
@@ -215,24 +223,24 @@ static void ride_ratings_update_state_2()
             if (trackType == TRACK_ELEM_END_STATION)
             {
                 int32_t entranceIndex = tileElement->AsTrack()->GetStationIndex();
-                gRideRatingsCalcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+                calcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
                 if (ride_get_entrance_location(ride, entranceIndex).isNull())
                 {
-                    gRideRatingsCalcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+                    calcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
                 }
             }
 
-            ride_ratings_score_close_proximity(tileElement);
+            ride_ratings_score_close_proximity(calcData, tileElement);
 
             CoordsXYE trackElement = {
-                /* .x = */ gRideRatingsCalcData.proximity_x,
-                /* .y = */ gRideRatingsCalcData.proximity_y,
+                /* .x = */ calcData.proximity_x,
+                /* .y = */ calcData.proximity_y,
                 /* .element = */ tileElement,
             };
             CoordsXYE nextTrackElement;
             if (!track_block_get_next(&trackElement, &nextTrackElement, nullptr, nullptr))
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_4;
+                calcData.state = RIDE_RATINGS_STATE_4;
                 return;
             }
 
@@ -240,70 +248,70 @@ static void ride_ratings_update_state_2()
             y = nextTrackElement.y;
             z = nextTrackElement.element->base_height * 8;
             tileElement = nextTrackElement.element;
-            if (x == gRideRatingsCalcData.proximity_start_x && y == gRideRatingsCalcData.proximity_start_y
-                && z == gRideRatingsCalcData.proximity_start_z)
+            if (x == calcData.proximity_start_x && y == calcData.proximity_start_y
+                && z == calcData.proximity_start_z)
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+                calcData.state = RIDE_RATINGS_STATE_CALCULATE;
                 return;
             }
-            gRideRatingsCalcData.proximity_x = x;
-            gRideRatingsCalcData.proximity_y = y;
-            gRideRatingsCalcData.proximity_z = z;
-            gRideRatingsCalcData.proximity_track_type = tileElement->AsTrack()->GetTrackType();
+            calcData.proximity_x = x;
+            calcData.proximity_y = y;
+            calcData.proximity_z = z;
+            calcData.proximity_track_type = tileElement->AsTrack()->GetTrackType();
             return;
         }
     } while (!(tileElement++)->IsLastForTile());
 
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
 /**
  *
  *  rct2: 0x006B5E4D
  */
-static void ride_ratings_update_state_3()
+static void ride_ratings_update_state_3(rct_ride_rating_calc_data& calcData)
 {
-    Ride* ride = get_ride(gRideRatingsCalcData.current_ride);
+    Ride* ride = get_ride(calcData.current_ride);
     if (ride->type == RIDE_TYPE_NULL || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
-    ride_ratings_calculate(ride);
+    ride_ratings_calculate(calcData, ride);
     ride_ratings_calculate_value(ride);
 
-    window_invalidate_by_number(WC_RIDE, gRideRatingsCalcData.current_ride);
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    window_invalidate_by_number(WC_RIDE, calcData.current_ride);
+    calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
 /**
  *
  *  rct2: 0x006B5BAB
  */
-static void ride_ratings_update_state_4()
+static void ride_ratings_update_state_4(rct_ride_rating_calc_data& calcData)
 {
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_5;
-    ride_ratings_begin_proximity_loop();
+    calcData.state = RIDE_RATINGS_STATE_5;
+    ride_ratings_begin_proximity_loop(calcData);
 }
 
 /**
  *
  *  rct2: 0x006B5D72
  */
-static void ride_ratings_update_state_5()
+static void ride_ratings_update_state_5(rct_ride_rating_calc_data& calcData)
 {
-    Ride* ride = get_ride(gRideRatingsCalcData.current_ride);
+    Ride* ride = get_ride(calcData.current_ride);
     if (ride->type == RIDE_TYPE_NULL || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
-    int32_t x = gRideRatingsCalcData.proximity_x / 32;
-    int32_t y = gRideRatingsCalcData.proximity_y / 32;
-    int32_t z = gRideRatingsCalcData.proximity_z / 8;
-    int32_t trackType = gRideRatingsCalcData.proximity_track_type;
+    int32_t x = calcData.proximity_x / 32;
+    int32_t y = calcData.proximity_y / 32;
+    int32_t z = calcData.proximity_z / 8;
+    int32_t trackType = calcData.proximity_track_type;
 
     TileElement* tileElement = map_get_first_element_at(x, y);
     do
@@ -315,54 +323,54 @@ static void ride_ratings_update_state_5()
 
         if (trackType == 255 || trackType == tileElement->AsTrack()->GetTrackType())
         {
-            ride_ratings_score_close_proximity(tileElement);
+            ride_ratings_score_close_proximity(calcData, tileElement);
 
-            x = gRideRatingsCalcData.proximity_x;
-            y = gRideRatingsCalcData.proximity_y;
+            x = calcData.proximity_x;
+            y = calcData.proximity_y;
             track_begin_end trackBeginEnd;
             if (!track_block_get_previous(x, y, tileElement, &trackBeginEnd))
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+                calcData.state = RIDE_RATINGS_STATE_CALCULATE;
                 return;
             }
 
             x = trackBeginEnd.begin_x;
             y = trackBeginEnd.begin_y;
             z = trackBeginEnd.begin_z;
-            if (x == gRideRatingsCalcData.proximity_start_x && y == gRideRatingsCalcData.proximity_start_y
-                && z == gRideRatingsCalcData.proximity_start_z)
+            if (x == calcData.proximity_start_x && y == calcData.proximity_start_y
+                && z == calcData.proximity_start_z)
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+                calcData.state = RIDE_RATINGS_STATE_CALCULATE;
                 return;
             }
-            gRideRatingsCalcData.proximity_x = x;
-            gRideRatingsCalcData.proximity_y = y;
-            gRideRatingsCalcData.proximity_z = z;
-            gRideRatingsCalcData.proximity_track_type = trackBeginEnd.begin_element->AsTrack()->GetTrackType();
+            calcData.proximity_x = x;
+            calcData.proximity_y = y;
+            calcData.proximity_z = z;
+            calcData.proximity_track_type = trackBeginEnd.begin_element->AsTrack()->GetTrackType();
             return;
         }
     } while (!(tileElement++)->IsLastForTile());
 
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
 /**
  *
  *  rct2: 0x006B5BB2
  */
-static void ride_ratings_begin_proximity_loop()
+static void ride_ratings_begin_proximity_loop(rct_ride_rating_calc_data& calcData)
 {
-    const ride_id_t rideIndex = gRideRatingsCalcData.current_ride;
+    const ride_id_t rideIndex = calcData.current_ride;
     Ride* ride = get_ride(rideIndex);
     if (ride->type == RIDE_TYPE_NULL || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
     if (ride->type == RIDE_TYPE_MAZE)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+        calcData.state = RIDE_RATINGS_STATE_CALCULATE;
         return;
     }
 
@@ -370,44 +378,45 @@ static void ride_ratings_begin_proximity_loop()
     {
         if (ride->stations[i].Start.xy != RCT_XY8_UNDEFINED)
         {
-            gRideRatingsCalcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+            calcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
             if (ride_get_entrance_location(ride, i).isNull())
             {
-                gRideRatingsCalcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+                calcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
             }
 
             int32_t x = ride->stations[i].Start.x * 32;
             int32_t y = ride->stations[i].Start.y * 32;
             int32_t z = ride->stations[i].Height * 8;
 
-            gRideRatingsCalcData.proximity_x = x;
-            gRideRatingsCalcData.proximity_y = y;
-            gRideRatingsCalcData.proximity_z = z;
-            gRideRatingsCalcData.proximity_track_type = 255;
-            gRideRatingsCalcData.proximity_start_x = x;
-            gRideRatingsCalcData.proximity_start_y = y;
-            gRideRatingsCalcData.proximity_start_z = z;
+            calcData.proximity_x = x;
+            calcData.proximity_y = y;
+            calcData.proximity_z = z;
+            calcData.proximity_track_type = 255;
+            calcData.proximity_start_x = x;
+            calcData.proximity_start_y = y;
+            calcData.proximity_start_z = z;
             return;
         }
     }
 
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
-static void proximity_score_increment(int32_t type)
+static void proximity_score_increment(rct_ride_rating_calc_data& calcData, int32_t type)
 {
-    gRideRatingsCalcData.proximity_scores[type]++;
+    calcData.proximity_scores[type]++;
 }
 
 /**
  *
  *  rct2: 0x006B6207
  */
-static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTileElement, int32_t direction)
+static void ride_ratings_score_close_proximity_in_direction(
+    rct_ride_rating_calc_data& calcData, TileElement* inputTileElement, int32_t direction)
 {
-    int32_t x = gRideRatingsCalcData.proximity_x + CoordsDirectionDelta[direction].x;
-    int32_t y = gRideRatingsCalcData.proximity_y + CoordsDirectionDelta[direction].y;
-    if (x < 0 || y < 0 || x >= (32 * 256) || y >= (32 * 256))
+    int32_t x = calcData.proximity_x + CoordsDirectionDelta[direction].x;
+    int32_t y = calcData.proximity_y + CoordsDirectionDelta[direction].y;
+    if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_BIG || y >= MAXIMUM_MAP_SIZE_BIG)
         return;
 
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
@@ -416,18 +425,18 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
         switch (tileElement->GetType())
         {
             case TILE_ELEMENT_TYPE_SURFACE:
-                if (gRideRatingsCalcData.proximity_base_height <= inputTileElement->base_height)
+                if (calcData.proximity_base_height <= inputTileElement->base_height)
                 {
                     if (inputTileElement->clearance_height <= tileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_SURFACE_SIDE_CLOSE);
+                        proximity_score_increment(calcData, PROXIMITY_SURFACE_SIDE_CLOSE);
                     }
                 }
                 break;
             case TILE_ELEMENT_TYPE_PATH:
                 if (abs((int32_t)inputTileElement->base_height - (int32_t)tileElement->base_height) <= 2)
                 {
-                    proximity_score_increment(PROXIMITY_PATH_SIDE_CLOSE);
+                    proximity_score_increment(calcData, PROXIMITY_PATH_SIDE_CLOSE);
                 }
                 break;
             case TILE_ELEMENT_TYPE_TRACK:
@@ -435,7 +444,7 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
                 {
                     if (abs((int32_t)inputTileElement->base_height - (int32_t)tileElement->base_height) <= 2)
                     {
-                        proximity_score_increment(PROXIMITY_FOREIGN_TRACK_SIDE_CLOSE);
+                        proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_SIDE_CLOSE);
                     }
                 }
                 break;
@@ -445,11 +454,11 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
                 {
                     if (inputTileElement->base_height > tileElement->clearance_height)
                     {
-                        proximity_score_increment(PROXIMITY_SCENERY_SIDE_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_SCENERY_SIDE_ABOVE);
                     }
                     else
                     {
-                        proximity_score_increment(PROXIMITY_SCENERY_SIDE_BELOW);
+                        proximity_score_increment(calcData, PROXIMITY_SCENERY_SIDE_BELOW);
                     }
                 }
                 break;
@@ -457,7 +466,8 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
     } while (!(tileElement++)->IsLastForTile());
 }
 
-static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTileElement, int32_t x, int32_t y)
+static void ride_ratings_score_close_proximity_loops_helper(
+    rct_ride_rating_calc_data& calcData, TileElement* inputTileElement, int32_t x, int32_t y)
 {
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
@@ -469,7 +479,7 @@ static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTi
                 int32_t zDiff = (int32_t)tileElement->base_height - (int32_t)inputTileElement->base_height;
                 if (zDiff >= 0 && zDiff <= 16)
                 {
-                    proximity_score_increment(PROXIMITY_PATH_TROUGH_VERTICAL_LOOP);
+                    proximity_score_increment(calcData, PROXIMITY_PATH_TROUGH_VERTICAL_LOOP);
                 }
             }
             break;
@@ -482,11 +492,11 @@ static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTi
                     int32_t zDiff = (int32_t)tileElement->base_height - (int32_t)inputTileElement->base_height;
                     if (zDiff >= 0 && zDiff <= 16)
                     {
-                        proximity_score_increment(PROXIMITY_TRACK_THROUGH_VERTICAL_LOOP);
+                        proximity_score_increment(calcData, PROXIMITY_TRACK_THROUGH_VERTICAL_LOOP);
                         if (tileElement->AsTrack()->GetTrackType() == TRACK_ELEM_LEFT_VERTICAL_LOOP
                             || tileElement->AsTrack()->GetTrackType() == TRACK_ELEM_RIGHT_VERTICAL_LOOP)
                         {
-                            proximity_score_increment(PROXIMITY_INTERSECTING_VERTICAL_LOOP);
+                            proximity_score_increment(calcData, PROXIMITY_INTERSECTING_VERTICAL_LOOP);
                         }
                     }
                 }
@@ -500,19 +510,19 @@ static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTi
  *
  *  rct2: 0x006B62DA
  */
-static void ride_ratings_score_close_proximity_loops(TileElement* inputTileElement)
+static void ride_ratings_score_close_proximity_loops(rct_ride_rating_calc_data& calcData, TileElement* inputTileElement)
 {
     int32_t trackType = inputTileElement->AsTrack()->GetTrackType();
     if (trackType == TRACK_ELEM_LEFT_VERTICAL_LOOP || trackType == TRACK_ELEM_RIGHT_VERTICAL_LOOP)
     {
-        int32_t x = gRideRatingsCalcData.proximity_x;
-        int32_t y = gRideRatingsCalcData.proximity_y;
-        ride_ratings_score_close_proximity_loops_helper(inputTileElement, x, y);
+        int32_t x = calcData.proximity_x;
+        int32_t y = calcData.proximity_y;
+        ride_ratings_score_close_proximity_loops_helper(calcData, inputTileElement, x, y);
 
         int32_t direction = inputTileElement->GetDirection();
-        x = gRideRatingsCalcData.proximity_x + CoordsDirectionDelta[direction].x;
-        y = gRideRatingsCalcData.proximity_y + CoordsDirectionDelta[direction].y;
-        ride_ratings_score_close_proximity_loops_helper(inputTileElement, x, y);
+        x = calcData.proximity_x + CoordsDirectionDelta[direction].x;
+        y = calcData.proximity_y + CoordsDirectionDelta[direction].y;
+        ride_ratings_score_close_proximity_loops_helper(calcData, inputTileElement, x, y);
     }
 }
 
@@ -520,16 +530,16 @@ static void ride_ratings_score_close_proximity_loops(TileElement* inputTileEleme
  *
  *  rct2: 0x006B5F9D
  */
-static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
+static void ride_ratings_score_close_proximity(rct_ride_rating_calc_data& calcData, TileElement* inputTileElement)
 {
-    if (gRideRatingsCalcData.station_flags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
+    if (calcData.station_flags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
     {
         return;
     }
 
-    gRideRatingsCalcData.proximity_total++;
-    int32_t x = gRideRatingsCalcData.proximity_x;
-    int32_t y = gRideRatingsCalcData.proximity_y;
+    calcData.proximity_total++;
+    int32_t x = calcData.proximity_x;
+    int32_t y = calcData.proximity_y;
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
     {
@@ -537,31 +547,31 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
         switch (tileElement->GetType())
         {
             case TILE_ELEMENT_TYPE_SURFACE:
-                gRideRatingsCalcData.proximity_base_height = tileElement->base_height;
-                if (tileElement->base_height * 8 == gRideRatingsCalcData.proximity_z)
+                calcData.proximity_base_height = tileElement->base_height;
+                if (tileElement->base_height * 8 == calcData.proximity_z)
                 {
-                    proximity_score_increment(PROXIMITY_SURFACE_TOUCH);
+                    proximity_score_increment(calcData, PROXIMITY_SURFACE_TOUCH);
                 }
                 waterHeight = tileElement->AsSurface()->GetWaterHeight();
                 if (waterHeight != 0)
                 {
                     int32_t z = waterHeight * 16;
-                    if (z <= gRideRatingsCalcData.proximity_z)
+                    if (z <= calcData.proximity_z)
                     {
-                        proximity_score_increment(PROXIMITY_WATER_OVER);
-                        if (z == gRideRatingsCalcData.proximity_z)
+                        proximity_score_increment(calcData, PROXIMITY_WATER_OVER);
+                        if (z == calcData.proximity_z)
                         {
-                            proximity_score_increment(PROXIMITY_WATER_TOUCH);
+                            proximity_score_increment(calcData, PROXIMITY_WATER_TOUCH);
                         }
                         z += 16;
-                        if (z == gRideRatingsCalcData.proximity_z)
+                        if (z == calcData.proximity_z)
                         {
-                            proximity_score_increment(PROXIMITY_WATER_LOW);
+                            proximity_score_increment(calcData, PROXIMITY_WATER_LOW);
                         }
                         z += 112;
-                        if (z <= gRideRatingsCalcData.proximity_z)
+                        if (z <= calcData.proximity_z)
                         {
-                            proximity_score_increment(PROXIMITY_WATER_HIGH);
+                            proximity_score_increment(calcData, PROXIMITY_WATER_HIGH);
                         }
                     }
                 }
@@ -572,11 +582,11 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                 {
                     if (tileElement->clearance_height == inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_TOUCH_ABOVE);
                     }
                     if (tileElement->base_height == inputTileElement->clearance_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_TOUCH_UNDER);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_TOUCH_UNDER);
                     }
                 }
                 else
@@ -584,15 +594,15 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                     // Bonus for path in first object entry
                     if (tileElement->clearance_height <= inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_ZERO_OVER);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_ZERO_OVER);
                     }
                     if (tileElement->clearance_height == inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_ZERO_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_ZERO_TOUCH_ABOVE);
                     }
                     if (tileElement->base_height == inputTileElement->clearance_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_ZERO_TOUCH_UNDER);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_ZERO_TOUCH_UNDER);
                     }
                 }
                 break;
@@ -606,33 +616,33 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                     {
                         if (tileElement->base_height - inputTileElement->clearance_height <= 10)
                         {
-                            proximity_score_increment(PROXIMITY_THROUGH_VERTICAL_LOOP);
+                            proximity_score_increment(calcData, PROXIMITY_THROUGH_VERTICAL_LOOP);
                         }
                     }
                 }
                 if (inputTileElement->AsTrack()->GetRideIndex() != tileElement->AsTrack()->GetRideIndex())
                 {
-                    proximity_score_increment(PROXIMITY_FOREIGN_TRACK_ABOVE_OR_BELOW);
+                    proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_ABOVE_OR_BELOW);
                     if (tileElement->clearance_height == inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
                     }
                     if (tileElement->clearance_height + 2 <= inputTileElement->base_height)
                     {
                         if (tileElement->clearance_height + 10 >= inputTileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
                         }
                     }
                     if (inputTileElement->clearance_height == tileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
                     }
                     if (inputTileElement->clearance_height + 2 == tileElement->base_height)
                     {
                         if ((uint8_t)(inputTileElement->clearance_height + 10) >= tileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
                         }
                     }
                 }
@@ -644,40 +654,40 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                            || trackType == TRACK_ELEM_BEGIN_STATION);
                     if (tileElement->clearance_height == inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
                         if (isStation)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_STATION_TOUCH_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_OWN_STATION_TOUCH_ABOVE);
                         }
                     }
                     if (tileElement->clearance_height + 2 <= inputTileElement->base_height)
                     {
                         if (tileElement->clearance_height + 10 >= inputTileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
                             if (isStation)
                             {
-                                proximity_score_increment(PROXIMITY_OWN_STATION_CLOSE_ABOVE);
+                                proximity_score_increment(calcData, PROXIMITY_OWN_STATION_CLOSE_ABOVE);
                             }
                         }
                     }
 
                     if (inputTileElement->clearance_height == tileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
                         if (isStation)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_STATION_TOUCH_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_OWN_STATION_TOUCH_ABOVE);
                         }
                     }
                     if (inputTileElement->clearance_height + 2 <= tileElement->base_height)
                     {
                         if (inputTileElement->clearance_height + 10 >= tileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
                             if (isStation)
                             {
-                                proximity_score_increment(PROXIMITY_OWN_STATION_CLOSE_ABOVE);
+                                proximity_score_increment(calcData, PROXIMITY_OWN_STATION_CLOSE_ABOVE);
                             }
                         }
                     }
@@ -688,28 +698,28 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
     } while (!(tileElement++)->IsLastForTile());
 
     uint8_t direction = inputTileElement->GetDirection();
-    ride_ratings_score_close_proximity_in_direction(inputTileElement, (direction + 1) & 3);
-    ride_ratings_score_close_proximity_in_direction(inputTileElement, (direction - 1) & 3);
-    ride_ratings_score_close_proximity_loops(inputTileElement);
+    ride_ratings_score_close_proximity_in_direction(calcData, inputTileElement, (direction + 1) & 3);
+    ride_ratings_score_close_proximity_in_direction(calcData, inputTileElement, (direction - 1) & 3);
+    ride_ratings_score_close_proximity_loops(calcData, inputTileElement);
 
-    switch (gRideRatingsCalcData.proximity_track_type)
+    switch (calcData.proximity_track_type)
     {
         case TRACK_ELEM_BRAKES:
-            gRideRatingsCalcData.num_brakes++;
+            calcData.num_brakes++;
             break;
         case TRACK_ELEM_LEFT_REVERSER:
         case TRACK_ELEM_RIGHT_REVERSER:
-            gRideRatingsCalcData.num_reversers++;
+            calcData.num_reversers++;
             break;
     }
 }
 
-static void ride_ratings_calculate(Ride* ride)
+static void ride_ratings_calculate(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     auto calcFunc = ride_ratings_get_calculate_func(ride->type);
     if (calcFunc != nullptr)
     {
-        calcFunc(ride);
+        calcFunc(calcData, ride);
     }
 
 #ifdef ORIGINAL_RATINGS
@@ -824,7 +834,7 @@ static void ride_ratings_calculate_value(Ride* ride)
  * inputs
  * - edi: ride ptr
  */
-static uint16_t ride_compute_upkeep(Ride* ride)
+static uint16_t ride_compute_upkeep(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     // data stored at 0x0057E3A8, incrementing 18 bytes at a time
     uint16_t upkeep = initialUpkeepCosts[ride->type];
@@ -863,10 +873,10 @@ static uint16_t ride_compute_upkeep(Ride* ride)
     {
         reverserMaintenanceCost = 10;
     }
-    upkeep += reverserMaintenanceCost * gRideRatingsCalcData.num_reversers;
+    upkeep += reverserMaintenanceCost * calcData.num_reversers;
 
     // Add maintenance cost for brake track pieces
-    upkeep += 20 * gRideRatingsCalcData.num_brakes;
+    upkeep += 20 * calcData.num_brakes;
 
     // these seem to be adhoc adjustments to a ride's upkeep/cost, times
     // various variables set on the ride itself.
@@ -1024,9 +1034,9 @@ static uint32_t get_proximity_score_helper_3(uint16_t x, uint16_t resultIfNotZer
  *
  *  rct2: 0x0065E277
  */
-static uint32_t ride_ratings_get_proximity_score()
+static uint32_t ride_ratings_get_proximity_score(rct_ride_rating_calc_data& calcData)
 {
-    const uint16_t* scores = gRideRatingsCalcData.proximity_scores;
+    const uint16_t* scores = calcData.proximity_scores;
 
     uint32_t result = 0;
     result += get_proximity_score_helper_1(scores[PROXIMITY_WATER_OVER], 60, 0x00AAAA);
@@ -1553,9 +1563,10 @@ static void ride_ratings_apply_rotations(
         ride->rotations * nauseaMultiplier);
 }
 
-static void ride_ratings_apply_proximity(rating_tuple* ratings, int32_t excitementMultiplier)
+static void ride_ratings_apply_proximity(
+    rct_ride_rating_calc_data& calcData, rating_tuple* ratings, int32_t excitementMultiplier)
 {
-    ride_ratings_add(ratings, (ride_ratings_get_proximity_score() * excitementMultiplier) >> 16, 0, 0);
+    ride_ratings_add(ratings, (ride_ratings_get_proximity_score(calcData) * excitementMultiplier) >> 16, 0, 0);
 }
 
 static void ride_ratings_apply_scenery(rating_tuple* ratings, Ride* ride, int32_t excitementMultiplier)
@@ -1654,7 +1665,7 @@ static void ride_ratings_apply_first_length_penalty(
 
 #pragma region Ride rating calculation functions
 
-static void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_spiral_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1674,7 +1685,7 @@ static void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 28235, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -1694,14 +1705,14 @@ static void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_stand_up_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1721,7 +1732,7 @@ static void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 34952, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 28398, 30427);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(calcData, &ratings, 17893);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -1733,14 +1744,14 @@ static void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
+static void ride_ratings_calculate_suspended_swinging_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1760,7 +1771,7 @@ static void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 48036);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6971);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xC0000, 2, 2, 2);
@@ -1774,14 +1785,14 @@ static void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_inverted_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1801,7 +1812,7 @@ static void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
+    ride_ratings_apply_proximity(calcData, &ratings, 15657);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -1818,14 +1829,14 @@ static void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_junior_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1845,7 +1856,7 @@ static void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -1857,14 +1868,14 @@ static void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_miniature_railway(Ride* ride)
+static void ride_ratings_calculate_miniature_railway(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1880,7 +1891,7 @@ static void ride_ratings_calculate_miniature_railway(Ride* ride)
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, -6425, 6553, 23405);
-    ride_ratings_apply_proximity(&ratings, 8946);
+    ride_ratings_apply_proximity(calcData, &ratings, 8946);
     ride_ratings_apply_scenery(&ratings, ride, 20915);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 2, 2);
 
@@ -1889,7 +1900,7 @@ static void ride_ratings_calculate_miniature_railway(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     int32_t edx = get_num_of_sheltered_eighths(ride);
@@ -1900,7 +1911,7 @@ static void ride_ratings_calculate_miniature_railway(Ride* ride)
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_monorail(Ride* ride)
+static void ride_ratings_calculate_monorail(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1916,7 +1927,7 @@ static void ride_ratings_calculate_monorail(Ride* ride)
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 218453);
     ride_ratings_apply_duration(&ratings, ride, 150, 21845);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 18724);
-    ride_ratings_apply_proximity(&ratings, 8946);
+    ride_ratings_apply_proximity(calcData, &ratings, 8946);
     ride_ratings_apply_scenery(&ratings, ride, 16732);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
 
@@ -1925,7 +1936,7 @@ static void ride_ratings_calculate_monorail(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     int32_t edx = get_num_of_sheltered_eighths(ride);
@@ -1936,7 +1947,7 @@ static void ride_ratings_calculate_monorail(Ride* ride)
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
+static void ride_ratings_calculate_mini_suspended_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1956,7 +1967,7 @@ static void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 34179, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 58254, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 13943);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x80000, 2, 2, 2);
@@ -1969,14 +1980,14 @@ static void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_boat_hire(Ride* ride)
+static void ride_ratings_calculate_boat_hire(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->unreliability_factor = 7;
     set_unreliability_factor(ride);
@@ -1994,7 +2005,7 @@ static void ride_ratings_calculate_boat_hire(Ride* ride)
         ride_ratings_add(&ratings, RIDE_RATING(0, 20), 0, 0);
     }
 
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(calcData, &ratings, 11183);
     ride_ratings_apply_scenery(&ratings, ride, 22310);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2002,14 +2013,14 @@ static void ride_ratings_calculate_boat_hire(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
+static void ride_ratings_calculate_wooden_wild_mouse(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2029,7 +2040,7 @@ static void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(calcData, &ratings, 17893);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -2044,14 +2055,14 @@ static void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_steeplechase(Ride* ride)
+static void ride_ratings_calculate_steeplechase(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2071,7 +2082,7 @@ static void ride_ratings_calculate_steeplechase(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 4, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x80000, 2, 2, 2);
@@ -2085,14 +2096,14 @@ static void ride_ratings_calculate_steeplechase(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_car_ride(Ride* ride)
+static void ride_ratings_calculate_car_ride(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2111,7 +2122,7 @@ static void ride_ratings_calculate_car_ride(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 11437);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(calcData, &ratings, 11183);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 8, 2, 2);
 
@@ -2120,14 +2131,14 @@ static void ride_ratings_calculate_car_ride(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_launched_freefall(Ride* ride)
+static void ride_ratings_calculate_launched_freefall(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2164,7 +2175,7 @@ static void ride_ratings_calculate_launched_freefall(Ride* ride)
     }
 #endif
 
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 25098);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2172,14 +2183,14 @@ static void ride_ratings_calculate_launched_freefall(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
+static void ride_ratings_calculate_bobsleigh_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2199,7 +2210,7 @@ static void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xC0000, 2, 2, 2);
     ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 20), 2, 2, 2);
@@ -2211,14 +2222,14 @@ static void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_observation_tower(Ride* ride)
+static void ride_ratings_calculate_observation_tower(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2230,7 +2241,7 @@ static void ride_ratings_calculate_observation_tower(Ride* ride)
     ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 00), RIDE_RATING(0, 10));
     ride_ratings_add(
         &ratings, ((ride_get_total_length(ride) >> 16) * 45875) >> 16, 0, ((ride_get_total_length(ride) >> 16) * 26214) >> 16);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 83662);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2238,7 +2249,7 @@ static void ride_ratings_calculate_observation_tower(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
@@ -2249,7 +2260,7 @@ static void ride_ratings_calculate_observation_tower(Ride* ride)
         ride->excitement /= 4;
 }
 
-static void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_looping_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2269,7 +2280,7 @@ static void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -2289,14 +2300,14 @@ static void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_dinghy_slide(Ride* ride)
+static void ride_ratings_calculate_dinghy_slide(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2316,7 +2327,7 @@ static void ride_ratings_calculate_dinghy_slide(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(calcData, &ratings, 11183);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -2328,14 +2339,14 @@ static void ride_ratings_calculate_dinghy_slide(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_mine_train_coaster(Ride* ride)
+static void ride_ratings_calculate_mine_train_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2355,7 +2366,7 @@ static void ride_ratings_calculate_mine_train_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 21472);
+    ride_ratings_apply_proximity(calcData, &ratings, 21472);
     ride_ratings_apply_scenery(&ratings, ride, 16732);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -2369,14 +2380,14 @@ static void ride_ratings_calculate_mine_train_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_chairlift(Ride* ride)
+static void ride_ratings_calculate_chairlift(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2393,7 +2404,7 @@ static void ride_ratings_calculate_chairlift(Ride* ride)
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
     ride_ratings_apply_turns(&ratings, ride, 7430, 3476, 4574);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, -19275, 21845, 23405);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(calcData, &ratings, 11183);
     ride_ratings_apply_scenery(&ratings, ride, 25098);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x960000, 2, 2, 2);
 
@@ -2408,7 +2419,7 @@ static void ride_ratings_calculate_chairlift(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     int32_t edx = get_num_of_sheltered_eighths(ride);
@@ -2419,7 +2430,7 @@ static void ride_ratings_calculate_chairlift(Ride* ride)
     ride->inversions |= edx << 5;
 }
 
-static void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_corkscrew_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2439,7 +2450,7 @@ static void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -2459,14 +2470,14 @@ static void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_maze(Ride* ride)
+static void ride_ratings_calculate_maze(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2486,14 +2497,14 @@ static void ride_ratings_calculate_maze(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_spiral_slide(Ride* ride)
+static void ride_ratings_calculate_spiral_slide(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2516,14 +2527,14 @@ static void ride_ratings_calculate_spiral_slide(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 2 << 5;
 }
 
-static void ride_ratings_calculate_go_karts(Ride* ride)
+static void ride_ratings_calculate_go_karts(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2546,7 +2557,7 @@ static void ride_ratings_calculate_go_karts(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 4458, 3476, 5718);
     ride_ratings_apply_drops(&ratings, ride, 8738, 5461, 6553);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 2570, 8738, 2340);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(calcData, &ratings, 11183);
     ride_ratings_apply_scenery(&ratings, ride, 16732);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2554,7 +2565,7 @@ static void ride_ratings_calculate_go_karts(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     int32_t edx = get_num_of_sheltered_eighths(ride);
@@ -2566,7 +2577,7 @@ static void ride_ratings_calculate_go_karts(Ride* ride)
         ride->excitement /= 2;
 }
 
-static void ride_ratings_calculate_log_flume(Ride* ride)
+static void ride_ratings_calculate_log_flume(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2583,7 +2594,7 @@ static void ride_ratings_calculate_log_flume(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
     ride_ratings_apply_drops(&ratings, ride, 69905, 62415, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(calcData, &ratings, 22367);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 2, 2, 2, 2);
 
@@ -2592,14 +2603,14 @@ static void ride_ratings_calculate_log_flume(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_river_rapids(Ride* ride)
+static void ride_ratings_calculate_river_rapids(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2616,7 +2627,7 @@ static void ride_ratings_calculate_river_rapids(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 22598, 5718);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 31314);
+    ride_ratings_apply_proximity(calcData, &ratings, 31314);
     ride_ratings_apply_scenery(&ratings, ride, 13943);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 2, 2, 2, 2);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 2, 2);
@@ -2626,14 +2637,14 @@ static void ride_ratings_calculate_river_rapids(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_dodgems(Ride* ride)
+static void ride_ratings_calculate_dodgems(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2662,14 +2673,14 @@ static void ride_ratings_calculate_dodgems(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 7 << 5;
 }
 
-static void ride_ratings_calculate_pirate_ship(Ride* ride)
+static void ride_ratings_calculate_pirate_ship(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2688,14 +2699,14 @@ static void ride_ratings_calculate_pirate_ship(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_inverter_ship(Ride* ride)
+static void ride_ratings_calculate_inverter_ship(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2714,32 +2725,32 @@ static void ride_ratings_calculate_inverter_ship(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_food_stall(Ride* ride)
+static void ride_ratings_calculate_food_stall(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-static void ride_ratings_calculate_drink_stall(Ride* ride)
+static void ride_ratings_calculate_drink_stall(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-static void ride_ratings_calculate_shop(Ride* ride)
+static void ride_ratings_calculate_shop(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-static void ride_ratings_calculate_merry_go_round(Ride* ride)
+static void ride_ratings_calculate_merry_go_round(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2755,26 +2766,26 @@ static void ride_ratings_calculate_merry_go_round(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 7 << 5;
 }
 
-static void ride_ratings_calculate_information_kiosk(Ride* ride)
+static void ride_ratings_calculate_information_kiosk(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-static void ride_ratings_calculate_toilets(Ride* ride)
+static void ride_ratings_calculate_toilets(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-static void ride_ratings_calculate_ferris_wheel(Ride* ride)
+static void ride_ratings_calculate_ferris_wheel(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2790,14 +2801,14 @@ static void ride_ratings_calculate_ferris_wheel(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_motion_simulator(Ride* ride)
+static void ride_ratings_calculate_motion_simulator(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2824,14 +2835,14 @@ static void ride_ratings_calculate_motion_simulator(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 7 << 5;
 }
 
-static void ride_ratings_calculate_3d_cinema(Ride* ride)
+static void ride_ratings_calculate_3d_cinema(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2865,14 +2876,14 @@ static void ride_ratings_calculate_3d_cinema(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 7 << 5;
 }
 
-static void ride_ratings_calculate_top_spin(Ride* ride)
+static void ride_ratings_calculate_top_spin(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2908,14 +2919,14 @@ static void ride_ratings_calculate_top_spin(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_space_rings(Ride* ride)
+static void ride_ratings_calculate_space_rings(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2931,14 +2942,14 @@ static void ride_ratings_calculate_space_rings(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride)
+static void ride_ratings_calculate_reverse_freefall_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2953,7 +2964,7 @@ static void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride)
     ride_ratings_apply_max_speed(&ratings, ride, 436906, 436906, 320398);
     ride_ratings_apply_gforces(&ratings, ride, 24576, 41704, 59578);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 28398, 11702);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(calcData, &ratings, 17893);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 34, 2, 2, 2);
 
@@ -2962,14 +2973,14 @@ static void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_lift(Ride* ride)
+static void ride_ratings_calculate_lift(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     int32_t totalLength;
 
@@ -2985,7 +2996,7 @@ static void ride_ratings_calculate_lift(Ride* ride)
     totalLength = ride_get_total_length(ride) >> 16;
     ride_ratings_add(&ratings, (totalLength * 45875) >> 16, 0, (totalLength * 26214) >> 16);
 
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(calcData, &ratings, 11183);
     ride_ratings_apply_scenery(&ratings, ride, 83662);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2993,7 +3004,7 @@ static void ride_ratings_calculate_lift(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
@@ -3003,7 +3014,7 @@ static void ride_ratings_calculate_lift(Ride* ride)
         ride->excitement /= 4;
 }
 
-static void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_vertical_drop_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3022,7 +3033,7 @@ static void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 58254, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 20, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -3035,20 +3046,20 @@ static void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_cash_machine(Ride* ride)
+static void ride_ratings_calculate_cash_machine(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-static void ride_ratings_calculate_twist(Ride* ride)
+static void ride_ratings_calculate_twist(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3064,14 +3075,14 @@ static void ride_ratings_calculate_twist(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_haunted_house(Ride* ride)
+static void ride_ratings_calculate_haunted_house(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3089,14 +3100,14 @@ static void ride_ratings_calculate_haunted_house(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0xE0;
 }
 
-static void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_flying_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3116,7 +3127,7 @@ static void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -3135,14 +3146,14 @@ static void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_virginia_reel(Ride* ride)
+static void ride_ratings_calculate_virginia_reel(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3162,7 +3173,7 @@ static void ride_ratings_calculate_virginia_reel(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 52012, 26075, 45749);
     ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(calcData, &ratings, 22367);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xD20000, 2, 2, 2);
     ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
@@ -3173,14 +3184,14 @@ static void ride_ratings_calculate_virginia_reel(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_splash_boats(Ride* ride)
+static void ride_ratings_calculate_splash_boats(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3197,7 +3208,7 @@ static void ride_ratings_calculate_splash_boats(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
     ride_ratings_apply_drops(&ratings, ride, 87381, 93622, 62259);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(calcData, &ratings, 22367);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
 
@@ -3206,14 +3217,14 @@ static void ride_ratings_calculate_splash_boats(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_mini_helicopters(Ride* ride)
+static void ride_ratings_calculate_mini_helicopters(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3232,7 +3243,7 @@ static void ride_ratings_calculate_mini_helicopters(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 4574);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 8946);
+    ride_ratings_apply_proximity(calcData, &ratings, 8946);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xA00000, 2, 2, 2);
 
@@ -3241,14 +3252,14 @@ static void ride_ratings_calculate_mini_helicopters(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 6 << 5;
 }
 
-static void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_lay_down_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3268,7 +3279,7 @@ static void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -3292,14 +3303,14 @@ static void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_suspended_monorail(Ride* ride)
+static void ride_ratings_calculate_suspended_monorail(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3315,7 +3326,7 @@ static void ride_ratings_calculate_suspended_monorail(Ride* ride)
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 218453);
     ride_ratings_apply_duration(&ratings, ride, 150, 21845);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 18724);
-    ride_ratings_apply_proximity(&ratings, 12525);
+    ride_ratings_apply_proximity(calcData, &ratings, 12525);
     ride_ratings_apply_scenery(&ratings, ride, 25098);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
 
@@ -3324,7 +3335,7 @@ static void ride_ratings_calculate_suspended_monorail(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     int32_t edx = get_num_of_sheltered_eighths(ride);
@@ -3335,7 +3346,7 @@ static void ride_ratings_calculate_suspended_monorail(Ride* ride)
     ride->inversions |= edx << 5;
 }
 
-static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_reverser_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3351,7 +3362,7 @@ static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
 
-    int32_t numReversers = std::min<uint16_t>(gRideRatingsCalcData.num_reversers, 6);
+    int32_t numReversers = std::min<uint16_t>(calcData.num_reversers, 6);
     ride_rating reverserRating = numReversers * RIDE_RATING(0, 20);
     ride_ratings_add(&ratings, reverserRating, reverserRating, reverserRating);
 
@@ -3360,10 +3371,10 @@ static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(calcData, &ratings, 22367);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
 
-    if (gRideRatingsCalcData.num_reversers < 1)
+    if (calcData.num_reversers < 1)
     {
         ratings.excitement /= 8;
     }
@@ -3377,14 +3388,14 @@ static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
+static void ride_ratings_calculate_heartline_twister_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3404,7 +3415,7 @@ static void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 52150, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 53052, 55705);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 34952, 35108);
-    ride_ratings_apply_proximity(&ratings, 9841);
+    ride_ratings_apply_proximity(calcData, &ratings, 9841);
     ride_ratings_apply_scenery(&ratings, ride, 3904);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -3418,14 +3429,14 @@ static void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_mini_golf(Ride* ride)
+static void ride_ratings_calculate_mini_golf(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3438,7 +3449,7 @@ static void ride_ratings_calculate_mini_golf(Ride* ride)
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 15657);
+    ride_ratings_apply_proximity(calcData, &ratings, 15657);
     ride_ratings_apply_scenery(&ratings, ride, 27887);
 
     // Apply golf holes factor
@@ -3457,20 +3468,20 @@ static void ride_ratings_calculate_mini_golf(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_first_aid(Ride* ride)
+static void ride_ratings_calculate_first_aid(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-static void ride_ratings_calculate_circus_show(Ride* ride)
+static void ride_ratings_calculate_circus_show(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3488,14 +3499,14 @@ static void ride_ratings_calculate_circus_show(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 7 << 5;
 }
 
-static void ride_ratings_calculate_ghost_train(Ride* ride)
+static void ride_ratings_calculate_ghost_train(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3513,7 +3524,7 @@ static void ride_ratings_calculate_ghost_train(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 11437);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(calcData, &ratings, 11183);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xB40000, 2, 2, 2);
 
@@ -3522,14 +3533,14 @@ static void ride_ratings_calculate_ghost_train(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_twister_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3549,7 +3560,7 @@ static void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -3569,14 +3580,14 @@ static void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_wooden_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3596,7 +3607,7 @@ static void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(calcData, &ratings, 22367);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -3610,14 +3621,14 @@ static void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_side_friction_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3637,7 +3648,7 @@ static void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(calcData, &ratings, 22367);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x50000, 2, 2, 2);
@@ -3650,14 +3661,14 @@ static void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_wild_mouse(Ride* ride)
+static void ride_ratings_calculate_wild_mouse(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3677,7 +3688,7 @@ static void ride_ratings_calculate_wild_mouse(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(calcData, &ratings, 17893);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -3691,14 +3702,14 @@ static void ride_ratings_calculate_wild_mouse(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_multi_dimension_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3718,7 +3729,7 @@ static void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -3737,14 +3748,14 @@ static void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_giga_coaster(Ride* ride)
+static void ride_ratings_calculate_giga_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3764,7 +3775,7 @@ static void ride_ratings_calculate_giga_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 28235, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -3784,14 +3795,14 @@ static void ride_ratings_calculate_giga_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_roto_drop(Ride* ride)
+static void ride_ratings_calculate_roto_drop(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3805,7 +3816,7 @@ static void ride_ratings_calculate_roto_drop(Ride* ride)
     int32_t lengthFactor = ((ride_get_total_length(ride) >> 16) * 209715) >> 16;
     ride_ratings_add(&ratings, lengthFactor, lengthFactor * 2, lengthFactor * 2);
 
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(calcData, &ratings, 11183);
     ride_ratings_apply_scenery(&ratings, ride, 25098);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -3813,14 +3824,14 @@ static void ride_ratings_calculate_roto_drop(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_flying_saucers(Ride* ride)
+static void ride_ratings_calculate_flying_saucers(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3852,14 +3863,14 @@ static void ride_ratings_calculate_flying_saucers(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_crooked_house(Ride* ride)
+static void ride_ratings_calculate_crooked_house(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3877,14 +3888,14 @@ static void ride_ratings_calculate_crooked_house(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0xE0;
 }
 
-static void ride_ratings_calculate_monorail_cycles(Ride* ride)
+static void ride_ratings_calculate_monorail_cycles(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3903,7 +3914,7 @@ static void ride_ratings_calculate_monorail_cycles(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 4574);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 2340);
-    ride_ratings_apply_proximity(&ratings, 8946);
+    ride_ratings_apply_proximity(calcData, &ratings, 8946);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x8C0000, 2, 2, 2);
 
@@ -3912,14 +3923,14 @@ static void ride_ratings_calculate_monorail_cycles(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
+static void ride_ratings_calculate_compact_inverted_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3939,7 +3950,7 @@ static void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
+    ride_ratings_apply_proximity(calcData, &ratings, 15657);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -3956,14 +3967,14 @@ static void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_water_coaster(Ride* ride)
+static void ride_ratings_calculate_water_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3983,7 +3994,7 @@ static void ride_ratings_calculate_water_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -3998,14 +4009,14 @@ static void ride_ratings_calculate_water_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride)
+static void ride_ratings_calculate_air_powered_vertical_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4020,7 +4031,7 @@ static void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride)
     ride_ratings_apply_max_speed(&ratings, ride, 509724, 364088, 320398);
     ride_ratings_apply_gforces(&ratings, ride, 24576, 35746, 59578);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 21845, 11702);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(calcData, &ratings, 17893);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 34, 2, 1, 1);
 
@@ -4030,14 +4041,14 @@ static void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
+static void ride_ratings_calculate_inverted_hairpin_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4057,7 +4068,7 @@ static void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(calcData, &ratings, 17893);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -4072,14 +4083,14 @@ static void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_magic_carpet(Ride* ride)
+static void ride_ratings_calculate_magic_carpet(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -4098,14 +4109,14 @@ static void ride_ratings_calculate_magic_carpet(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_submarine_ride(Ride* ride)
+static void ride_ratings_calculate_submarine_ride(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->unreliability_factor = 7;
     set_unreliability_factor(ride);
@@ -4115,7 +4126,7 @@ static void ride_ratings_calculate_submarine_ride(Ride* ride)
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 20), RIDE_RATING(1, 80), RIDE_RATING(1, 40));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(calcData, &ratings, 11183);
     ride_ratings_apply_scenery(&ratings, ride, 22310);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -4123,14 +4134,14 @@ static void ride_ratings_calculate_submarine_ride(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 0 << 5;
 }
 
-static void ride_ratings_calculate_river_rafts(Ride* ride)
+static void ride_ratings_calculate_river_rafts(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4146,7 +4157,7 @@ static void ride_ratings_calculate_river_rafts(Ride* ride)
     ride_ratings_apply_duration(&ratings, ride, 500, 13107);
     ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
     ride_ratings_apply_drops(&ratings, ride, 78643, 93622, 62259);
-    ride_ratings_apply_proximity(&ratings, 13420);
+    ride_ratings_apply_proximity(calcData, &ratings, 13420);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -4154,14 +4165,14 @@ static void ride_ratings_calculate_river_rafts(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_enterprise(Ride* ride)
+static void ride_ratings_calculate_enterprise(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -4184,14 +4195,14 @@ static void ride_ratings_calculate_enterprise(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= 3 << 5;
 }
 
-static void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
+static void ride_ratings_calculate_inverted_impulse_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4211,7 +4222,7 @@ static void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
+    ride_ratings_apply_proximity(calcData, &ratings, 15657);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 20, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -4222,14 +4233,14 @@ static void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_mini_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4249,7 +4260,7 @@ static void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -4262,14 +4273,14 @@ static void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_mine_ride(Ride* ride)
+static void ride_ratings_calculate_mine_ride(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4289,7 +4300,7 @@ static void ride_ratings_calculate_mine_ride(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 21472);
+    ride_ratings_apply_proximity(calcData, &ratings, 21472);
     ride_ratings_apply_scenery(&ratings, ride, 16732);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x10E0000, 2, 2, 2);
 
@@ -4299,14 +4310,14 @@ static void ride_ratings_calculate_mine_ride(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
     ride->inversions |= get_num_of_sheltered_eighths(ride) << 5;
 }
 
-static void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_lim_launched_roller_coaster(rct_ride_rating_calc_data& calcData, Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4326,7 +4337,7 @@ static void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(calcData, &ratings, 20130);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if ((ride->inversions & 0x1F) == 0)
@@ -4346,7 +4357,7 @@ static void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(calcData, ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->inversions &= 0x1F;
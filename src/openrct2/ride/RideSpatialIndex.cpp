@@ -0,0 +1,233 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideSpatialIndex.h"
+
+#include "../world/Map.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+// Guests regularly look for rides around them, which used to mean walking the tile elements of every tile in a 21x21
+// area. The map is instead split into chunks of 8x8 tiles, each listing the rides with track in it and a mask of the
+// tiles that track covers, so a query only has to test a few masks per chunk. Chunks are rebuilt lazily on the next
+// query after elements are inserted into them, or after a track piece of one of their rides is removed.
+
+constexpr int32_t RIDE_SPATIAL_INDEX_CHUNK_SHIFT = 3;
+constexpr int32_t RIDE_SPATIAL_INDEX_CHUNK_SIZE = 1 << RIDE_SPATIAL_INDEX_CHUNK_SHIFT;
+constexpr int32_t RIDE_SPATIAL_INDEX_CHUNKS_PER_SIDE = MAXIMUM_MAP_SIZE_TECHNICAL >> RIDE_SPATIAL_INDEX_CHUNK_SHIFT;
+constexpr int32_t RIDE_SPATIAL_INDEX_CHUNK_COUNT = RIDE_SPATIAL_INDEX_CHUNKS_PER_SIDE * RIDE_SPATIAL_INDEX_CHUNKS_PER_SIDE;
+
+struct RideSpatialIndexEntry
+{
+    ride_id_t Ride;
+    uint64_t Tiles;
+};
+
+struct RideSpatialIndexChunk
+{
+    std::vector<RideSpatialIndexEntry> Entries;
+    bool Dirty = true;
+};
+
+static std::array<RideSpatialIndexChunk, RIDE_SPATIAL_INDEX_CHUNK_COUNT> _rideSpatialIndexChunks;
+static std::vector<int32_t> _rideSpatialIndexDirtyChunks;
+static std::bitset<MAX_RIDES> _rideSpatialIndexDirtyRides;
+static bool _rideSpatialIndexInvalidated = true;
+
+struct RideSpatialIndexState
+{
+    std::array<RideSpatialIndexChunk, RIDE_SPATIAL_INDEX_CHUNK_COUNT> Chunks;
+    std::vector<int32_t> DirtyChunks;
+    std::bitset<MAX_RIDES> DirtyRides;
+    bool Invalidated = true;
+};
+
+static void ride_spatial_index_mark_chunk_dirty(int32_t chunkIndex)
+{
+    auto& chunk = _rideSpatialIndexChunks[chunkIndex];
+    if (!chunk.Dirty)
+    {
+        chunk.Dirty = true;
+        _rideSpatialIndexDirtyChunks.push_back(chunkIndex);
+    }
+}
+
+static void ride_spatial_index_rebuild_chunk(int32_t chunkIndex)
+{
+    auto& chunk = _rideSpatialIndexChunks[chunkIndex];
+    chunk.Entries.clear();
+    chunk.Dirty = false;
+
+    int32_t chunkX = (chunkIndex % RIDE_SPATIAL_INDEX_CHUNKS_PER_SIDE) << RIDE_SPATIAL_INDEX_CHUNK_SHIFT;
+    int32_t chunkY = (chunkIndex / RIDE_SPATIAL_INDEX_CHUNKS_PER_SIDE) << RIDE_SPATIAL_INDEX_CHUNK_SHIFT;
+    for (int32_t y = 0; y < RIDE_SPATIAL_INDEX_CHUNK_SIZE; y++)
+    {
+        for (int32_t x = 0; x < RIDE_SPATIAL_INDEX_CHUNK_SIZE; x++)
+        {
+            const TileElement* tileElement = map_get_first_element_at(chunkX + x, chunkY + y);
+            if (tileElement == nullptr)
+            {
+                continue;
+            }
+
+            uint64_t tileBit = 1ULL << (y * RIDE_SPATIAL_INDEX_CHUNK_SIZE + x);
+            do
+            {
+                if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
+                    continue;
+
+                ride_id_t rideIndex = tileElement->AsTrack()->GetRideIndex();
+                auto it = std::find_if(chunk.Entries.begin(), chunk.Entries.end(), [rideIndex](const auto& entry) {
+                    return entry.Ride == rideIndex;
+                });
+                if (it == chunk.Entries.end())
+                {
+                    chunk.Entries.push_back({ rideIndex, tileBit });
+                }
+                else
+                {
+                    it->Tiles |= tileBit;
+                }
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+}
+
+static void ride_spatial_index_refresh()
+{
+    if (_rideSpatialIndexInvalidated)
+    {
+        for (int32_t i = 0; i < RIDE_SPATIAL_INDEX_CHUNK_COUNT; i++)
+        {
+            ride_spatial_index_rebuild_chunk(i);
+        }
+        _rideSpatialIndexDirtyChunks.clear();
+        _rideSpatialIndexDirtyRides.reset();
+        _rideSpatialIndexInvalidated = false;
+        return;
+    }
+
+    if (_rideSpatialIndexDirtyRides.any())
+    {
+        for (int32_t i = 0; i < RIDE_SPATIAL_INDEX_CHUNK_COUNT; i++)
+        {
+            for (const auto& entry : _rideSpatialIndexChunks[i].Entries)
+            {
+                if (entry.Ride < MAX_RIDES && _rideSpatialIndexDirtyRides[entry.Ride])
+                {
+                    ride_spatial_index_mark_chunk_dirty(i);
+                    break;
+                }
+            }
+        }
+        _rideSpatialIndexDirtyRides.reset();
+    }
+
+    for (int32_t chunkIndex : _rideSpatialIndexDirtyChunks)
+    {
+        ride_spatial_index_rebuild_chunk(chunkIndex);
+    }
+    _rideSpatialIndexDirtyChunks.clear();
+}
+
+/**
+ * Gets the rides that have track on any tile within the given inclusive range of tile coordinates.
+ */
+std::bitset<MAX_RIDES> ride_spatial_index_get_rides_in_area(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    std::bitset<MAX_RIDES> rides;
+
+    left = std::max(left, 0);
+    top = std::max(top, 0);
+    right = std::min(right, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    bottom = std::min(bottom, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    if (left > right || top > bottom)
+    {
+        return rides;
+    }
+
+    ride_spatial_index_refresh();
+
+    for (int32_t chunkY = top >> RIDE_SPATIAL_INDEX_CHUNK_SHIFT; chunkY <= bottom >> RIDE_SPATIAL_INDEX_CHUNK_SHIFT; chunkY++)
+    {
+        for (int32_t chunkX = left >> RIDE_SPATIAL_INDEX_CHUNK_SHIFT; chunkX <= right >> RIDE_SPATIAL_INDEX_CHUNK_SHIFT;
+             chunkX++)
+        {
+            // Mask of the tiles within this chunk that are inside the area
+            int32_t originX = chunkX << RIDE_SPATIAL_INDEX_CHUNK_SHIFT;
+            int32_t originY = chunkY << RIDE_SPATIAL_INDEX_CHUNK_SHIFT;
+            int32_t x0 = std::max(left - originX, 0);
+            int32_t x1 = std::min(right - originX, RIDE_SPATIAL_INDEX_CHUNK_SIZE - 1);
+            int32_t y0 = std::max(top - originY, 0);
+            int32_t y1 = std::min(bottom - originY, RIDE_SPATIAL_INDEX_CHUNK_SIZE - 1);
+            uint64_t rowMask = ((1ULL << (x1 - x0 + 1)) - 1) << x0;
+            uint64_t areaMask = 0;
+            for (int32_t y = y0; y <= y1; y++)
+            {
+                areaMask |= rowMask << (y * RIDE_SPATIAL_INDEX_CHUNK_SIZE);
+            }
+
+            const auto& chunk = _rideSpatialIndexChunks[chunkY * RIDE_SPATIAL_INDEX_CHUNKS_PER_SIDE + chunkX];
+            for (const auto& entry : chunk.Entries)
+            {
+                if ((entry.Tiles & areaMask) && entry.Ride < MAX_RIDES)
+                {
+                    rides[entry.Ride] = true;
+                }
+            }
+        }
+    }
+    return rides;
+}
+
+/**
+ * Marks the chunk containing the given tile as needing to be rebuilt, e.g. because an element was inserted on it.
+ */
+void ride_spatial_index_invalidate_tile(int32_t x, int32_t y)
+{
+    if (_rideSpatialIndexInvalidated || x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        return;
+    }
+
+    int32_t chunkX = x >> RIDE_SPATIAL_INDEX_CHUNK_SHIFT;
+    int32_t chunkY = y >> RIDE_SPATIAL_INDEX_CHUNK_SHIFT;
+    ride_spatial_index_mark_chunk_dirty(chunkY * RIDE_SPATIAL_INDEX_CHUNKS_PER_SIDE + chunkX);
+}
+
+/**
+ * Marks every chunk the ride has track in as needing to be rebuilt, for when a piece is removed and its tile is not known.
+ */
+void ride_spatial_index_invalidate_ride(ride_id_t rideIndex)
+{
+    if (rideIndex < MAX_RIDES)
+    {
+        _rideSpatialIndexDirtyRides[rideIndex] = true;
+    }
+}
+
+void ride_spatial_index_invalidate_all()
+{
+    _rideSpatialIndexInvalidated = true;
+}
+
+/**
+ * Exchanges the index with the one put aside by map_swap_storage.
+ */
+void ride_spatial_index_swap_state()
+{
+    static RideSpatialIndexState stashedState;
+    std::swap(_rideSpatialIndexChunks, stashedState.Chunks);
+    std::swap(_rideSpatialIndexDirtyChunks, stashedState.DirtyChunks);
+    std::swap(_rideSpatialIndexDirtyRides, stashedState.DirtyRides);
+    std::swap(_rideSpatialIndexInvalidated, stashedState.Invalidated);
+}
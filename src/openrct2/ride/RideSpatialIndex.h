@@ -0,0 +1,21 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Ride.h"
+
+#include <bitset>
+
+std::bitset<MAX_RIDES> ride_spatial_index_get_rides_in_area(int32_t left, int32_t top, int32_t right, int32_t bottom);
+void ride_spatial_index_invalidate_tile(int32_t x, int32_t y);
+void ride_spatial_index_invalidate_ride(ride_id_t rideIndex);
+void ride_spatial_index_invalidate_all();
+void ride_spatial_index_swap_state();
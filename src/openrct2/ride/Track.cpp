@@ -593,6 +593,28 @@ const rct_track_coordinates* get_track_coord_from_ride(Ride* ride, int32_t track
                                                                     : &TrackCoordinates[trackType];
 }
 
+/**
+ * Gets the offset of the given block of a track piece from the piece's origin, rotated to the given direction.
+ */
+CoordsXY get_track_block_offset_from_ride(Ride* ride, int32_t trackType, int32_t sequence, int32_t direction)
+{
+    const auto& offsets = ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_FLAT_RIDE) ? FlatRideTrackBlockOffsets
+                                                                                   : TrackBlockOffsets;
+    const auto& offset = offsets[trackType & 0xFF][sequence & (TRACK_BLOCK_MAX_SEQUENCES - 1)][direction & 3];
+    return { offset.x, offset.y };
+}
+
+/**
+ * Gets the offset of the end of a track piece from the piece's origin, rotated to the given direction.
+ */
+CoordsXY get_track_coord_offset_from_ride(Ride* ride, int32_t trackType, int32_t direction)
+{
+    const auto& offsets = ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_FLAT_RIDE) ? FlatTrackCoordinateOffsets
+                                                                                   : TrackCoordinateOffsets;
+    const auto& offset = offsets[trackType & 0xFF][direction & 3];
+    return { offset.x, offset.y };
+}
+
 const rct_preview_track* get_track_def_from_ride_index(ride_id_t rideIndex, int32_t trackType)
 {
     return get_track_def_from_ride(get_ride(rideIndex), trackType);
@@ -1030,56 +1052,21 @@ static money32 track_remove(
     trackBlock += tileElement->AsTrack()->GetSequenceIndex();
 
     uint8_t originDirection = tileElement->GetDirection();
-    switch (originDirection)
-    {
-        case 0:
-            originX -= trackBlock->x;
-            originY -= trackBlock->y;
-            break;
-        case 1:
-            originX -= trackBlock->y;
-            originY += trackBlock->x;
-            break;
-        case 2:
-            originX += trackBlock->x;
-            originY += trackBlock->y;
-            break;
-        case 3:
-            originX += trackBlock->y;
-            originY -= trackBlock->x;
-            break;
-    }
-
+    auto blockOffset = get_track_block_offset_from_ride(
+        ride, type, tileElement->AsTrack()->GetSequenceIndex(), originDirection);
+    originX -= blockOffset.x;
+    originY -= blockOffset.y;
     originZ -= trackBlock->z;
 
     money32 cost = 0;
 
     trackBlock = get_track_def_from_ride(ride, type);
-    for (; trackBlock->index != 255; trackBlock++)
+    for (int32_t blockIndex = 0; trackBlock->index != 255; trackBlock++, blockIndex++)
     {
-        int16_t x = originX, y = originY, z = originZ;
-
-        switch (originDirection)
-        {
-            case 0:
-                x += trackBlock->x;
-                y += trackBlock->y;
-                break;
-            case 1:
-                x += trackBlock->y;
-                y -= trackBlock->x;
-                break;
-            case 2:
-                x -= trackBlock->x;
-                y -= trackBlock->y;
-                break;
-            case 3:
-                x -= trackBlock->y;
-                y += trackBlock->x;
-                break;
-        }
-
-        z += trackBlock->z;
+        blockOffset = get_track_block_offset_from_ride(ride, type, blockIndex, originDirection);
+        int16_t x = originX + blockOffset.x;
+        int16_t y = originY + blockOffset.y;
+        int16_t z = originZ + trackBlock->z;
 
         map_invalidate_tile_full(x, y);
 
@@ -528,6 +528,8 @@ int32_t track_is_connected_by_shape(TileElement* a, TileElement* b);
 const rct_preview_track* get_track_def_from_ride(Ride* ride, int32_t trackType);
 const rct_preview_track* get_track_def_from_ride_index(ride_id_t rideIndex, int32_t trackType);
 const rct_track_coordinates* get_track_coord_from_ride(Ride* ride, int32_t trackType);
+CoordsXY get_track_block_offset_from_ride(Ride* ride, int32_t trackType, int32_t sequence, int32_t direction);
+CoordsXY get_track_coord_offset_from_ride(Ride* ride, int32_t trackType, int32_t direction);
 
 void track_circuit_iterator_begin(track_circuit_iterator* it, CoordsXYE first);
 bool track_circuit_iterator_previous(track_circuit_iterator* it);
@@ -0,0 +1,276 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackCircuit.h"
+
+#include "../world/Map.h"
+#include "Track.h"
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Vehicles look up the track piece they are on, and the piece they move on to, every time they cross from one piece to
+// another. Each ride keeps the pieces it has resolved so far along with their links to the next and previous pieces, so
+// after the first lap a vehicle only has to follow indices instead of scanning the tile element lists again. Tile element
+// pointers move whenever elements are inserted on or removed from their tile, and the links change when track is edited
+// in place, so each tile remembers which circuits have pieces on it and those circuits are dropped when the tile changes.
+
+constexpr int32_t TRACK_CIRCUIT_UNRESOLVED = -1;
+
+struct TrackCircuitPiece
+{
+    TileElement* Element;
+    int32_t X;
+    int32_t Y;
+
+    int32_t Next = TRACK_CIRCUIT_UNRESOLVED;
+    int32_t NextZ = 0;
+    int32_t NextDirection = 0;
+
+    int32_t Previous = TRACK_CIRCUIT_UNRESOLVED;
+    track_begin_end PreviousBeginEnd = {};
+};
+
+struct TrackCircuit
+{
+    uint32_t Generation = 0;
+    uint8_t RideType = RIDE_TYPE_NULL;
+    std::vector<TrackCircuitPiece> Pieces;
+    std::unordered_map<uint64_t, int32_t> PiecesByLocation;
+    std::unordered_map<const TileElement*, int32_t> PiecesByElement;
+};
+
+static std::array<TrackCircuit, MAX_RIDES> _trackCircuits;
+static uint32_t _trackCircuitGeneration = 1;
+// Rides that have resolved pieces on each tile, entries of circuits that have since been dropped are left behind
+static std::unordered_map<int32_t, std::vector<ride_id_t>> _trackCircuitRidesByTile;
+
+struct TrackCircuitState
+{
+    std::array<TrackCircuit, MAX_RIDES> Circuits;
+    uint32_t Generation = 1;
+    std::unordered_map<int32_t, std::vector<ride_id_t>> RidesByTile;
+};
+
+static TrackCircuit* track_circuit_get(ride_id_t rideIndex)
+{
+    if (rideIndex >= MAX_RIDES)
+    {
+        return nullptr;
+    }
+
+    auto& circuit = _trackCircuits[rideIndex];
+    uint8_t rideType = get_ride(rideIndex)->type;
+    if (circuit.Generation != _trackCircuitGeneration || circuit.RideType != rideType)
+    {
+        circuit.Pieces.clear();
+        circuit.PiecesByLocation.clear();
+        circuit.PiecesByElement.clear();
+        circuit.Generation = _trackCircuitGeneration;
+        circuit.RideType = rideType;
+    }
+    return &circuit;
+}
+
+static uint64_t track_circuit_location_key(int32_t x, int32_t y, int32_t z, int32_t trackType)
+{
+    return ((uint64_t)(uint16_t)x << 40) | ((uint64_t)(uint16_t)y << 24) | ((uint64_t)(uint8_t)z << 16) | (uint16_t)trackType;
+}
+
+static void track_circuit_add_tile(ride_id_t rideIndex, int32_t x, int32_t y)
+{
+    auto& rides = _trackCircuitRidesByTile[(y / 32) * MAXIMUM_MAP_SIZE_TECHNICAL + (x / 32)];
+    if (std::find(rides.begin(), rides.end(), rideIndex) == rides.end())
+    {
+        rides.push_back(rideIndex);
+    }
+}
+
+static int32_t track_circuit_get_or_add_piece(
+    ride_id_t rideIndex, TrackCircuit& circuit, TileElement* tileElement, int32_t x, int32_t y)
+{
+    auto it = circuit.PiecesByElement.find(tileElement);
+    if (it != circuit.PiecesByElement.end())
+    {
+        return it->second;
+    }
+
+    TrackCircuitPiece piece;
+    piece.Element = tileElement;
+    piece.X = x;
+    piece.Y = y;
+
+    int32_t index = (int32_t)circuit.Pieces.size();
+    circuit.Pieces.push_back(piece);
+    circuit.PiecesByElement[tileElement] = index;
+    track_circuit_add_tile(rideIndex, x, y);
+    return index;
+}
+
+/**
+ * Finds the piece of track a vehicle is on, the same as map_get_track_element_at_of_type_seq with sequence 0.
+ */
+TileElement* track_circuit_get_element(ride_id_t rideIndex, int32_t x, int32_t y, int32_t z, int32_t trackType)
+{
+    auto circuitPtr = track_circuit_get(rideIndex);
+    if (circuitPtr == nullptr)
+    {
+        return map_get_track_element_at_of_type_seq(x, y, z, trackType, 0);
+    }
+
+    auto& circuit = *circuitPtr;
+    uint64_t key = track_circuit_location_key(x, y, z, trackType);
+    auto it = circuit.PiecesByLocation.find(key);
+    if (it != circuit.PiecesByLocation.end())
+    {
+        return circuit.Pieces[it->second].Element;
+    }
+
+    TileElement* tileElement = map_get_track_element_at_of_type_seq(x, y, z, trackType, 0);
+    if (tileElement != nullptr && tileElement->AsTrack()->GetRideIndex() == rideIndex)
+    {
+        circuit.PiecesByLocation[key] = track_circuit_get_or_add_piece(rideIndex, circuit, tileElement, x, y);
+    }
+    return tileElement;
+}
+
+/**
+ * Same as track_block_get_next, resolving the link once per piece. Track ends are not remembered so that pieces built
+ * on to them later are found.
+ */
+bool track_circuit_get_next(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32_t* direction)
+{
+    ride_id_t rideIndex = input->element->AsTrack()->GetRideIndex();
+    auto circuitPtr = track_circuit_get(rideIndex);
+    if (circuitPtr == nullptr)
+    {
+        return track_block_get_next(input, output, z, direction);
+    }
+
+    auto& circuit = *circuitPtr;
+    auto it = circuit.PiecesByElement.find(input->element);
+    if (it == circuit.PiecesByElement.end() || circuit.Pieces[it->second].X != input->x
+        || circuit.Pieces[it->second].Y != input->y)
+    {
+        return track_block_get_next(input, output, z, direction);
+    }
+
+    int32_t pieceIndex = it->second;
+    if (circuit.Pieces[pieceIndex].Next == TRACK_CIRCUIT_UNRESOLVED)
+    {
+        // Input and output are allowed to be the same, so only the piece index is used after this
+        if (!track_block_get_next(input, output, z, direction))
+        {
+            return false;
+        }
+
+        int32_t nextIndex = track_circuit_get_or_add_piece(rideIndex, circuit, output->element, output->x, output->y);
+        auto& piece = circuit.Pieces[pieceIndex];
+        piece.Next = nextIndex;
+        piece.NextZ = *z;
+        piece.NextDirection = *direction;
+        return true;
+    }
+
+    const auto& piece = circuit.Pieces[pieceIndex];
+    const auto& nextPiece = circuit.Pieces[piece.Next];
+    output->x = nextPiece.X;
+    output->y = nextPiece.Y;
+    output->element = nextPiece.Element;
+    *z = piece.NextZ;
+    *direction = piece.NextDirection;
+    return true;
+}
+
+/**
+ * Same as track_block_get_previous, resolving the link once per piece.
+ */
+bool track_circuit_get_previous(int32_t x, int32_t y, TileElement* tileElement, track_begin_end* outTrackBeginEnd)
+{
+    ride_id_t rideIndex = tileElement->AsTrack()->GetRideIndex();
+    auto circuitPtr = track_circuit_get(rideIndex);
+    if (circuitPtr == nullptr)
+    {
+        return track_block_get_previous(x, y, tileElement, outTrackBeginEnd);
+    }
+
+    auto& circuit = *circuitPtr;
+    auto it = circuit.PiecesByElement.find(tileElement);
+    if (it == circuit.PiecesByElement.end() || circuit.Pieces[it->second].X != x || circuit.Pieces[it->second].Y != y)
+    {
+        return track_block_get_previous(x, y, tileElement, outTrackBeginEnd);
+    }
+
+    int32_t pieceIndex = it->second;
+    if (circuit.Pieces[pieceIndex].Previous == TRACK_CIRCUIT_UNRESOLVED)
+    {
+        if (!track_block_get_previous(x, y, tileElement, outTrackBeginEnd))
+        {
+            return false;
+        }
+
+        int32_t previousIndex = track_circuit_get_or_add_piece(
+            rideIndex, circuit, outTrackBeginEnd->begin_element, outTrackBeginEnd->begin_x, outTrackBeginEnd->begin_y);
+        auto& piece = circuit.Pieces[pieceIndex];
+        piece.Previous = previousIndex;
+        piece.PreviousBeginEnd = *outTrackBeginEnd;
+        return true;
+    }
+
+    *outTrackBeginEnd = circuit.Pieces[pieceIndex].PreviousBeginEnd;
+    return true;
+}
+
+/**
+ * Drops the circuits of all rides that have pieces on the tile at the given tile coordinates, for when the elements of
+ * the tile have been moved or edited.
+ */
+void track_circuit_invalidate_tile(int32_t x, int32_t y)
+{
+    auto it = _trackCircuitRidesByTile.find(y * MAXIMUM_MAP_SIZE_TECHNICAL + x);
+    if (it == _trackCircuitRidesByTile.end())
+    {
+        return;
+    }
+
+    for (ride_id_t rideIndex : it->second)
+    {
+        track_circuit_invalidate_ride(rideIndex);
+    }
+    _trackCircuitRidesByTile.erase(it);
+}
+
+void track_circuit_invalidate_ride(ride_id_t rideIndex)
+{
+    if (rideIndex < MAX_RIDES)
+    {
+        // Generations start at 1, so the circuit is cleared the next time it is used
+        _trackCircuits[rideIndex].Generation = 0;
+    }
+}
+
+void track_circuit_invalidate_all()
+{
+    _trackCircuitGeneration++;
+    _trackCircuitRidesByTile.clear();
+}
+
+/**
+ * Exchanges the circuits with the ones put aside by map_swap_storage.
+ */
+void track_circuit_swap_state()
+{
+    static TrackCircuitState stashedState;
+    std::swap(_trackCircuits, stashedState.Circuits);
+    std::swap(_trackCircuitGeneration, stashedState.Generation);
+    std::swap(_trackCircuitRidesByTile, stashedState.RidesByTile);
+}
@@ -0,0 +1,21 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Ride.h"
+
+TileElement* track_circuit_get_element(ride_id_t rideIndex, int32_t x, int32_t y, int32_t z, int32_t trackType);
+bool track_circuit_get_next(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32_t* direction);
+bool track_circuit_get_previous(int32_t x, int32_t y, TileElement* tileElement, track_begin_end* outTrackBeginEnd);
+void track_circuit_invalidate_tile(int32_t x, int32_t y);
+void track_circuit_invalidate_ride(ride_id_t rideIndex);
+void track_circuit_invalidate_all();
+void track_circuit_swap_state();
@@ -15,7 +15,7 @@
 #include <iterator>
 
 // clang-format off
-const rct_track_coordinates FlatTrackCoordinates[] = {
+constexpr const rct_track_coordinates FlatTrackCoordinates[] = {
     {    0,    0,    0,    0,    0,    0 },
     {    0,    0,    0,    0,    0,    0 },
     {    0,    0,    0,    0,    0,    0 },
@@ -271,7 +271,7 @@ const rct_track_coordinates FlatTrackCoordinates[] = {
     {    0,    1,   96,    0,    0,  -32 },
 };
 
-const rct_track_coordinates TrackCoordinates[256] = {
+constexpr const rct_track_coordinates TrackCoordinates[256] = {
         { 0, 0, 0, 0, 0, 0 },       // ELEM_FLAT
         { 0, 0, 0, 0, 0, 0 },       // ELEM_END_STATION
         { 0, 0, 0, 0, 0, 0 },       // ELEM_BEGIN_STATION
@@ -3032,7 +3032,7 @@ static constexpr const rct_preview_track TrackBlocks255[] = {
 };
 
 // rct2: 0x00994638
-const rct_preview_track *TrackBlocks[256] = {
+constexpr const rct_preview_track *TrackBlocks[256] = {
     TrackBlocks000,
     TrackBlocks001,
     TrackBlocks002,
@@ -5204,7 +5204,7 @@ static constexpr const rct_preview_track FlatRideTrackBlocks255[] = {
 };
 
 // rct2: 0x00994A38
-const rct_preview_track *FlatRideTrackBlocks[256] = {
+constexpr const rct_preview_track *FlatRideTrackBlocks[256] = {
     FlatRideTrackBlocks000,
     FlatRideTrackBlocks001,
     FlatRideTrackBlocks002,
@@ -5463,6 +5463,62 @@ const rct_preview_track *FlatRideTrackBlocks[256] = {
     FlatRideTrackBlocks255
 };
 
+static constexpr TrackRotatedOffset RotateTrackOffset(int16_t x, int16_t y, int32_t direction)
+{
+    switch (direction)
+    {
+        default:
+        case 0:
+            return { x, y };
+        case 1:
+            return { y, (int16_t)-x };
+        case 2:
+            return { (int16_t)-x, (int16_t)-y };
+        case 3:
+            return { (int16_t)-y, x };
+    }
+}
+
+template<size_t TCount>
+static constexpr TrackBlockOffsetTable CreateTrackBlockOffsetTable(const rct_preview_track* const (&trackBlocks)[TCount])
+{
+    TrackBlockOffsetTable table{};
+    for (size_t trackType = 0; trackType < TCount; trackType++)
+    {
+        const rct_preview_track* trackBlock = trackBlocks[trackType];
+        for (size_t sequence = 0; sequence < TRACK_BLOCK_MAX_SEQUENCES && trackBlock[sequence].index != 255; sequence++)
+        {
+            for (int32_t direction = 0; direction < 4; direction++)
+            {
+                const auto& block = trackBlock[sequence];
+                table[trackType][sequence][direction] = RotateTrackOffset(block.x, block.y, direction);
+            }
+        }
+    }
+    return table;
+}
+
+template<size_t TCount>
+static constexpr TrackCoordinateOffsetTable CreateTrackCoordinateOffsetTable(
+    const rct_track_coordinates (&trackCoordinates)[TCount])
+{
+    TrackCoordinateOffsetTable table{};
+    for (size_t trackType = 0; trackType < TCount; trackType++)
+    {
+        for (int32_t direction = 0; direction < 4; direction++)
+        {
+            const auto& coordinates = trackCoordinates[trackType];
+            table[trackType][direction] = RotateTrackOffset(coordinates.x, coordinates.y, direction);
+        }
+    }
+    return table;
+}
+
+constexpr TrackBlockOffsetTable TrackBlockOffsets = CreateTrackBlockOffsetTable(TrackBlocks);
+constexpr TrackBlockOffsetTable FlatRideTrackBlockOffsets = CreateTrackBlockOffsetTable(FlatRideTrackBlocks);
+constexpr TrackCoordinateOffsetTable TrackCoordinateOffsets = CreateTrackCoordinateOffsetTable(TrackCoordinates);
+constexpr TrackCoordinateOffsetTable FlatTrackCoordinateOffsets = CreateTrackCoordinateOffsetTable(FlatTrackCoordinates);
+
 const uint8_t TrackPieceLengths[256] = {
     32,     // TRACK_ELEM_FLAT
     32,     // TRACK_ELEM_END_STATION
@@ -13,6 +13,8 @@
 #include "Track.h"
 #include "TrackPaint.h"
 
+#include <array>
+
 // 0x009968BB, 0x009968BC, 0x009968BD, 0x009968BF, 0x009968C1, 0x009968C3
 extern const rct_track_coordinates TrackCoordinates[256];
 // 0x009972BB, 0x009972BC, 0x009972BD, 0x009972BF, 0x009972C1, 0x009972C3
@@ -22,8 +24,28 @@ extern const uint8_t TrackSequenceProperties[256][16];
 extern const uint8_t FlatRideTrackSequenceProperties[256][16];
 
 extern const uint64_t RideTypePossibleTrackConfigurations[RIDE_TYPE_COUNT];
-extern const rct_preview_track* TrackBlocks[256];
-extern const rct_preview_track* FlatRideTrackBlocks[256];
+extern const rct_preview_track* const TrackBlocks[256];
+extern const rct_preview_track* const FlatRideTrackBlocks[256];
+
+#define TRACK_BLOCK_MAX_SEQUENCES 16
+
+struct TrackRotatedOffset
+{
+    int16_t x;
+    int16_t y;
+};
+
+// Offsets of the blocks of each track piece relative to its origin, [trackType][sequence][direction]
+using TrackBlockOffsetTable = std::array<std::array<std::array<TrackRotatedOffset, 4>, TRACK_BLOCK_MAX_SEQUENCES>, 256>;
+// Offsets of the end of each track piece relative to its origin, [trackType][direction]
+using TrackCoordinateOffsetTable = std::array<std::array<TrackRotatedOffset, 4>, 256>;
+
+// Rotated copies of the x and y of TrackBlocks and TrackCoordinates, generated at compile time so track traversal does not
+// have to switch on the direction.
+extern const TrackBlockOffsetTable TrackBlockOffsets;
+extern const TrackBlockOffsetTable FlatRideTrackBlockOffsets;
+extern const TrackCoordinateOffsetTable TrackCoordinateOffsets;
+extern const TrackCoordinateOffsetTable FlatTrackCoordinateOffsets;
 
 extern const uint8_t TrackPieceLengths[256];
 
@@ -44,23 +44,25 @@
 #include "Ride.h"
 #include "RideData.h"
 #include "Track.h"
+#include "TrackCircuit.h"
 #include "TrackData.h"
 #include "TrackDesignRepository.h"
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 
 struct map_backup
 {
-    TileElement tile_elements[MAX_TILE_ELEMENTS];
-    TileElement* tile_pointers[MAX_TILE_TILE_ELEMENT_POINTERS];
-    TileElement* next_free_tile_element;
-    uint16_t map_size_units;
-    uint16_t map_size_units_minus_2;
-    uint16_t map_size;
+    MapStorage storage;
     uint8_t current_rotation;
 };
 
+// Previews are placed and drawn on this private world, so the park's tile elements are never copied or cleared
+static std::unique_ptr<TileElement[]> _previewTileElements;
+static std::unique_ptr<TileElement*[]> _previewTileElementTilePointers;
+static TileElementChunkList _previewTileElementChunks;
+
 rct_track_td6* gActiveTrackDesign;
 bool gTrackDesignSceneryToggle;
 LocationXYZ16 gTrackPreviewMin;
@@ -82,9 +84,9 @@ static bool _trackDesignPlaceStatePlaceScenery = true;
 
 static rct_track_td6* track_design_open_from_buffer(uint8_t* src, size_t srcLength);
 
-static map_backup* track_design_preview_backup_map();
+static map_backup track_design_preview_backup_map();
 
-static void track_design_preview_restore_map(map_backup* backup);
+static void track_design_preview_restore_map(const map_backup& backup);
 
 static void track_design_preview_clear_map();
 
@@ -1324,11 +1326,11 @@ static int32_t track_design_place_maze(rct_track_td6* td6, int16_t x, int16_t y,
             {
                 continue;
             }
-            if (mapCoord.x >= 256 * 32)
+            if (mapCoord.x >= MAXIMUM_MAP_SIZE_BIG)
             {
                 continue;
             }
-            if (mapCoord.y >= 256 * 32)
+            if (mapCoord.y >= MAXIMUM_MAP_SIZE_BIG)
             {
                 continue;
             }
@@ -1377,8 +1379,9 @@ static int32_t track_design_place_maze(rct_track_td6* td6, int16_t x, int16_t y,
 
 static bool track_design_place_ride(rct_track_td6* td6, int16_t x, int16_t y, int16_t z, Ride* ride)
 {
-    const rct_preview_track** trackBlockArray = (ride_type_has_flag(td6->type, RIDE_TYPE_FLAG_HAS_TRACK)) ? TrackBlocks
-                                                                                                          : FlatRideTrackBlocks;
+    bool hasTrack = ride_type_has_flag(td6->type, RIDE_TYPE_FLAG_HAS_TRACK);
+    const rct_preview_track* const* trackBlockArray = hasTrack ? TrackBlocks : FlatRideTrackBlocks;
+    const TrackBlockOffsetTable& trackBlockOffsets = hasTrack ? TrackBlockOffsets : FlatRideTrackBlockOffsets;
 
     gTrackPreviewOrigin.x = x;
     gTrackPreviewOrigin.y = y;
@@ -1411,10 +1414,10 @@ static bool track_design_place_ride(rct_track_td6* td6, int16_t x, int16_t y, in
         switch (_trackDesignPlaceOperation)
         {
             case PTD_OPERATION_DRAW_OUTLINES:
-                for (const rct_preview_track* trackBlock = trackBlockArray[trackType]; trackBlock->index != 0xFF; trackBlock++)
+                for (int32_t sequence = 0; trackBlockArray[trackType][sequence].index != 0xFF; sequence++)
                 {
-                    LocationXY16 tile = { x, y };
-                    map_offset_with_rotation(&tile.x, &tile.y, trackBlock->x, trackBlock->y, rotation);
+                    const auto& blockOffset = trackBlockOffsets[trackType][sequence][rotation & 3];
+                    LocationXY16 tile = { (int16_t)(x + blockOffset.x), (int16_t)(y + blockOffset.y) };
                     track_design_update_max_min_coordinates(tile.x, tile.y, z);
                     track_design_add_selection_tile(tile.x, tile.y);
                 }
@@ -1491,13 +1494,12 @@ static bool track_design_place_ride(rct_track_td6* td6, int16_t x, int16_t y, in
             case PTD_OPERATION_GET_PLACE_Z:
             {
                 int32_t tempZ = z - TrackCoordinates[trackType].z_begin;
-                for (const rct_preview_track* trackBlock = trackBlockArray[trackType]; trackBlock->index != 0xFF; trackBlock++)
+                const rct_preview_track* trackBlock = trackBlockArray[trackType];
+                for (int32_t sequence = 0; trackBlock->index != 0xFF; trackBlock++, sequence++)
                 {
-                    int16_t tmpX = x;
-                    int16_t tmpY = y;
-                    map_offset_with_rotation(&tmpX, &tmpY, trackBlock->x, trackBlock->y, rotation);
-                    CoordsXY tile = { tmpX, tmpY };
-                    if (tile.x < 0 || tile.y < 0 || tile.x >= (256 * 32) || tile.y >= (256 * 32))
+                    const auto& blockOffset = trackBlockOffsets[trackType][sequence][rotation & 3];
+                    CoordsXY tile = { (int16_t)(x + blockOffset.x), (int16_t)(y + blockOffset.y) };
+                    if (tile.x < 0 || tile.y < 0 || tile.x >= MAXIMUM_MAP_SIZE_BIG || tile.y >= MAXIMUM_MAP_SIZE_BIG)
                     {
                         continue;
                     }
@@ -2197,12 +2199,8 @@ void game_command_place_maze_design(
  */
 void track_design_draw_preview(rct_track_td6* td6, uint8_t* pixels)
 {
-    // Make a copy of the map
-    map_backup* mapBackup = track_design_preview_backup_map();
-    if (mapBackup == nullptr)
-    {
-        return;
-    }
+    // Switch to the preview world
+    map_backup mapBackup = track_design_preview_backup_map();
     track_design_preview_clear_map();
 
     if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
@@ -2304,41 +2302,41 @@ void track_design_draw_preview(rct_track_td6* td6, uint8_t* pixels)
 }
 
 /**
- * Create a backup of the map as it will be cleared for drawing the track
- * design preview.
+ * Swaps the park's map out for the private preview world, which is cleared
+ * before the track design preview is placed on it.
  *  rct2: 0x006D1C68
  */
-static map_backup* track_design_preview_backup_map()
+static map_backup track_design_preview_backup_map()
 {
-    map_backup* backup = (map_backup*)malloc(sizeof(map_backup));
-    if (backup != nullptr)
+    if (_previewTileElements == nullptr)
     {
-        std::memcpy(backup->tile_elements, gTileElements, sizeof(backup->tile_elements));
-        std::memcpy(backup->tile_pointers, gTileElementTilePointers, sizeof(backup->tile_pointers));
-        backup->next_free_tile_element = gNextFreeTileElement;
-        backup->map_size_units = gMapSizeUnits;
-        backup->map_size_units_minus_2 = gMapSizeMinus2;
-        backup->map_size = gMapSize;
-        backup->current_rotation = get_current_rotation();
+        _previewTileElements = std::make_unique<TileElement[]>(MAX_TILE_TILE_ELEMENT_POINTERS * 3);
+        _previewTileElementTilePointers = std::make_unique<TileElement*[]>(MAX_TILE_TILE_ELEMENT_POINTERS);
     }
+
+    MapStorage previewStorage = {};
+    previewStorage.TileElements = _previewTileElements.get();
+    previewStorage.TileElementPointers = _previewTileElementTilePointers.get();
+    previewStorage.TileElementChunks = &_previewTileElementChunks;
+    previewStorage.NextFreeTileElement = _previewTileElements.get();
+    previewStorage.MapSizeUnits = gMapSizeUnits;
+    previewStorage.MapSizeMinus2 = gMapSizeMinus2;
+    previewStorage.MapSize = gMapSize;
+
+    map_backup backup;
+    backup.current_rotation = get_current_rotation();
+    backup.storage = map_swap_storage(previewStorage);
     return backup;
 }
 
 /**
- * Restores the map from a backup.
+ * Swaps the park's map back in.
  *  rct2: 0x006D2378
  */
-static void track_design_preview_restore_map(map_backup* backup)
+static void track_design_preview_restore_map(const map_backup& backup)
 {
-    std::memcpy(gTileElements, backup->tile_elements, sizeof(backup->tile_elements));
-    std::memcpy(gTileElementTilePointers, backup->tile_pointers, sizeof(backup->tile_pointers));
-    gNextFreeTileElement = backup->next_free_tile_element;
-    gMapSizeUnits = backup->map_size_units;
-    gMapSizeMinus2 = backup->map_size_units_minus_2;
-    gMapSize = backup->map_size;
-    gCurrentRotation = backup->current_rotation;
-
-    free(backup);
+    map_swap_storage(backup.storage);
+    gCurrentRotation = backup.current_rotation;
 }
 
 /**
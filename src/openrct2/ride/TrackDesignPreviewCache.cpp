@@ -0,0 +1,364 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackDesignPreviewCache.h"
+
+#include "../Cheats.h"
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../PlatformEnvironment.h"
+#include "../Version.h"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/FileStream.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../management/Research.h"
+#include "../object/ObjectList.h"
+#include "../platform/platform.h"
+#include "../world/Park.h"
+#include "TrackDesign.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+using namespace OpenRCT2;
+
+constexpr uint32_t TRACK_PREVIEW_CACHE_MAGIC_NUMBER = 0x56525054; // TPRV
+constexpr uint16_t TRACK_PREVIEW_CACHE_VERSION = 2;
+constexpr uint64_t TRACK_PREVIEW_CACHE_HASH_OFFSET = 0xCBF29CE484222325ULL;
+constexpr uint64_t TRACK_PREVIEW_CACHE_HASH_PRIME = 0x100000001B3ULL;
+// Once the entries exceed this size, the oldest are deleted until they fit in TRACK_PREVIEW_CACHE_TRIMMED_SIZE
+constexpr uint64_t TRACK_PREVIEW_CACHE_MAX_SIZE = 64 * 1024 * 1024;
+constexpr uint64_t TRACK_PREVIEW_CACHE_TRIMMED_SIZE = 48 * 1024 * 1024;
+
+#pragma pack(push, 1)
+struct TrackPreviewCacheHeader
+{
+    uint32_t MagicNumber = TRACK_PREVIEW_CACHE_MAGIC_NUMBER;
+    uint16_t Version = TRACK_PREVIEW_CACHE_VERSION;
+    uint64_t Key = 0;
+    money32 Cost = 0;
+    uint8_t TrackFlags = 0;
+    uint32_t DataLength = 0;
+};
+#pragma pack(pop)
+
+struct TrackPreviewCacheFileHash
+{
+    uint64_t LastModified = 0;
+    uint64_t Hash = 0;
+};
+
+// Checksums of the TD6 files, so a design is only read again when it has been modified
+static std::unordered_map<std::string, TrackPreviewCacheFileHash> _trackPreviewFileHashes;
+// Total size of the entries on disk, or UINT64_MAX until the directory has been scanned
+static uint64_t _trackPreviewCacheSize = UINT64_MAX;
+
+static uint64_t track_design_preview_cache_hash(uint64_t hash, const void* data, size_t length)
+{
+    auto bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= bytes[i];
+        hash *= TRACK_PREVIEW_CACHE_HASH_PRIME;
+    }
+    return hash;
+}
+
+static std::string track_design_preview_cache_get_directory()
+{
+    auto env = GetContext()->GetPlatformEnvironment();
+    return Path::Combine(Path::GetDirectory(env->GetFilePath(PATHID::CACHE_TRACKS)), "trackpreviews");
+}
+
+static std::string track_design_preview_cache_get_path(uint64_t key)
+{
+    auto fileName = String::StdFormat("%08X%08X.dat", (uint32_t)(key >> 32), (uint32_t)key);
+    return Path::Combine(track_design_preview_cache_get_directory(), fileName);
+}
+
+static uint64_t track_design_preview_cache_hash_file(const utf8* path)
+{
+    uint64_t lastModified = File::GetLastModified(path);
+    auto it = _trackPreviewFileHashes.find(path);
+    if (it != _trackPreviewFileHashes.end() && it->second.LastModified == lastModified)
+    {
+        return it->second.Hash;
+    }
+
+    auto data = File::ReadAllBytes(path);
+    TrackPreviewCacheFileHash fileHash;
+    fileHash.LastModified = lastModified;
+    fileHash.Hash = track_design_preview_cache_hash(TRACK_PREVIEW_CACHE_HASH_OFFSET, data.data(), data.size());
+    _trackPreviewFileHashes[path] = fileHash;
+    return fileHash.Hash;
+}
+
+/**
+ * Deletes the oldest entries once the cache has grown past TRACK_PREVIEW_CACHE_MAX_SIZE. The directory is only scanned the
+ * first time and whenever the running total says it is over the limit.
+ */
+static void track_design_preview_cache_trim(uint64_t addedSize)
+{
+    if (_trackPreviewCacheSize != UINT64_MAX)
+    {
+        _trackPreviewCacheSize += addedSize;
+        if (_trackPreviewCacheSize <= TRACK_PREVIEW_CACHE_MAX_SIZE)
+        {
+            return;
+        }
+    }
+
+    struct CacheEntry
+    {
+        std::string Path;
+        uint64_t Size;
+        uint64_t LastModified;
+    };
+    std::vector<CacheEntry> entries;
+    uint64_t totalSize = 0;
+
+    auto pattern = Path::Combine(track_design_preview_cache_get_directory(), "*.dat");
+    auto scanner = Path::ScanDirectory(pattern, false);
+    while (scanner->Next())
+    {
+        auto fileInfo = scanner->GetFileInfo();
+        entries.push_back({ scanner->GetPath(), fileInfo->Size, fileInfo->LastModified });
+        totalSize += fileInfo->Size;
+    }
+    delete scanner;
+
+    if (totalSize > TRACK_PREVIEW_CACHE_MAX_SIZE)
+    {
+        std::sort(entries.begin(), entries.end(), [](const CacheEntry& a, const CacheEntry& b) {
+            return a.LastModified < b.LastModified;
+        });
+        for (const auto& entry : entries)
+        {
+            if (totalSize <= TRACK_PREVIEW_CACHE_TRIMMED_SIZE)
+            {
+                break;
+            }
+            if (platform_file_delete(entry.Path.c_str()))
+            {
+                totalSize -= entry.Size;
+            }
+        }
+    }
+    _trackPreviewCacheSize = totalSize;
+}
+
+/**
+ * Run length encodes the preview pixels. The previews are mostly the empty background, so this keeps the cache files to a
+ * small fraction of the raw 4 * 370 * 217 bytes. A control byte with the top bit set repeats the next byte
+ * ((control & 0x7F) + 1) times, otherwise it is followed by (control + 1) literal bytes.
+ */
+static std::vector<uint8_t> track_design_preview_cache_encode(const uint8_t* pixels, size_t length)
+{
+    std::vector<uint8_t> data;
+    size_t i = 0;
+    while (i < length)
+    {
+        size_t run = 1;
+        while (i + run < length && run < 128 && pixels[i + run] == pixels[i])
+        {
+            run++;
+        }
+
+        if (run >= 3)
+        {
+            data.push_back((uint8_t)(0x80 | (run - 1)));
+            data.push_back(pixels[i]);
+            i += run;
+            continue;
+        }
+
+        // Gather literals until the next run worth encoding
+        size_t literalStart = i;
+        while (i < length && i - literalStart < 128)
+        {
+            if (i + 2 < length && pixels[i] == pixels[i + 1] && pixels[i] == pixels[i + 2])
+            {
+                break;
+            }
+            i++;
+        }
+        data.push_back((uint8_t)(i - literalStart - 1));
+        data.insert(data.end(), pixels + literalStart, pixels + i);
+    }
+    return data;
+}
+
+static bool track_design_preview_cache_decode(const std::vector<uint8_t>& data, uint8_t* pixels, size_t length)
+{
+    size_t src = 0;
+    size_t dst = 0;
+    while (src < data.size())
+    {
+        uint8_t control = data[src++];
+        size_t count = (control & 0x7F) + 1;
+        if (dst + count > length)
+        {
+            return false;
+        }
+
+        if (control & 0x80)
+        {
+            if (src >= data.size())
+            {
+                return false;
+            }
+            std::fill_n(pixels + dst, count, data[src++]);
+        }
+        else
+        {
+            if (src + count > data.size())
+            {
+                return false;
+            }
+            std::copy_n(data.data() + src, count, pixels + dst);
+            src += count;
+        }
+        dst += count;
+    }
+    return dst == length;
+}
+
+/**
+ * The key covers the raw TD6 file, the game version and the state the preview is rendered with: whether scenery is shown,
+ * whether the park uses money (the cost), which ride entries are invented (the vehicle unavailable flag), and in game the set
+ * of loaded objects, which decides the vehicle, entrance style and which scenery can be placed. In the track designs
+ * manager every design loads its own scenery, so the loaded objects are not part of the key there.
+ */
+uint64_t track_design_preview_cache_get_key(const utf8* path)
+{
+    uint64_t hash;
+    try
+    {
+        hash = track_design_preview_cache_hash_file(path);
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to read track design for preview cache: %s", e.what());
+        return 0;
+    }
+
+    hash = track_design_preview_cache_hash(hash, gVersionInfoFull, std::strlen(gVersionInfoFull));
+
+    uint8_t variant[4] = {
+        (uint8_t)gTrackDesignSceneryToggle,
+        (uint8_t)((gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) != 0),
+        (uint8_t)((gParkFlags & PARK_FLAGS_NO_MONEY) != 0),
+        (uint8_t)gCheatsIgnoreResearchStatus,
+    };
+    hash = track_design_preview_cache_hash(hash, variant, sizeof(variant));
+
+    uint8_t invented[MAX_RIDE_OBJECTS / 8] = {};
+    for (int32_t i = 0; i < MAX_RIDE_OBJECTS; i++)
+    {
+        if (ride_entry_is_invented(i))
+        {
+            invented[i / 8] |= 1 << (i % 8);
+        }
+    }
+    hash = track_design_preview_cache_hash(hash, invented, sizeof(invented));
+
+    if (!(gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER))
+    {
+        for (size_t i = 0; i < OBJECT_ENTRY_COUNT; i++)
+        {
+            const rct_object_entry* entry = get_loaded_object_entry(i);
+            if (entry != nullptr)
+            {
+                hash = track_design_preview_cache_hash(hash, &i, sizeof(i));
+                hash = track_design_preview_cache_hash(hash, entry, sizeof(rct_object_entry));
+            }
+        }
+    }
+    return hash;
+}
+
+bool track_design_preview_cache_exists(uint64_t key)
+{
+    return key != 0 && File::Exists(track_design_preview_cache_get_path(key));
+}
+
+bool track_design_preview_cache_load(uint64_t key, uint8_t* pixels, money32* cost, uint8_t* trackFlags)
+{
+    if (!track_design_preview_cache_exists(key))
+    {
+        return false;
+    }
+
+    auto path = track_design_preview_cache_get_path(key);
+    try
+    {
+        auto fs = FileStream(path, FILE_MODE_OPEN);
+        auto header = fs.ReadValue<TrackPreviewCacheHeader>();
+        if (header.MagicNumber != TRACK_PREVIEW_CACHE_MAGIC_NUMBER || header.Version != TRACK_PREVIEW_CACHE_VERSION
+            || header.Key != key || header.DataLength > fs.GetLength() - fs.GetPosition())
+        {
+            log_verbose("Track preview cache entry '%s' is out of date", path.c_str());
+            return false;
+        }
+
+        std::vector<uint8_t> data(header.DataLength);
+        fs.Read(data.data(), data.size());
+        if (!track_design_preview_cache_decode(data, pixels, 4 * TRACK_PREVIEW_IMAGE_SIZE))
+        {
+            log_verbose("Track preview cache entry '%s' is corrupt", path.c_str());
+            return false;
+        }
+
+        *cost = header.Cost;
+        *trackFlags = header.TrackFlags;
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to read track preview cache entry: %s", e.what());
+    }
+    return false;
+}
+
+void track_design_preview_cache_save(uint64_t key, const uint8_t* pixels, money32 cost, uint8_t trackFlags)
+{
+    if (key == 0)
+    {
+        return;
+    }
+
+    auto path = track_design_preview_cache_get_path(key);
+    try
+    {
+        auto data = track_design_preview_cache_encode(pixels, 4 * TRACK_PREVIEW_IMAGE_SIZE);
+
+        TrackPreviewCacheHeader header;
+        header.Key = key;
+        header.Cost = cost;
+        header.TrackFlags = trackFlags;
+        header.DataLength = (uint32_t)data.size();
+
+        Path::CreateDirectory(Path::GetDirectory(path));
+        {
+            auto fs = FileStream(path, FILE_MODE_WRITE);
+            fs.WriteValue(header);
+            fs.Write(data.data(), data.size());
+        }
+
+        track_design_preview_cache_trim(sizeof(header) + data.size());
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write track preview cache entry: %s", e.what());
+    }
+}
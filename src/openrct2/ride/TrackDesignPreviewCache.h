@@ -0,0 +1,23 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+/**
+ * Rendered track design previews are stored on disk next to the track index, so a design only has to be placed on the
+ * preview map the first time it is shown. Entries are keyed by a checksum of the TD6 file combined with everything else
+ * that changes the rendered image or the cost and flags stored with it. The oldest entries are deleted once the cache
+ * grows past a fixed size.
+ */
+uint64_t track_design_preview_cache_get_key(const utf8* path);
+bool track_design_preview_cache_exists(uint64_t key);
+bool track_design_preview_cache_load(uint64_t key, uint8_t* pixels, money32* cost, uint8_t* trackFlags);
+void track_design_preview_cache_save(uint64_t key, const uint8_t* pixels, money32 cost, uint8_t trackFlags);
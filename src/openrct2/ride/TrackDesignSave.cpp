@@ -842,11 +842,11 @@ static bool track_design_save_to_td6_for_maze(const Ride* ride, rct_track_td6* t
 {
     TileElement* tileElement = nullptr;
     bool mapFound = false;
-    int16_t startX = 0;
-    int16_t startY = 0;
-    for (startY = 0; startY < 8192; startY += 32)
+    int32_t startX = 0;
+    int32_t startY = 0;
+    for (startY = 0; startY < MAXIMUM_MAP_SIZE_BIG; startY += 32)
     {
-        for (startX = 0; startX < 8192; startX += 32)
+        for (startX = 0; startX < MAXIMUM_MAP_SIZE_BIG; startX += 32)
         {
             tileElement = map_get_first_element_at(startX >> 5, startY >> 5);
             do
@@ -876,7 +876,7 @@ static bool track_design_save_to_td6_for_maze(const Ride* ride, rct_track_td6* t
         return false;
     }
 
-    gTrackPreviewOrigin = { startX, startY, (int16_t)(tileElement->base_height * 8) };
+    gTrackPreviewOrigin = { (int16_t)startX, (int16_t)startY, (int16_t)(tileElement->base_height * 8) };
 
     size_t numMazeElements = 0;
     td6->maze_elements = (rct_td6_maze_element*)calloc(8192, sizeof(rct_td6_maze_element));
@@ -885,9 +885,9 @@ static bool track_design_save_to_td6_for_maze(const Ride* ride, rct_track_td6* t
     // x is defined here as we can start the search
     // on tile start_x, start_y but then the next row
     // must restart on 0
-    for (int16_t y = startY, x = startX; y < 8192; y += 32)
+    for (int32_t y = startY, x = startX; y < MAXIMUM_MAP_SIZE_BIG; y += 32)
     {
-        for (; x < 8192; x += 32)
+        for (; x < MAXIMUM_MAP_SIZE_BIG; x += 32)
         {
             tileElement = map_get_first_element_at(x / 32, y / 32);
             do
@@ -922,8 +922,8 @@ static bool track_design_save_to_td6_for_maze(const Ride* ride, rct_track_td6* t
         return false;
     }
 
-    int16_t x = location.x * 32;
-    int16_t y = location.y * 32;
+    int32_t x = location.x * 32;
+    int32_t y = location.y * 32;
 
     tileElement = map_get_first_element_at(location.x, location.y);
     do
@@ -988,7 +988,7 @@ static bool track_design_save_to_td6_for_maze(const Ride* ride, rct_track_td6* t
     // Save global vars as they are still used by scenery
     int16_t startZ = gTrackPreviewOrigin.z;
     place_virtual_track(td6, PTD_OPERATION_DRAW_OUTLINES, true, get_ride(0), 4096, 4096, 0);
-    gTrackPreviewOrigin = { startX, startY, startZ };
+    gTrackPreviewOrigin = { (int16_t)startX, (int16_t)startY, startZ };
 
     gMapSelectFlags &= ~MAP_SELECT_FLAG_ENABLE_CONSTRUCT;
     gMapSelectFlags &= ~MAP_SELECT_FLAG_ENABLE_ARROW;
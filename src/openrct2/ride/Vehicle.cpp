@@ -37,46 +37,47 @@
 #include "RideData.h"
 #include "Station.h"
 #include "Track.h"
+#include "TrackCircuit.h"
 #include "TrackData.h"
 #include "VehicleData.h"
 
 #include <algorithm>
 #include <iterator>
 
-static void vehicle_update(rct_vehicle* vehicle);
+static void vehicle_update(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void vehicle_update_crossings(const rct_vehicle* vehicle);
 static void vehicle_claxon(const rct_vehicle* vehicle);
 
-static void vehicle_update_showing_film(rct_vehicle* vehicle);
-static void vehicle_update_doing_circus_show(rct_vehicle* vehicle);
-static void vehicle_update_moving_to_end_of_station(rct_vehicle* vehicle);
+static void vehicle_update_showing_film(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_doing_circus_show(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_moving_to_end_of_station(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void vehicle_update_waiting_for_passengers(rct_vehicle* vehicle);
-static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle);
-static void vehicle_update_departing(rct_vehicle* vehicle);
+static void vehicle_update_waiting_to_depart(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_departing(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void vehicle_finish_departing(rct_vehicle* vehicle);
-static void vehicle_update_travelling(rct_vehicle* vehicle);
-static void vehicle_update_ferris_wheel_rotating(rct_vehicle* vehicle);
-static void vehicle_update_rotating(rct_vehicle* vehicle);
-static void vehicle_update_space_rings_operating(rct_vehicle* vehicle);
-static void vehicle_update_haunted_house_operating(rct_vehicle* vehicle);
-static void vehicle_update_crooked_house_operating(rct_vehicle* vehicle);
-static void vehicle_update_dodgems_mode(rct_vehicle* vehicle);
+static void vehicle_update_travelling(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_ferris_wheel_rotating(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_rotating(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_space_rings_operating(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_haunted_house_operating(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_crooked_house_operating(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_dodgems_mode(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void vehicle_update_swinging(rct_vehicle* vehicle);
-static void vehicle_update_simulator_operating(rct_vehicle* vehicle);
-static void vehicle_update_top_spin_operating(rct_vehicle* vehicle);
+static void vehicle_update_simulator_operating(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_top_spin_operating(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void vehicle_update_crash(rct_vehicle* vehicle);
-static void vehicle_update_travelling_boat(rct_vehicle* vehicle);
-static void vehicle_update_motion_boat_hire(rct_vehicle* vehicle);
+static void vehicle_update_travelling_boat(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_motion_boat_hire(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void vehicle_update_boat_location(rct_vehicle* vehicle);
 static bool vehicle_boat_is_location_accessible(const TileCoordsXYZ& location);
-static void vehicle_update_arriving(rct_vehicle* vehicle);
+static void vehicle_update_arriving(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void vehicle_update_unloading_passengers(rct_vehicle* vehicle);
 static void vehicle_update_waiting_for_cable_lift(rct_vehicle* vehicle);
-static void vehicle_update_travelling_cable_lift(rct_vehicle* vehicle);
+static void vehicle_update_travelling_cable_lift(VehicleUpdateState& state, rct_vehicle* vehicle);
 static void vehicle_update_crash_setup(rct_vehicle* vehicle);
 static void vehicle_update_collision_setup(rct_vehicle* vehicle);
-static int32_t vehicle_update_motion_dodgems(rct_vehicle* vehicle);
-static void vehicle_update_additional_animation(rct_vehicle* vehicle);
+static int32_t vehicle_update_motion_dodgems(VehicleUpdateState& state, rct_vehicle* vehicle);
+static void vehicle_update_additional_animation(VehicleUpdateState& state, rct_vehicle* vehicle);
 static bool vehicle_update_motion_collision_detection(
     rct_vehicle* vehicle, int16_t x, int16_t y, int16_t z, uint16_t* otherVehicleIndex);
 static int32_t vehicle_get_sound_priority_factor(rct_vehicle* vehicle);
@@ -94,20 +95,6 @@ static bool vehicle_can_depart_synchronised(rct_vehicle* vehicle);
 #define VEHICLE_MAX_SPIN_SPEED_WATER_RIDE 512
 #define VEHICLE_STOPPING_SPIN_SPEED 600
 
-rct_vehicle* gCurrentVehicle;
-
-static uint8_t _vehicleBreakdown;
-uint8_t _vehicleStationIndex;
-uint32_t _vehicleMotionTrackFlags;
-int32_t _vehicleVelocityF64E08;
-int32_t _vehicleVelocityF64E0C;
-int32_t _vehicleUnkF64E10;
-uint8_t _vehicleVAngleEndF64E36;
-uint8_t _vehicleBankEndF64E37;
-uint8_t _vehicleF64E2C;
-rct_vehicle* _vehicleFrontVehicle;
-LocationXYZ16 unk_F64E20;
-
 // clang-format off
 static constexpr const uint8_t byte_9A3A14[] = { SOUND_SCREAM_8, SOUND_SCREAM_1 };
 static constexpr const uint8_t byte_9A3A16[] = { SOUND_SCREAM_1, SOUND_SCREAM_6 };
@@ -1345,7 +1332,9 @@ void vehicle_update_all()
         vehicle = GET_VEHICLE(sprite_index);
         sprite_index = vehicle->next;
 
-        vehicle_update(vehicle);
+        VehicleUpdateState state;
+        vehicle_update(state, vehicle);
+        ride_measurement_update_train(vehicle);
     }
 }
 
@@ -1918,7 +1907,7 @@ static uint16_t sub_6D7AC0(int32_t currentSoundId, int32_t currentVolume, int32_
  *
  *  rct2: 0x006D77F2
  */
-static void vehicle_update(rct_vehicle* vehicle)
+static void vehicle_update(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     Ride* ride;
     rct_ride_entry* rideEntry;
@@ -1926,7 +1915,7 @@ static void vehicle_update(rct_vehicle* vehicle)
     // The cable lift uses the ride type of NULL
     if (vehicle->ride_subtype == RIDE_TYPE_NULL)
     {
-        cable_lift_update(vehicle);
+        cable_lift_update(state, vehicle);
         return;
     }
 
@@ -1938,10 +1927,10 @@ static void vehicle_update(rct_vehicle* vehicle)
     if (vehicle->update_flags & VEHICLE_UPDATE_FLAG_TESTING)
         vehicle_update_measurements(vehicle);
 
-    _vehicleBreakdown = 255;
+    state.Breakdown = 255;
     if (ride->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN))
     {
-        _vehicleBreakdown = ride->breakdown_reason_pending;
+        state.Breakdown = ride->breakdown_reason_pending;
         if ((vehicleEntry->flags & VEHICLE_ENTRY_FLAG_POWERED) && ride->breakdown_reason_pending == BREAKDOWN_SAFETY_CUT_OUT)
         {
             if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_WATER_RIDE)
@@ -1955,59 +1944,59 @@ static void vehicle_update(rct_vehicle* vehicle)
     switch (vehicle->status)
     {
         case VEHICLE_STATUS_MOVING_TO_END_OF_STATION:
-            vehicle_update_moving_to_end_of_station(vehicle);
+            vehicle_update_moving_to_end_of_station(state, vehicle);
             break;
         case VEHICLE_STATUS_WAITING_FOR_PASSENGERS:
             vehicle_update_waiting_for_passengers(vehicle);
             break;
         case VEHICLE_STATUS_WAITING_TO_DEPART:
-            vehicle_update_waiting_to_depart(vehicle);
+            vehicle_update_waiting_to_depart(state, vehicle);
             break;
         case VEHICLE_STATUS_CRASHING:
         case VEHICLE_STATUS_CRASHED:
             vehicle_update_crash(vehicle);
             break;
         case VEHICLE_STATUS_TRAVELLING_DODGEMS:
-            vehicle_update_dodgems_mode(vehicle);
+            vehicle_update_dodgems_mode(state, vehicle);
             break;
         case VEHICLE_STATUS_SWINGING:
             vehicle_update_swinging(vehicle);
             break;
         case VEHICLE_STATUS_SIMULATOR_OPERATING:
-            vehicle_update_simulator_operating(vehicle);
+            vehicle_update_simulator_operating(state, vehicle);
             break;
         case VEHICLE_STATUS_TOP_SPIN_OPERATING:
-            vehicle_update_top_spin_operating(vehicle);
+            vehicle_update_top_spin_operating(state, vehicle);
             break;
         case VEHICLE_STATUS_FERRIS_WHEEL_ROTATING:
-            vehicle_update_ferris_wheel_rotating(vehicle);
+            vehicle_update_ferris_wheel_rotating(state, vehicle);
             break;
         case VEHICLE_STATUS_SPACE_RINGS_OPERATING:
-            vehicle_update_space_rings_operating(vehicle);
+            vehicle_update_space_rings_operating(state, vehicle);
             break;
         case VEHICLE_STATUS_HAUNTED_HOUSE_OPERATING:
-            vehicle_update_haunted_house_operating(vehicle);
+            vehicle_update_haunted_house_operating(state, vehicle);
             break;
         case VEHICLE_STATUS_CROOKED_HOUSE_OPERATING:
-            vehicle_update_crooked_house_operating(vehicle);
+            vehicle_update_crooked_house_operating(state, vehicle);
             break;
         case VEHICLE_STATUS_ROTATING:
-            vehicle_update_rotating(vehicle);
+            vehicle_update_rotating(state, vehicle);
             break;
         case VEHICLE_STATUS_DEPARTING:
-            vehicle_update_departing(vehicle);
+            vehicle_update_departing(state, vehicle);
             break;
         case VEHICLE_STATUS_TRAVELLING:
-            vehicle_update_travelling(vehicle);
+            vehicle_update_travelling(state, vehicle);
             break;
         case VEHICLE_STATUS_TRAVELLING_CABLE_LIFT:
-            vehicle_update_travelling_cable_lift(vehicle);
+            vehicle_update_travelling_cable_lift(state, vehicle);
             break;
         case VEHICLE_STATUS_TRAVELLING_BOAT:
-            vehicle_update_travelling_boat(vehicle);
+            vehicle_update_travelling_boat(state, vehicle);
             break;
         case VEHICLE_STATUS_ARRIVING:
-            vehicle_update_arriving(vehicle);
+            vehicle_update_arriving(state, vehicle);
             break;
         case VEHICLE_STATUS_UNLOADING_PASSENGERS:
             vehicle_update_unloading_passengers(vehicle);
@@ -2016,10 +2005,10 @@ static void vehicle_update(rct_vehicle* vehicle)
             vehicle_update_waiting_for_cable_lift(vehicle);
             break;
         case VEHICLE_STATUS_SHOWING_FILM:
-            vehicle_update_showing_film(vehicle);
+            vehicle_update_showing_film(state, vehicle);
             break;
         case VEHICLE_STATUS_DOING_CIRCUS_SHOW:
-            vehicle_update_doing_circus_show(vehicle);
+            vehicle_update_doing_circus_show(state, vehicle);
     }
 
     vehicle_update_sound(vehicle);
@@ -2029,7 +2018,7 @@ static void vehicle_update(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D7BCC
  */
-static void vehicle_update_moving_to_end_of_station(rct_vehicle* vehicle)
+static void vehicle_update_moving_to_end_of_station(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     Ride* ride = get_ride(vehicle->ride);
     int32_t flags, station;
@@ -2049,7 +2038,7 @@ static void vehicle_update_moving_to_end_of_station(rct_vehicle* vehicle)
                 vehicle->velocity -= vehicle->velocity / 16;
                 vehicle->acceleration = 0;
             }
-            flags = vehicle_update_track_motion(vehicle, &station);
+            flags = vehicle_update_track_motion(state, vehicle, &station);
             if (!(flags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_5))
                 break;
             [[fallthrough]];
@@ -2100,7 +2089,7 @@ static void vehicle_update_moving_to_end_of_station(rct_vehicle* vehicle)
                 vehicle->acceleration = 0;
             }
 
-            flags = vehicle_update_track_motion(vehicle, &station);
+            flags = vehicle_update_track_motion(state, vehicle, &station);
 
             if (flags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_1)
             {
@@ -2430,7 +2419,7 @@ static void vehicle_update_waiting_for_passengers(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D91BF
  */
-static void vehicle_update_dodgems_mode(rct_vehicle* vehicle)
+static void vehicle_update_dodgems_mode(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     Ride* ride = get_ride(vehicle->ride);
     rct_ride_entry* rideEntry = get_ride_entry(vehicle->ride_subtype);
@@ -2447,7 +2436,7 @@ static void vehicle_update_dodgems_mode(rct_vehicle* vehicle)
         vehicle_invalidate(vehicle);
     }
 
-    vehicle_update_motion_dodgems(vehicle);
+    vehicle_update_motion_dodgems(state, vehicle);
 
     // Update the length of time vehicle has been in bumper mode
     if (vehicle->sub_state++ == 0xFF)
@@ -2472,7 +2461,7 @@ static void vehicle_update_dodgems_mode(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D80BE
  */
-static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
+static void vehicle_update_waiting_to_depart(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     Ride* ride = get_ride(vehicle->ride);
     bool shouldBreak = false;
@@ -2586,7 +2575,7 @@ static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
             // the vehicle has been ridden.
             vehicle->sub_state = 0;
             vehicle->var_CE = 0;
-            vehicle_update_dodgems_mode(vehicle);
+            vehicle_update_dodgems_mode(state, vehicle);
             break;
         case RIDE_MODE_SWING:
             vehicle->status = VEHICLE_STATUS_SWINGING;
@@ -2602,7 +2591,7 @@ static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
             vehicle_invalidate_window(vehicle);
             vehicle->var_CE = 0;
             vehicle->current_time = -1;
-            vehicle_update_rotating(vehicle);
+            vehicle_update_rotating(state, vehicle);
             break;
         case RIDE_MODE_FILM_AVENGING_AVIATORS:
         case RIDE_MODE_FILM_THRILL_RIDERS:
@@ -2612,7 +2601,7 @@ static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
                 vehicle->sub_state = 1;
             vehicle_invalidate_window(vehicle);
             vehicle->current_time = -1;
-            vehicle_update_simulator_operating(vehicle);
+            vehicle_update_simulator_operating(state, vehicle);
             break;
         case RIDE_MODE_BEGINNERS:
         case RIDE_MODE_INTENSE:
@@ -2635,7 +2624,7 @@ static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
             vehicle->current_time = -1;
             vehicle->vehicle_sprite_type = 0;
             vehicle->bank_rotation = 0;
-            vehicle_update_top_spin_operating(vehicle);
+            vehicle_update_top_spin_operating(state, vehicle);
             break;
         case RIDE_MODE_FORWARD_ROTATION:
         case RIDE_MODE_BACKWARD_ROTATION:
@@ -2645,7 +2634,7 @@ static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
             vehicle->var_CE = 0;
             vehicle->ferris_wheel_var_0 = 8;
             vehicle->ferris_wheel_var_1 = 8;
-            vehicle_update_ferris_wheel_rotating(vehicle);
+            vehicle_update_ferris_wheel_rotating(state, vehicle);
             break;
         case RIDE_MODE_3D_FILM_MOUSE_TAILS:
         case RIDE_MODE_3D_FILM_STORM_CHASERS:
@@ -2665,14 +2654,14 @@ static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
                     break;
             }
             vehicle->current_time = -1;
-            vehicle_update_showing_film(vehicle);
+            vehicle_update_showing_film(state, vehicle);
             break;
         case RIDE_MODE_CIRCUS_SHOW:
             vehicle->status = VEHICLE_STATUS_DOING_CIRCUS_SHOW;
             vehicle->sub_state = 0;
             vehicle_invalidate_window(vehicle);
             vehicle->current_time = -1;
-            vehicle_update_doing_circus_show(vehicle);
+            vehicle_update_doing_circus_show(state, vehicle);
             break;
         case RIDE_MODE_SPACE_RINGS:
             vehicle->status = VEHICLE_STATUS_SPACE_RINGS_OPERATING;
@@ -2680,7 +2669,7 @@ static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
             vehicle_invalidate_window(vehicle);
             vehicle->vehicle_sprite_type = 0;
             vehicle->current_time = -1;
-            vehicle_update_space_rings_operating(vehicle);
+            vehicle_update_space_rings_operating(state, vehicle);
             break;
         case RIDE_MODE_HAUNTED_HOUSE:
             vehicle->status = VEHICLE_STATUS_HAUNTED_HOUSE_OPERATING;
@@ -2688,7 +2677,7 @@ static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
             vehicle_invalidate_window(vehicle);
             vehicle->vehicle_sprite_type = 0;
             vehicle->current_time = -1;
-            vehicle_update_haunted_house_operating(vehicle);
+            vehicle_update_haunted_house_operating(state, vehicle);
             break;
         case RIDE_MODE_CROOKED_HOUSE:
             vehicle->status = VEHICLE_STATUS_CROOKED_HOUSE_OPERATING;
@@ -2696,7 +2685,7 @@ static void vehicle_update_waiting_to_depart(rct_vehicle* vehicle)
             vehicle_invalidate_window(vehicle);
             vehicle->vehicle_sprite_type = 0;
             vehicle->current_time = -1;
-            vehicle_update_crooked_house_operating(vehicle);
+            vehicle_update_crooked_house_operating(state, vehicle);
             break;
         default:
             vehicle->sub_state = 0;
@@ -3147,7 +3136,7 @@ static bool vehicle_current_tower_element_is_top(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D986C
  */
-static void vehicle_update_travelling_boat_hire_setup(rct_vehicle* vehicle)
+static void vehicle_update_travelling_boat_hire_setup(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     vehicle->var_34 = vehicle->sprite_direction;
     vehicle->track_x = vehicle->x & 0xFFE0;
@@ -3165,14 +3154,14 @@ static void vehicle_update_travelling_boat_hire_setup(rct_vehicle* vehicle)
     vehicle->sub_state = 0;
     vehicle->remaining_distance += 27924;
 
-    vehicle_update_travelling_boat(vehicle);
+    vehicle_update_travelling_boat(state, vehicle);
 }
 
 /**
  *
  *  rct2: 0x006D982F
  */
-static void vehicle_update_departing_boat_hire(rct_vehicle* vehicle)
+static void vehicle_update_departing_boat_hire(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     vehicle->lost_time_out = 0;
     Ride* ride = get_ride(vehicle->ride);
@@ -3181,14 +3170,14 @@ static void vehicle_update_departing_boat_hire(rct_vehicle* vehicle)
     uint8_t waitingTime = std::max(ride->min_waiting_time, static_cast<uint8_t>(3));
     waitingTime = std::min(waitingTime, static_cast<uint8_t>(127));
     ride->stations[vehicle->current_station].Depart |= waitingTime;
-    vehicle_update_travelling_boat_hire_setup(vehicle);
+    vehicle_update_travelling_boat_hire_setup(state, vehicle);
 }
 
 /**
  *
  *  rct2: 0x006D845B
  */
-static void vehicle_update_departing(rct_vehicle* vehicle)
+static void vehicle_update_departing(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     Ride* ride = get_ride(vehicle->ride);
     rct_ride_entry* rideEntry = get_ride_entry(vehicle->ride_subtype);
@@ -3298,7 +3287,7 @@ static void vehicle_update_departing(rct_vehicle* vehicle)
             break;
     }
 
-    uint32_t flags = vehicle_update_track_motion(vehicle, nullptr);
+    uint32_t flags = vehicle_update_track_motion(state, vehicle, nullptr);
 
     if (flags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_8)
     {
@@ -3314,7 +3303,7 @@ static void vehicle_update_departing(rct_vehicle* vehicle)
     {
         if (ride->mode == RIDE_MODE_BOAT_HIRE)
         {
-            vehicle_update_departing_boat_hire(vehicle);
+            vehicle_update_departing_boat_hire(state, vehicle);
             return;
         }
         else if (ride->mode == RIDE_MODE_REVERSE_INCLINE_LAUNCHED_SHUTTLE)
@@ -3344,7 +3333,7 @@ static void vehicle_update_departing(rct_vehicle* vehicle)
                 vehicle->acceleration = 15539;
                 if (vehicle->velocity != 0)
                 {
-                    if (_vehicleBreakdown == BREAKDOWN_SAFETY_CUT_OUT)
+                    if (state.Breakdown == BREAKDOWN_SAFETY_CUT_OUT)
                     {
                         vehicle->update_flags |= VEHICLE_UPDATE_FLAG_ZERO_VELOCITY;
                         vehicle->update_flags &= ~VEHICLE_UPDATE_FLAG_1;
@@ -3362,7 +3351,7 @@ static void vehicle_update_departing(rct_vehicle* vehicle)
                 vehicle->acceleration = -15539;
                 if (vehicle->velocity != 0)
                 {
-                    if (_vehicleBreakdown == BREAKDOWN_SAFETY_CUT_OUT)
+                    if (state.Breakdown == BREAKDOWN_SAFETY_CUT_OUT)
                     {
                         vehicle->update_flags |= VEHICLE_UPDATE_FLAG_ZERO_VELOCITY;
                         vehicle->update_flags &= ~VEHICLE_UPDATE_FLAG_1;
@@ -3389,7 +3378,7 @@ static void vehicle_update_departing(rct_vehicle* vehicle)
 
         if (shouldLaunch)
         {
-            if (!(flags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3) || _vehicleStationIndex != vehicle->current_station)
+            if (!(flags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3) || state.StationIndex != vehicle->current_station)
             {
                 vehicle_finish_departing(vehicle);
                 return;
@@ -3650,12 +3639,12 @@ static void vehicle_update_crash_setup(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D8937
  */
-static void vehicle_update_travelling(rct_vehicle* vehicle)
+static void vehicle_update_travelling(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     vehicle_check_if_missing(vehicle);
 
     Ride* ride = get_ride(vehicle->ride);
-    if (_vehicleBreakdown == 0 && ride->mode == RIDE_MODE_ROTATING_LIFT)
+    if (state.Breakdown == 0 && ride->mode == RIDE_MODE_ROTATING_LIFT)
         return;
 
     if (vehicle->sub_state == 2)
@@ -3676,7 +3665,7 @@ static void vehicle_update_travelling(rct_vehicle* vehicle)
         return;
     }
 
-    uint32_t flags = vehicle_update_track_motion(vehicle, nullptr);
+    uint32_t flags = vehicle_update_track_motion(state, vehicle, nullptr);
 
     bool skipCheck = false;
     if (flags & (VEHICLE_UPDATE_MOTION_TRACK_FLAG_8 | VEHICLE_UPDATE_MOTION_TRACK_FLAG_9)
@@ -3716,7 +3705,7 @@ static void vehicle_update_travelling(rct_vehicle* vehicle)
             }
             else if (ride->mode == RIDE_MODE_BOAT_HIRE)
             {
-                vehicle_update_travelling_boat_hire_setup(vehicle);
+                vehicle_update_travelling_boat_hire_setup(state, vehicle);
                 return;
             }
             else if (ride->mode == RIDE_MODE_SHUTTLE)
@@ -3776,7 +3765,7 @@ static void vehicle_update_travelling(rct_vehicle* vehicle)
                     {
                         vehicle->acceleration = -15539;
 
-                        if (_vehicleBreakdown == 0)
+                        if (state.Breakdown == 0)
                         {
                             vehicle->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
                             vehicle->update_flags |= VEHICLE_UPDATE_FLAG_ZERO_VELOCITY;
@@ -3793,7 +3782,7 @@ static void vehicle_update_travelling(rct_vehicle* vehicle)
                 vehicle->acceleration = 15539;
                 if (vehicle->velocity != 0)
                 {
-                    if (_vehicleBreakdown == 0)
+                    if (state.Breakdown == 0)
                     {
                         vehicle->update_flags |= VEHICLE_UPDATE_FLAG_ZERO_VELOCITY;
                         vehicle->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
@@ -3820,7 +3809,7 @@ static void vehicle_update_travelling(rct_vehicle* vehicle)
         return;
 
     vehicle->status = VEHICLE_STATUS_ARRIVING;
-    vehicle->current_station = _vehicleStationIndex;
+    vehicle->current_station = state.StationIndex;
     vehicle_invalidate_window(vehicle);
     vehicle->var_C0 = 0;
 
@@ -3833,7 +3822,7 @@ static void vehicle_update_travelling(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D8C36
  */
-static void vehicle_update_arriving(rct_vehicle* vehicle)
+static void vehicle_update_arriving(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     uint8_t unkF64E35 = 1;
     Ride* ride = get_ride(vehicle->ride);
@@ -3958,7 +3947,7 @@ static void vehicle_update_arriving(rct_vehicle* vehicle)
 
     uint32_t flags;
 loc_6D8E36:
-    flags = vehicle_update_track_motion(vehicle, nullptr);
+    flags = vehicle_update_track_motion(state, vehicle, nullptr);
     if (flags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION && unkF64E35 == 0)
     {
         vehicle_update_collision_setup(vehicle);
@@ -4168,7 +4157,7 @@ static void vehicle_update_waiting_for_cable_lift(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D9D21
  */
-static void vehicle_update_travelling_cable_lift(rct_vehicle* vehicle)
+static void vehicle_update_travelling_cable_lift(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     Ride* ride = get_ride(vehicle->ride);
 
@@ -4218,7 +4207,7 @@ static void vehicle_update_travelling_cable_lift(rct_vehicle* vehicle)
     {
         vehicle->acceleration = 4398;
     }
-    int32_t flags = vehicle_update_track_motion(vehicle, nullptr);
+    int32_t flags = vehicle_update_track_motion(state, vehicle, nullptr);
 
     if (flags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_11)
     {
@@ -4232,7 +4221,7 @@ static void vehicle_update_travelling_cable_lift(rct_vehicle* vehicle)
     if (vehicle->sub_state == 2)
         return;
 
-    if (flags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3 && vehicle->current_station == _vehicleStationIndex)
+    if (flags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3 && vehicle->current_station == state.StationIndex)
         return;
 
     vehicle->sub_state = 2;
@@ -4256,13 +4245,13 @@ static void vehicle_update_travelling_cable_lift(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D9820
  */
-static void vehicle_update_travelling_boat(rct_vehicle* vehicle)
+static void vehicle_update_travelling_boat(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     vehicle_check_if_missing(vehicle);
-    vehicle_update_motion_boat_hire(vehicle);
+    vehicle_update_motion_boat_hire(state, vehicle);
 }
 
-static void loc_6DA9F9(rct_vehicle* vehicle, int32_t x, int32_t y, int32_t bx, int32_t dx)
+static void loc_6DA9F9(VehicleUpdateState& state, rct_vehicle* vehicle, int32_t x, int32_t y, int32_t bx, int32_t dx)
 {
     vehicle->remaining_distance = 0;
     if (!vehicle_update_motion_collision_detection(vehicle, x, y, vehicle->z, nullptr))
@@ -4277,8 +4266,8 @@ static void loc_6DA9F9(rct_vehicle* vehicle, int32_t x, int32_t y, int32_t bx, i
 
         vehicle->track_progress = 0;
         vehicle->status = VEHICLE_STATUS_TRAVELLING;
-        unk_F64E20.x = x;
-        unk_F64E20.y = y;
+        state.UnkF64E20.x = x;
+        state.UnkF64E20.y = y;
     }
 }
 
@@ -4286,12 +4275,12 @@ static void loc_6DA9F9(rct_vehicle* vehicle, int32_t x, int32_t y, int32_t bx, i
  *
  *  rct2: 0x006DA717
  */
-static void vehicle_update_motion_boat_hire(rct_vehicle* vehicle)
+static void vehicle_update_motion_boat_hire(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    _vehicleMotionTrackFlags = 0;
+    state.MotionTrackFlags = 0;
     vehicle->velocity += vehicle->acceleration;
-    _vehicleVelocityF64E08 = vehicle->velocity;
-    _vehicleVelocityF64E0C = (vehicle->velocity >> 10) * 42;
+    state.VelocityF64E08 = vehicle->velocity;
+    state.VelocityF64E0C = (vehicle->velocity >> 10) * 42;
 
     rct_ride_entry_vehicle* vehicleEntry = vehicle_get_vehicle_entry(vehicle);
     if (vehicleEntry == nullptr)
@@ -4300,18 +4289,18 @@ static void vehicle_update_motion_boat_hire(rct_vehicle* vehicle)
     }
     if (vehicleEntry->flags & (VEHICLE_ENTRY_FLAG_VEHICLE_ANIMATION | VEHICLE_ENTRY_FLAG_RIDER_ANIMATION))
     {
-        vehicle_update_additional_animation(vehicle);
+        vehicle_update_additional_animation(state, vehicle);
     }
 
-    _vehicleUnkF64E10 = 1;
+    state.UnkF64E10 = 1;
     vehicle->acceleration = 0;
-    vehicle->remaining_distance += _vehicleVelocityF64E0C;
+    vehicle->remaining_distance += state.VelocityF64E0C;
     if (vehicle->remaining_distance >= 0x368A)
     {
         vehicle->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        unk_F64E20.x = vehicle->x;
-        unk_F64E20.y = vehicle->y;
-        unk_F64E20.z = vehicle->z;
+        state.UnkF64E20.x = vehicle->x;
+        state.UnkF64E20.y = vehicle->y;
+        state.UnkF64E20.z = vehicle->z;
         vehicle_invalidate(vehicle);
 
         for (;;)
@@ -4477,18 +4466,18 @@ static void vehicle_update_motion_boat_hire(rct_vehicle* vehicle)
                         uint16_t bp = y & 0x1F;
                         if (bp == 16)
                         {
-                            loc_6DA9F9(vehicle, x, y, flooredX, flooredY);
+                            loc_6DA9F9(state, vehicle, x, y, flooredX, flooredY);
                             break;
                         }
                         if (bp <= 16)
                         {
-                            x = unk_F64E20.x;
-                            y = unk_F64E20.y + 1;
+                            x = state.UnkF64E20.x;
+                            y = state.UnkF64E20.y + 1;
                         }
                         else
                         {
-                            x = unk_F64E20.x;
-                            y = unk_F64E20.y - 1;
+                            x = state.UnkF64E20.x;
+                            y = state.UnkF64E20.y - 1;
                         }
                     }
                     else
@@ -4497,18 +4486,18 @@ static void vehicle_update_motion_boat_hire(rct_vehicle* vehicle)
                         uint16_t bp = x & 0x1F;
                         if (bp == 16)
                         {
-                            loc_6DA9F9(vehicle, x, y, flooredX, flooredY);
+                            loc_6DA9F9(state, vehicle, x, y, flooredX, flooredY);
                             break;
                         }
                         if (bp <= 16)
                         {
-                            x = unk_F64E20.x + 1;
-                            y = unk_F64E20.y;
+                            x = state.UnkF64E20.x + 1;
+                            y = state.UnkF64E20.y;
                         }
                         else
                         {
-                            x = unk_F64E20.x - 1;
-                            y = unk_F64E20.y;
+                            x = state.UnkF64E20.x - 1;
+                            y = state.UnkF64E20.y;
                         }
                     }
 
@@ -4516,8 +4505,8 @@ static void vehicle_update_motion_boat_hire(rct_vehicle* vehicle)
                     vehicle->remaining_distance = 0;
                     if (!vehicle_update_motion_collision_detection(vehicle, x, y, vehicle->z, nullptr))
                     {
-                        unk_F64E20.x = x;
-                        unk_F64E20.y = y;
+                        state.UnkF64E20.x = x;
+                        state.UnkF64E20.y = y;
                     }
                     break;
                 }
@@ -4526,16 +4515,16 @@ static void vehicle_update_motion_boat_hire(rct_vehicle* vehicle)
             }
 
             vehicle->remaining_distance -= Unk9A36C4[edi].distance;
-            unk_F64E20.x = x;
-            unk_F64E20.y = y;
+            state.UnkF64E20.x = x;
+            state.UnkF64E20.y = y;
             if (vehicle->remaining_distance < 0x368A)
             {
                 break;
             }
-            _vehicleUnkF64E10++;
+            state.UnkF64E10++;
         }
 
-        sprite_move(unk_F64E20.x, unk_F64E20.y, unk_F64E20.z, (rct_sprite*)vehicle);
+        sprite_move(state.UnkF64E20.x, state.UnkF64E20.y, state.UnkF64E20.z, (rct_sprite*)vehicle);
         vehicle_invalidate(vehicle);
     }
 
@@ -4568,8 +4557,8 @@ static void vehicle_update_motion_boat_hire(rct_vehicle* vehicle)
         }
         vehicle->acceleration = ecx;
     }
-    // eax = _vehicleMotionTrackFlags;
-    // ebx = _vehicleStationIndex;
+    // eax = state.MotionTrackFlags;
+    // ebx = state.StationIndex;
 }
 
 /**
@@ -4753,9 +4742,9 @@ static void vehicle_update_swinging(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D9413
  */
-static void vehicle_update_ferris_wheel_rotating(rct_vehicle* vehicle)
+static void vehicle_update_ferris_wheel_rotating(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    if (_vehicleBreakdown == 0)
+    if (state.Breakdown == 0)
         return;
 
     Ride* ride = get_ride(vehicle->ride);
@@ -4844,9 +4833,9 @@ static void vehicle_update_ferris_wheel_rotating(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D94F2
  */
-static void vehicle_update_simulator_operating(rct_vehicle* vehicle)
+static void vehicle_update_simulator_operating(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    if (_vehicleBreakdown == 0)
+    if (state.Breakdown == 0)
         return;
 
     assert(vehicle->current_time >= -1);
@@ -4872,9 +4861,9 @@ static void vehicle_update_simulator_operating(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D92FF
  */
-static void vehicle_update_rotating(rct_vehicle* vehicle)
+static void vehicle_update_rotating(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    if (_vehicleBreakdown == 0)
+    if (state.Breakdown == 0)
         return;
 
     Ride* ride = get_ride(vehicle->ride);
@@ -4899,7 +4888,7 @@ static void vehicle_update_rotating(rct_vehicle* vehicle)
     }
 
     int32_t time = vehicle->current_time;
-    if (_vehicleBreakdown == BREAKDOWN_CONTROL_FAILURE)
+    if (state.Breakdown == BREAKDOWN_CONTROL_FAILURE)
     {
         time += (ride->breakdown_sound_modifier >> 6) + 1;
     }
@@ -4918,7 +4907,7 @@ static void vehicle_update_rotating(rct_vehicle* vehicle)
 
     vehicle->current_time = -1;
     vehicle->var_CE++;
-    if (_vehicleBreakdown != BREAKDOWN_CONTROL_FAILURE)
+    if (state.Breakdown != BREAKDOWN_CONTROL_FAILURE)
     {
         bool shouldStop = true;
         if (ride->status != RIDE_STATUS_CLOSED)
@@ -4942,7 +4931,7 @@ static void vehicle_update_rotating(rct_vehicle* vehicle)
                 return;
             }
             vehicle->sub_state++;
-            vehicle_update_rotating(vehicle);
+            vehicle_update_rotating(state, vehicle);
             return;
         }
     }
@@ -4957,16 +4946,16 @@ static void vehicle_update_rotating(rct_vehicle* vehicle)
     }
 
     vehicle->sub_state = 1;
-    vehicle_update_rotating(vehicle);
+    vehicle_update_rotating(state, vehicle);
 }
 
 /**
  *
  *  rct2: 0x006D97CB
  */
-static void vehicle_update_space_rings_operating(rct_vehicle* vehicle)
+static void vehicle_update_space_rings_operating(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    if (_vehicleBreakdown == 0)
+    if (state.Breakdown == 0)
         return;
 
     uint8_t spriteType = SpaceRingsTimeToSpriteMap[vehicle->current_time + 1];
@@ -4992,9 +4981,9 @@ static void vehicle_update_space_rings_operating(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D9641
  */
-static void vehicle_update_haunted_house_operating(rct_vehicle* vehicle)
+static void vehicle_update_haunted_house_operating(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    if (_vehicleBreakdown == 0)
+    if (state.Breakdown == 0)
         return;
 
     if (vehicle->vehicle_sprite_type != 0)
@@ -5048,9 +5037,9 @@ static void vehicle_update_haunted_house_operating(rct_vehicle* vehicle)
  *
  *  rct2: 0x006d9781
  */
-static void vehicle_update_crooked_house_operating(rct_vehicle* vehicle)
+static void vehicle_update_crooked_house_operating(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    if (_vehicleBreakdown == 0)
+    if (state.Breakdown == 0)
         return;
 
     // Originally used an array of size 1 at 0x009A0AC4 and passed the sub state into it.
@@ -5070,9 +5059,9 @@ static void vehicle_update_crooked_house_operating(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D9547
  */
-static void vehicle_update_top_spin_operating(rct_vehicle* vehicle)
+static void vehicle_update_top_spin_operating(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    if (_vehicleBreakdown == 0)
+    if (state.Breakdown == 0)
         return;
 
     const top_spin_time_to_sprite_map* sprite_map = TopSpinTimeToSpriteMaps[vehicle->sub_state];
@@ -5104,11 +5093,11 @@ static void vehicle_update_top_spin_operating(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D95AD
  */
-static void vehicle_update_showing_film(rct_vehicle* vehicle)
+static void vehicle_update_showing_film(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     int32_t currentTime, totalTime;
 
-    if (_vehicleBreakdown == 0)
+    if (state.Breakdown == 0)
         return;
 
     totalTime = RideFilmLength[vehicle->sub_state];
@@ -5130,9 +5119,9 @@ static void vehicle_update_showing_film(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D95F7
  */
-static void vehicle_update_doing_circus_show(rct_vehicle* vehicle)
+static void vehicle_update_doing_circus_show(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    if (_vehicleBreakdown == 0)
+    if (state.Breakdown == 0)
         return;
 
     int32_t currentTime = vehicle->current_time + 1;
@@ -6249,9 +6238,9 @@ int32_t vehicle_is_used_in_pairs(const rct_vehicle* vehicle)
  *
  *  rct2: 0x006DA44E
  */
-static int32_t vehicle_update_motion_dodgems(rct_vehicle* vehicle)
+static int32_t vehicle_update_motion_dodgems(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    _vehicleMotionTrackFlags = 0;
+    state.MotionTrackFlags = 0;
     Ride* ride = get_ride(vehicle->ride);
 
     int32_t nextVelocity = vehicle->velocity + vehicle->acceleration;
@@ -6262,9 +6251,9 @@ static int32_t vehicle_update_motion_dodgems(rct_vehicle* vehicle)
     }
     vehicle->velocity = nextVelocity;
 
-    _vehicleVelocityF64E08 = nextVelocity;
-    _vehicleVelocityF64E0C = (nextVelocity / 1024) * 42;
-    _vehicleUnkF64E10 = 1;
+    state.VelocityF64E08 = nextVelocity;
+    state.VelocityF64E0C = (nextVelocity / 1024) * 42;
+    state.UnkF64E10 = 1;
 
     vehicle->acceleration = 0;
     if (!(ride->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN))
@@ -6318,14 +6307,14 @@ static int32_t vehicle_update_motion_dodgems(rct_vehicle* vehicle)
         }
     }
 
-    vehicle->remaining_distance += _vehicleVelocityF64E0C;
+    vehicle->remaining_distance += state.VelocityF64E0C;
 
     if (vehicle->remaining_distance >= 13962)
     {
         vehicle->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        unk_F64E20.x = vehicle->x;
-        unk_F64E20.y = vehicle->y;
-        unk_F64E20.z = vehicle->z;
+        state.UnkF64E20.x = vehicle->x;
+        state.UnkF64E20.y = vehicle->y;
+        state.UnkF64E20.z = vehicle->z;
 
         vehicle_invalidate(vehicle);
 
@@ -6335,7 +6324,7 @@ static int32_t vehicle_update_motion_dodgems(rct_vehicle* vehicle)
             uint8_t direction = vehicle->sprite_direction;
             direction |= vehicle->var_35 & 1;
 
-            LocationXYZ16 location = unk_F64E20;
+            LocationXYZ16 location = state.UnkF64E20;
             location.x += Unk9A36C4[direction].x;
             location.y += Unk9A36C4[direction].y;
 
@@ -6343,13 +6332,13 @@ static int32_t vehicle_update_motion_dodgems(rct_vehicle* vehicle)
                 break;
 
             vehicle->remaining_distance -= Unk9A36C4[direction].distance;
-            unk_F64E20.x = location.x;
-            unk_F64E20.y = location.y;
+            state.UnkF64E20.x = location.x;
+            state.UnkF64E20.y = location.y;
             if (vehicle->remaining_distance < 13962)
             {
                 break;
             }
-            _vehicleUnkF64E10++;
+            state.UnkF64E10++;
         }
 
         if (vehicle->remaining_distance >= 13962)
@@ -6381,7 +6370,7 @@ static int32_t vehicle_update_motion_dodgems(rct_vehicle* vehicle)
             }
         }
 
-        sprite_move(unk_F64E20.x, unk_F64E20.y, unk_F64E20.z, (rct_sprite*)vehicle);
+        sprite_move(state.UnkF64E20.x, state.UnkF64E20.y, state.UnkF64E20.z, (rct_sprite*)vehicle);
         vehicle_invalidate(vehicle);
     }
 
@@ -6399,7 +6388,7 @@ static int32_t vehicle_update_motion_dodgems(rct_vehicle* vehicle)
     if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_POWERED))
     {
         vehicle->acceleration = -eax;
-        return _vehicleMotionTrackFlags;
+        return state.MotionTrackFlags;
     }
 
     int32_t ebx = (vehicle->speed * vehicle->mass) >> 2;
@@ -6413,7 +6402,7 @@ static int32_t vehicle_update_motion_dodgems(rct_vehicle* vehicle)
     _eax /= ebx;
 
     vehicle->acceleration = _eax - eax;
-    return _vehicleMotionTrackFlags;
+    return state.MotionTrackFlags;
 }
 
 /**
@@ -6487,7 +6476,7 @@ bool vehicle_update_dodgems_collision(rct_vehicle* vehicle, int16_t x, int16_t y
  *
  *  rct2: 0x006DAB90
  */
-static void vehicle_update_track_motion_up_stop_check(rct_vehicle* vehicle)
+static void vehicle_update_track_motion_up_stop_check(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     rct_ride_entry_vehicle* vehicleEntry = vehicle_get_vehicle_entry(vehicle);
     int32_t verticalG, lateralG;
@@ -6522,7 +6511,7 @@ static void vehicle_update_track_motion_up_stop_check(rct_vehicle* vehicle)
 
             if (vehicle->vehicle_sprite_type != 8)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
+                state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
             }
         }
     }
@@ -6551,7 +6540,7 @@ static void vehicle_update_track_motion_up_stop_check(rct_vehicle* vehicle)
 
             if (vehicle->vehicle_sprite_type != 8 && vehicle->vehicle_sprite_type != 55)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
+                state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
             }
         }
     }
@@ -6588,13 +6577,13 @@ static void apply_non_stop_block_brake(rct_vehicle* vehicle, bool block_brake_cl
  *
  * Modifies the train's velocity influenced by a block brake
  */
-static void apply_block_brakes(rct_vehicle* vehicle, bool is_block_brake_closed)
+static void apply_block_brakes(VehicleUpdateState& state, rct_vehicle* vehicle, bool is_block_brake_closed)
 {
     // If the site is in a "train blocking" state
     if (is_block_brake_closed)
     {
         // Slow it down till completely stop the car
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_10;
+        state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_10;
         vehicle->acceleration = 0;
         // If the vehicle is slow enough, stop it. If not, slow it down
         if (vehicle->velocity <= 0x20000)
@@ -6620,7 +6609,7 @@ static void apply_block_brakes(rct_vehicle* vehicle, bool is_block_brake_closed)
  *
  *  rct2: 0x006DAC43
  */
-static void check_and_apply_block_section_stop_site(rct_vehicle* vehicle)
+static void check_and_apply_block_section_stop_site(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     Ride* ride = get_ride(vehicle->ride);
     rct_ride_entry_vehicle* vehicleEntry = vehicle_get_vehicle_entry(vehicle);
@@ -6634,7 +6623,7 @@ static void check_and_apply_block_section_stop_site(rct_vehicle* vehicle)
     if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_CHAIRLIFT)
     {
         int32_t velocity = ride->speed << 16;
-        if (_vehicleBreakdown == 0)
+        if (state.Breakdown == 0)
         {
             velocity = 0;
         }
@@ -6656,14 +6645,14 @@ static void check_and_apply_block_section_stop_site(rct_vehicle* vehicle)
     {
         case TRACK_ELEM_BLOCK_BRAKES:
             if (ride_is_block_sectioned(ride))
-                apply_block_brakes(vehicle, trackElement->AsTrack()->BlockBrakeClosed());
+                apply_block_brakes(state, vehicle, trackElement->AsTrack()->BlockBrakeClosed());
             else
                 apply_non_stop_block_brake(vehicle, true);
 
             break;
         case TRACK_ELEM_END_STATION:
             if (trackElement->AsTrack()->BlockBrakeClosed())
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_10;
+                state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_10;
 
             break;
         case TRACK_ELEM_25_DEG_UP_TO_FLAT:
@@ -6677,7 +6666,7 @@ static void check_and_apply_block_section_stop_site(rct_vehicle* vehicle)
                 {
                     if (trackElement->AsTrack()->BlockBrakeClosed())
                     {
-                        apply_block_brakes(vehicle, true);
+                        apply_block_brakes(state, vehicle, true);
                     }
                 }
             }
@@ -6689,7 +6678,7 @@ static void check_and_apply_block_section_stop_site(rct_vehicle* vehicle)
  *
  *  rct2: 0x006DADAE
  */
-static void update_velocity(rct_vehicle* vehicle)
+static void update_velocity(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     int32_t nextVelocity = vehicle->acceleration + vehicle->velocity;
     if (vehicle->update_flags & VEHICLE_UPDATE_FLAG_ZERO_VELOCITY)
@@ -6711,8 +6700,8 @@ static void update_velocity(rct_vehicle* vehicle)
     }
     vehicle->velocity = nextVelocity;
 
-    _vehicleVelocityF64E08 = nextVelocity;
-    _vehicleVelocityF64E0C = (nextVelocity >> 10) * 42;
+    state.VelocityF64E08 = nextVelocity;
+    state.VelocityF64E0C = (nextVelocity >> 10) * 42;
 }
 
 static void vehicle_update_block_brakes_open_previous_section(rct_vehicle* vehicle, TileElement* tileElement)
@@ -6905,9 +6894,9 @@ static int32_t vehicle_get_swing_amount(rct_vehicle* vehicle)
  *
  *  rct2: 0x006D6776
  */
-static void vehicle_update_swinging_car(rct_vehicle* vehicle)
+static void vehicle_update_swinging_car(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
-    int32_t dword_F64E08 = abs(_vehicleVelocityF64E08);
+    int32_t dword_F64E08 = abs(state.VelocityF64E08);
     vehicle->var_4E += (-vehicle->swinging_car_var_0) >> 6;
     int32_t swingAmount = vehicle_get_swing_amount(vehicle);
     if (swingAmount < 0)
@@ -7095,7 +7084,7 @@ static const uint8_t TrackTypeToSpinFunction[256] = {
  *
  *  rct2: 0x006D661F
  */
-static void vehicle_update_spinning_car(rct_vehicle* vehicle)
+static void vehicle_update_spinning_car(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     if (vehicle->update_flags & VEHICLE_UPDATE_FLAG_ROTATION_OFF_WILD_MOUSE)
     {
@@ -7110,7 +7099,7 @@ static void vehicle_update_spinning_car(rct_vehicle* vehicle)
     }
     int32_t spinningInertia = vehicleEntry->spinning_inertia;
     int32_t trackType = vehicle->track_type >> 2;
-    int32_t dword_F64E08 = _vehicleVelocityF64E08;
+    int32_t dword_F64E08 = state.VelocityF64E08;
     int32_t spinSpeed;
     // An L spin adds to the spin speed, R does the opposite
     // The number indicates how much right shift of the velocity will become spin
@@ -7233,7 +7222,7 @@ static void steam_particle_create(int16_t x, int16_t y, int16_t z)
  *
  *  rct2: 0x006D63D4
  */
-static void vehicle_update_additional_animation(rct_vehicle* vehicle)
+static void vehicle_update_additional_animation(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     uint8_t al, ah;
     uint32_t eax;
@@ -7247,7 +7236,7 @@ static void vehicle_update_additional_animation(rct_vehicle* vehicle)
     switch (vehicleEntry->animation)
     {
         case VEHICLE_ENTRY_ANIMATION_MINITURE_RAILWAY_LOCOMOTIVE: // loc_6D652B
-            *var_C8 += _vehicleVelocityF64E08;
+            *var_C8 += state.VelocityF64E08;
             al = (*var_C8 >> 20) & 3;
             if (vehicle->animation_frame != al)
             {
@@ -7281,7 +7270,7 @@ static void vehicle_update_additional_animation(rct_vehicle* vehicle)
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_SWAN: // loc_6D6424
-            *var_C8 += _vehicleVelocityF64E08;
+            *var_C8 += state.VelocityF64E08;
             al = (*var_C8 >> 18) & 2;
             if (vehicle->animation_frame != al)
             {
@@ -7290,7 +7279,7 @@ static void vehicle_update_additional_animation(rct_vehicle* vehicle)
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_CANOES: // loc_6D6482
-            *var_C8 += _vehicleVelocityF64E08;
+            *var_C8 += state.VelocityF64E08;
             eax = ((*var_C8 >> 13) & 0xFF) * 6;
             ah = (eax >> 8) & 0xFF;
             if (vehicle->animation_frame != ah)
@@ -7300,7 +7289,7 @@ static void vehicle_update_additional_animation(rct_vehicle* vehicle)
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_ROW_BOATS: // loc_6D64F7
-            *var_C8 += _vehicleVelocityF64E08;
+            *var_C8 += state.VelocityF64E08;
             eax = ((*var_C8 >> 13) & 0xFF) * 7;
             ah = (eax >> 8) & 0xFF;
             if (vehicle->animation_frame != ah)
@@ -7310,7 +7299,7 @@ static void vehicle_update_additional_animation(rct_vehicle* vehicle)
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_WATER_TRICYCLES: // loc_6D6453
-            *var_C8 += _vehicleVelocityF64E08;
+            *var_C8 += state.VelocityF64E08;
             al = (*var_C8 >> 19) & 1;
             if (vehicle->animation_frame != al)
             {
@@ -7332,7 +7321,7 @@ static void vehicle_update_additional_animation(rct_vehicle* vehicle)
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_HELICARS: // loc_6D63F5
-            *var_C8 += _vehicleVelocityF64E08;
+            *var_C8 += state.VelocityF64E08;
             al = (*var_C8 >> 18) & 3;
             if (vehicle->animation_frame != al)
             {
@@ -7343,7 +7332,7 @@ static void vehicle_update_additional_animation(rct_vehicle* vehicle)
         case VEHICLE_ENTRY_ANIMATION_MONORAIL_CYCLES: // loc_6D64B6
             if (vehicle->num_peeps != 0)
             {
-                *var_C8 += _vehicleVelocityF64E08;
+                *var_C8 += state.VelocityF64E08;
                 eax = ((*var_C8 >> 13) & 0xFF) << 2;
                 ah = (eax >> 8) & 0xFF;
                 if (vehicle->animation_frame != ah)
@@ -7457,7 +7446,7 @@ static void vehicle_update_scenery_door(rct_vehicle* vehicle)
  *
  *  rct2: 0x006DB38B
  */
-static bool loc_6DB38B(rct_vehicle* vehicle, TileElement* tileElement)
+static bool loc_6DB38B(VehicleUpdateState& state, rct_vehicle* vehicle, TileElement* tileElement)
 {
     // Get bank
     int32_t bankStart = track_get_actual_bank_3(vehicle, tileElement);
@@ -7466,7 +7455,7 @@ static bool loc_6DB38B(rct_vehicle* vehicle, TileElement* tileElement)
     int32_t trackType = tileElement->AsTrack()->GetTrackType();
     int32_t vangleStart = TrackDefinitions[trackType].vangle_start;
 
-    return vangleStart == _vehicleVAngleEndF64E36 && bankStart == _vehicleBankEndF64E37;
+    return vangleStart == state.VAngleEndF64E36 && bankStart == state.BankEndF64E37;
 }
 
 static void loc_6DB481(rct_vehicle* vehicle)
@@ -7533,21 +7522,21 @@ static void vehicle_update_handle_scenery_door(rct_vehicle* vehicle)
     }
 }
 
-static void vehicle_update_play_water_splash_sound()
+static void vehicle_update_play_water_splash_sound(VehicleUpdateState& state)
 {
-    if (_vehicleVelocityF64E08 <= 0x20364)
+    if (state.VelocityF64E08 <= 0x20364)
     {
         return;
     }
 
-    audio_play_sound_at_location(SOUND_WATER_SPLASH, unk_F64E20.x, unk_F64E20.y, unk_F64E20.z);
+    audio_play_sound_at_location(SOUND_WATER_SPLASH, state.UnkF64E20.x, state.UnkF64E20.y, state.UnkF64E20.z);
 }
 
 /**
  *
  *  rct2: 0x006DB59E
  */
-static void vehicle_update_handle_water_splash(rct_vehicle* vehicle)
+static void vehicle_update_handle_water_splash(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     rct_ride_entry* rideEntry = get_ride_entry(vehicle->ride_subtype);
     int32_t trackType = vehicle->track_type >> 2;
@@ -7566,7 +7555,7 @@ static void vehicle_update_handle_water_splash(rct_vehicle* vehicle)
                     {
                         if (vehicle->track_progress == 4)
                         {
-                            vehicle_update_play_water_splash_sound();
+                            vehicle_update_play_water_splash_sound(state);
                         }
                     }
                 }
@@ -7579,7 +7568,7 @@ static void vehicle_update_handle_water_splash(rct_vehicle* vehicle)
         {
             if (vehicle->track_progress == 12)
             {
-                vehicle_update_play_water_splash_sound();
+                vehicle_update_play_water_splash_sound(state);
             }
         }
     }
@@ -7589,7 +7578,7 @@ static void vehicle_update_handle_water_splash(rct_vehicle* vehicle)
         {
             if (vehicle->track_progress == 48)
             {
-                vehicle_update_play_water_splash_sound();
+                vehicle_update_play_water_splash_sound(state);
             }
         }
     }
@@ -7836,11 +7825,11 @@ static void vehicle_reverse_reverser_car(rct_vehicle* vehicle)
  *
  *  rct2: 0x006DBF3E
  */
-static void sub_6DBF3E(rct_vehicle* vehicle)
+static void sub_6DBF3E(VehicleUpdateState& state, rct_vehicle* vehicle)
 {
     rct_ride_entry_vehicle* vehicleEntry = vehicle_get_vehicle_entry(vehicle);
 
-    vehicle->acceleration = vehicle->acceleration / _vehicleUnkF64E10;
+    vehicle->acceleration = vehicle->acceleration / state.UnkF64E10;
     if (vehicle->var_CD == 2)
     {
         return;
@@ -7852,7 +7841,7 @@ static void sub_6DBF3E(rct_vehicle* vehicle)
         return;
     }
 
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
+    state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
 
     TileElement* tileElement = nullptr;
     if (map_is_location_valid({ vehicle->track_x, vehicle->track_y }))
@@ -7866,12 +7855,12 @@ static void sub_6DBF3E(rct_vehicle* vehicle)
         return;
     }
 
-    if (_vehicleStationIndex == 0xFF)
+    if (state.StationIndex == 0xFF)
     {
-        _vehicleStationIndex = tileElement->AsTrack()->GetStationIndex();
+        state.StationIndex = tileElement->AsTrack()->GetStationIndex();
     }
 
-    if (trackType == TRACK_ELEM_TOWER_BASE && vehicle == gCurrentVehicle)
+    if (trackType == TRACK_ELEM_TOWER_BASE && vehicle == state.CurrentVehicle)
     {
         if (vehicle->track_progress > 3 && !(vehicle->update_flags & VEHICLE_UPDATE_FLAG_REVERSING_SHUTTLE))
         {
@@ -7883,27 +7872,27 @@ static void sub_6DBF3E(rct_vehicle* vehicle)
             input.element = tileElement;
             if (!track_block_get_next(&input, &output, &outputZ, &outputDirection))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_12;
+                state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_12;
             }
         }
 
         if (vehicle->track_progress <= 3)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
 
-    if (trackType != TRACK_ELEM_END_STATION || vehicle != gCurrentVehicle)
+    if (trackType != TRACK_ELEM_END_STATION || vehicle != state.CurrentVehicle)
     {
         return;
     }
 
     uint16_t ax = vehicle->track_progress;
-    if (_vehicleVelocityF64E08 < 0)
+    if (state.VelocityF64E08 < 0)
     {
         if (ax <= 22)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
     else
@@ -7920,7 +7909,7 @@ static void sub_6DBF3E(rct_vehicle* vehicle)
 
         if (ax > cx)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
 }
@@ -7930,23 +7919,23 @@ static void sub_6DBF3E(rct_vehicle* vehicle)
  *  rct2: 0x006DB08C
  */
 static bool vehicle_update_track_motion_forwards_get_new_track(
-    rct_vehicle* vehicle, uint16_t trackType, Ride* ride, rct_ride_entry* rideEntry)
+    VehicleUpdateState& state, rct_vehicle* vehicle, uint16_t trackType, Ride* ride, rct_ride_entry* rideEntry)
 {
     registers regs = {};
 
-    _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
-    _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_end;
-    TileElement* tileElement = map_get_track_element_at_of_type_seq(
-        vehicle->track_x, vehicle->track_y, vehicle->track_z >> 3, trackType, 0);
+    state.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
+    state.BankEndF64E37 = TrackDefinitions[trackType].bank_end;
+    TileElement* tileElement = track_circuit_get_element(
+        vehicle->ride, vehicle->track_x, vehicle->track_y, vehicle->track_z >> 3, trackType);
 
     if (tileElement == nullptr)
     {
         return false;
     }
 
-    if (trackType == TRACK_ELEM_CABLE_LIFT_HILL && vehicle == gCurrentVehicle)
+    if (trackType == TRACK_ELEM_CABLE_LIFT_HILL && vehicle == state.CurrentVehicle)
     {
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_11;
+        state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_11;
     }
 
     if (track_element_is_block_start(tileElement))
@@ -7991,7 +7980,7 @@ static bool vehicle_update_track_motion_forwards_get_new_track(
 loc_6DB32A:
 {
     track_begin_end trackBeginEnd;
-    if (!track_block_get_previous(vehicle->track_x, vehicle->track_y, tileElement, &trackBeginEnd))
+    if (!track_circuit_get_previous(vehicle->track_x, vehicle->track_y, tileElement, &trackBeginEnd))
     {
         return false;
     }
@@ -8010,7 +7999,7 @@ loc_6DB358:
     xyElement.x = vehicle->track_x;
     xyElement.y = vehicle->track_y;
     xyElement.element = tileElement;
-    if (!track_block_get_next(&xyElement, &xyElement, &z, &direction))
+    if (!track_circuit_get_next(&xyElement, &xyElement, &z, &direction))
     {
         return false;
     }
@@ -8029,7 +8018,7 @@ loc_6DB358:
         }
     }
 
-    if (!loc_6DB38B(vehicle, tileElement))
+    if (!loc_6DB38B(state, vehicle, tileElement))
     {
         return false;
     }
@@ -8127,7 +8116,8 @@ loc_6DB41D:
  *  rct2: 0x006DAEB9
  */
 static bool vehicle_update_track_motion_forwards(
-    rct_vehicle* vehicle, rct_ride_entry_vehicle* vehicleEntry, Ride* ride, rct_ride_entry* rideEntry)
+    VehicleUpdateState& state, rct_vehicle* vehicle, rct_ride_entry_vehicle* vehicleEntry, Ride* ride,
+    rct_ride_entry* rideEntry)
 {
     registers regs = {};
 loc_6DAEB9:
@@ -8141,11 +8131,11 @@ loc_6DAEB9:
             vehicle->vehicle_type ^= 1;
             vehicleEntry = vehicle_get_vehicle_entry(vehicle);
         }
-        if (_vehicleVelocityF64E08 >= 0x40000)
+        if (state.VelocityF64E08 >= 0x40000)
         {
-            vehicle->acceleration = -_vehicleVelocityF64E08 * 8;
+            vehicle->acceleration = -state.VelocityF64E08 * 8;
         }
-        else if (_vehicleVelocityF64E08 < 0x20000)
+        else if (state.VelocityF64E08 < 0x20000)
         {
             vehicle->acceleration = 0x50000;
         }
@@ -8156,15 +8146,15 @@ loc_6DAEB9:
               && ride->mechanic_status == RIDE_MECHANIC_STATUS_HAS_FIXED_STATION_BRAKES))
         {
             regs.eax = vehicle->brake_speed << 16;
-            if (regs.eax < _vehicleVelocityF64E08)
+            if (regs.eax < state.VelocityF64E08)
             {
-                vehicle->acceleration = -_vehicleVelocityF64E08 * 16;
+                vehicle->acceleration = -state.VelocityF64E08 * 16;
             }
             else if (!(gCurrentTicks & 0x0F))
             {
-                if (_vehicleF64E2C == 0)
+                if (state.F64E2C == 0)
                 {
-                    _vehicleF64E2C++;
+                    state.F64E2C++;
                     audio_play_sound_at_location(SOUND_51, vehicle->x, vehicle->y, vehicle->z);
                 }
             }
@@ -8174,9 +8164,9 @@ loc_6DAEB9:
     {
         regs.eax = get_booster_speed(ride->type, (vehicle->brake_speed << 16));
 
-        if (regs.eax > _vehicleVelocityF64E08)
+        if (regs.eax > state.VelocityF64E08)
         {
-            vehicle->acceleration = RideProperties[ride->type].booster_acceleration << 16; //_vehicleVelocityF64E08 * 1.2;
+            vehicle->acceleration = RideProperties[ride->type].booster_acceleration << 16; //state.VelocityF64E08 * 1.2;
         }
     }
 
@@ -8193,7 +8183,7 @@ loc_6DAEB9:
             {
                 if (vehicle->track_progress >= 8)
                 {
-                    vehicle->acceleration = -_vehicleVelocityF64E08 * 16;
+                    vehicle->acceleration = -state.VelocityF64E08 * 16;
                     if (vehicle->track_progress >= 24)
                     {
                         vehicle->update_flags |= VEHICLE_UPDATE_FLAG_ON_BREAK_FOR_DROP;
@@ -8229,10 +8219,10 @@ loc_6DAEB9:
     {
         vehicle_update_crossings(vehicle);
 
-        if (!vehicle_update_track_motion_forwards_get_new_track(vehicle, trackType, ride, rideEntry))
+        if (!vehicle_update_track_motion_forwards_get_new_track(state, vehicle, trackType, ride, rideEntry))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-            _vehicleVelocityF64E0C -= vehicle->remaining_distance + 1;
+            state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+            state.VelocityF64E0C -= vehicle->remaining_distance + 1;
             vehicle->remaining_distance = -1;
             return false;
         }
@@ -8240,7 +8230,7 @@ loc_6DAEB9:
     }
 
     vehicle->track_progress = regs.ax;
-    vehicle_update_handle_water_splash(vehicle);
+    vehicle_update_handle_water_splash(state, vehicle);
 
     // loc_6DB706
     moveInfo = vehicle_get_move_info(vehicle->var_CD, vehicle->track_type, vehicle->track_progress);
@@ -8251,15 +8241,15 @@ loc_6DAEB9:
         int16_t z = vehicle->track_z + moveInfo->z + RideData5[ride->type].z_offset;
 
         regs.ebx = 0;
-        if (x != unk_F64E20.x)
+        if (x != state.UnkF64E20.x)
         {
             regs.ebx |= 1;
         }
-        if (y != unk_F64E20.y)
+        if (y != state.UnkF64E20.y)
         {
             regs.ebx |= 2;
         }
-        if (z != unk_F64E20.z)
+        if (z != state.UnkF64E20.z)
         {
             regs.ebx |= 4;
         }
@@ -8284,9 +8274,9 @@ loc_6DAEB9:
         // loc_6DB8A5
         regs.ebx = dword_9A2930[regs.ebx];
         vehicle->remaining_distance -= regs.ebx;
-        unk_F64E20.x = x;
-        unk_F64E20.y = y;
-        unk_F64E20.z = z;
+        state.UnkF64E20.x = x;
+        state.UnkF64E20.y = y;
+        state.UnkF64E20.z = z;
         vehicle->sprite_direction = moveInfo->direction;
         vehicle->bank_rotation = moveInfo->bank_rotation;
         vehicle->vehicle_sprite_type = moveInfo->vehicle_sprite_type;
@@ -8301,9 +8291,9 @@ loc_6DAEB9:
         }
 
         // vehicle == frontVehicle
-        if (vehicle == _vehicleFrontVehicle)
+        if (vehicle == state.FrontVehicle)
         {
-            if (_vehicleVelocityF64E08 >= 0)
+            if (state.VelocityF64E08 >= 0)
             {
                 regs.bp = vehicle->prev_vehicle_on_ride;
                 if (vehicle_update_motion_collision_detection(vehicle, x, y, z, (uint16_t*)&regs.bp))
@@ -8322,11 +8312,11 @@ loc_6DAEB9:
 
     regs.ebx = dword_9A2970[regs.ebx];
     vehicle->acceleration += regs.ebx;
-    _vehicleUnkF64E10++;
+    state.UnkF64E10++;
     goto loc_6DAEB9;
 
 loc_6DB967:
-    _vehicleVelocityF64E0C -= vehicle->remaining_distance + 1;
+    state.VelocityF64E0C -= vehicle->remaining_distance + 1;
     vehicle->remaining_distance = -1;
 
     // Might need to be bp rather than vehicle, but hopefully not
@@ -8339,7 +8329,7 @@ loc_6DB967:
         {
             if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
             }
         }
     }
@@ -8354,7 +8344,7 @@ loc_6DB967:
         vehicle->velocity = head->velocity >> 1;
         head->velocity = newHeadVelocity;
     }
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
+    state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
     return false;
 }
 
@@ -8363,12 +8353,12 @@ loc_6DB967:
  *  rct2: 0x006DBAA6
  */
 static bool vehicle_update_track_motion_backwards_get_new_track(
-    rct_vehicle* vehicle, uint16_t trackType, Ride* ride, uint16_t* progress)
+    VehicleUpdateState& state, rct_vehicle* vehicle, uint16_t trackType, Ride* ride, uint16_t* progress)
 {
-    _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_start;
-    _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_start;
-    TileElement* tileElement = map_get_track_element_at_of_type_seq(
-        vehicle->track_x, vehicle->track_y, vehicle->track_z >> 3, trackType, 0);
+    state.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_start;
+    state.BankEndF64E37 = TrackDefinitions[trackType].bank_start;
+    TileElement* tileElement = track_circuit_get_element(
+        vehicle->ride, vehicle->track_x, vehicle->track_y, vehicle->track_z >> 3, trackType);
 
     if (tileElement == nullptr)
         return false;
@@ -8402,7 +8392,7 @@ static bool vehicle_update_track_motion_backwards_get_new_track(
     {
         // loc_6DBB7E:;
         track_begin_end trackBeginEnd;
-        if (!track_block_get_previous(x, y, tileElement, &trackBeginEnd))
+        if (!track_circuit_get_previous(x, y, tileElement, &trackBeginEnd))
         {
             return false;
         }
@@ -8419,7 +8409,7 @@ static bool vehicle_update_track_motion_backwards_get_new_track(
         int32_t bank = TrackDefinitions[trackType].bank_end;
         bank = track_get_actual_bank_2(ride->type, isInverted, bank);
         int32_t vAngle = TrackDefinitions[trackType].vangle_end;
-        if (_vehicleVAngleEndF64E36 != vAngle || _vehicleBankEndF64E37 != bank)
+        if (state.VAngleEndF64E36 != vAngle || state.BankEndF64E37 != bank)
         {
             return false;
         }
@@ -8449,7 +8439,7 @@ static bool vehicle_update_track_motion_backwards_get_new_track(
         input.x = x;
         input.y = y;
         input.element = tileElement;
-        if (!track_block_get_next(&input, &output, &outputZ, &direction))
+        if (!track_circuit_get_next(&input, &output, &outputZ, &direction))
         {
             return false;
         }
@@ -8481,14 +8471,14 @@ static bool vehicle_update_track_motion_backwards_get_new_track(
 
     if (tileElement->AsTrack()->HasChain())
     {
-        if (_vehicleVelocityF64E08 < 0)
+        if (state.VelocityF64E08 < 0)
         {
             if (vehicle->next_vehicle_on_train == SPRITE_INDEX_NULL)
             {
                 trackType = tileElement->AsTrack()->GetTrackType();
                 if (!(TrackFlags[trackType] & TRACK_ELEM_FLAG_DOWN))
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_9;
+                    state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_9;
                 }
             }
             vehicle->update_flags |= VEHICLE_UPDATE_FLAG_ON_LIFT_HILL;
@@ -8501,9 +8491,9 @@ static bool vehicle_update_track_motion_backwards_get_new_track(
             vehicle->update_flags &= ~VEHICLE_UPDATE_FLAG_ON_LIFT_HILL;
             if (vehicle->next_vehicle_on_train == SPRITE_INDEX_NULL)
             {
-                if (_vehicleVelocityF64E08 < 0)
+                if (state.VelocityF64E08 < 0)
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
+                    state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
                 }
             }
         }
@@ -8530,7 +8520,8 @@ static bool vehicle_update_track_motion_backwards_get_new_track(
  *  rct2: 0x006DBA33
  */
 static bool vehicle_update_track_motion_backwards(
-    rct_vehicle* vehicle, rct_ride_entry_vehicle* vehicleEntry, Ride* ride, rct_ride_entry* rideEntry)
+    VehicleUpdateState& state, rct_vehicle* vehicle, rct_ride_entry_vehicle* vehicleEntry, Ride* ride,
+    rct_ride_entry* rideEntry)
 {
     registers regs = {};
 
@@ -8538,7 +8529,7 @@ loc_6DBA33:;
     uint16_t trackType = vehicle->track_type >> 2;
     if (trackType == TRACK_ELEM_FLAT && ride->type == RIDE_TYPE_REVERSE_FREEFALL_COASTER)
     {
-        int32_t unkVelocity = _vehicleVelocityF64E08;
+        int32_t unkVelocity = state.VelocityF64E08;
         if (unkVelocity < -524288)
         {
             unkVelocity = abs(unkVelocity);
@@ -8549,9 +8540,9 @@ loc_6DBA33:;
     if (trackType == TRACK_ELEM_BRAKES)
     {
         regs.eax = -(vehicle->brake_speed << 16);
-        if (regs.eax > _vehicleVelocityF64E08)
+        if (regs.eax > state.VelocityF64E08)
         {
-            regs.eax = _vehicleVelocityF64E08 * -16;
+            regs.eax = state.VelocityF64E08 * -16;
             vehicle->acceleration = regs.eax;
         }
     }
@@ -8560,7 +8551,7 @@ loc_6DBA33:;
     {
         regs.eax = get_booster_speed(ride->type, (vehicle->brake_speed << 16));
 
-        if (regs.eax < _vehicleVelocityF64E08)
+        if (regs.eax < state.VelocityF64E08)
         {
             regs.eax = RideProperties[ride->type].booster_acceleration << 16;
             vehicle->acceleration = regs.eax;
@@ -8572,7 +8563,7 @@ loc_6DBA33:;
     {
         vehicle_update_crossings(vehicle);
 
-        if (!vehicle_update_track_motion_backwards_get_new_track(vehicle, trackType, ride, (uint16_t*)&regs.ax))
+        if (!vehicle_update_track_motion_backwards_get_new_track(state, vehicle, trackType, ride, (uint16_t*)&regs.ax))
         {
             goto loc_6DBE5E;
         }
@@ -8587,23 +8578,23 @@ loc_6DBA33:;
         int16_t z = vehicle->track_z + moveInfo->z + RideData5[ride->type].z_offset;
 
         regs.ebx = 0;
-        if (x != unk_F64E20.x)
+        if (x != state.UnkF64E20.x)
         {
             regs.ebx |= 1;
         }
-        if (y != unk_F64E20.y)
+        if (y != state.UnkF64E20.y)
         {
             regs.ebx |= 2;
         }
-        if (z != unk_F64E20.z)
+        if (z != state.UnkF64E20.z)
         {
             regs.ebx |= 4;
         }
         vehicle->remaining_distance += dword_9A2930[regs.ebx];
 
-        unk_F64E20.x = x;
-        unk_F64E20.y = y;
-        unk_F64E20.z = z;
+        state.UnkF64E20.x = x;
+        state.UnkF64E20.y = y;
+        state.UnkF64E20.z = z;
         vehicle->sprite_direction = moveInfo->direction;
         vehicle->bank_rotation = moveInfo->bank_rotation;
         regs.ebx = moveInfo->vehicle_sprite_type;
@@ -8616,9 +8607,9 @@ loc_6DBA33:;
             vehicle->var_4E = 0;
         }
 
-        if (vehicle == _vehicleFrontVehicle)
+        if (vehicle == state.FrontVehicle)
         {
-            if (_vehicleVelocityF64E08 < 0)
+            if (state.VelocityF64E08 < 0)
             {
                 regs.bp = vehicle->next_vehicle_on_ride;
                 if (vehicle_update_motion_collision_detection(vehicle, x, y, z, (uint16_t*)&regs.bp))
@@ -8636,21 +8627,21 @@ loc_6DBA33:;
     }
     regs.ebx = dword_9A2970[regs.ebx];
     vehicle->acceleration += regs.ebx;
-    _vehicleUnkF64E10++;
+    state.UnkF64E10++;
     goto loc_6DBA33;
 
 loc_6DBE5E:
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-    _vehicleVelocityF64E0C -= vehicle->remaining_distance - 0x368A;
+    state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+    state.VelocityF64E0C -= vehicle->remaining_distance - 0x368A;
     vehicle->remaining_distance = 0x368A;
     return false;
 
 loc_6DBE7F:
-    _vehicleVelocityF64E0C -= vehicle->remaining_distance - 0x368A;
+    state.VelocityF64E0C -= vehicle->remaining_distance - 0x368A;
     vehicle->remaining_distance = 0x368A;
 
     rct_vehicle* v3 = GET_VEHICLE(regs.bp);
-    rct_vehicle* v4 = gCurrentVehicle;
+    rct_vehicle* v4 = state.CurrentVehicle;
 
     if (!(rideEntry->flags & RIDE_ENTRY_FLAG_DISABLE_COLLISION_CRASHES))
     {
@@ -8658,7 +8649,7 @@ loc_6DBE7F:
         {
             if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
             }
         }
     }
@@ -8666,14 +8657,14 @@ loc_6DBE7F:
     if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_GO_KART)
     {
         vehicle->velocity -= vehicle->velocity >> 2;
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+        state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
     }
     else
     {
         int32_t v3Velocity = v3->velocity;
         v3->velocity = v4->velocity >> 1;
         v4->velocity = v3Velocity >> 1;
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+        state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
     }
 
     return false;
@@ -8684,7 +8675,7 @@ loc_6DBE7F:
  *
  *
  */
-static int32_t vehicle_update_track_motion_mini_golf(rct_vehicle* vehicle, int32_t* outStation)
+static int32_t vehicle_update_track_motion_mini_golf(VehicleUpdateState& state, rct_vehicle* vehicle, int32_t* outStation)
 {
     registers regs = {};
 
@@ -8694,22 +8685,23 @@ static int32_t vehicle_update_track_motion_mini_golf(rct_vehicle* vehicle, int32
 
     TileElement* tileElement = nullptr;
 
-    gCurrentVehicle = vehicle;
-    _vehicleMotionTrackFlags = 0;
+    state.CurrentVehicle = vehicle;
+    state.MotionTrackFlags = 0;
+    state.StationIndex = 0xFF;
     vehicle->velocity += vehicle->acceleration;
-    _vehicleVelocityF64E08 = vehicle->velocity;
-    _vehicleVelocityF64E0C = (vehicle->velocity >> 10) * 42;
-    if (_vehicleVelocityF64E08 < 0)
+    state.VelocityF64E08 = vehicle->velocity;
+    state.VelocityF64E0C = (vehicle->velocity >> 10) * 42;
+    if (state.VelocityF64E08 < 0)
     {
         vehicle = vehicle_get_tail(vehicle);
     }
-    _vehicleFrontVehicle = vehicle;
+    state.FrontVehicle = vehicle;
 
 loc_6DC40E:
     regs.ebx = vehicle->vehicle_sprite_type;
-    _vehicleUnkF64E10 = 1;
+    state.UnkF64E10 = 1;
     vehicle->acceleration = dword_9A2970[vehicle->vehicle_sprite_type];
-    vehicle->remaining_distance = _vehicleVelocityF64E0C + vehicle->remaining_distance;
+    vehicle->remaining_distance = state.VelocityF64E0C + vehicle->remaining_distance;
     if (vehicle->remaining_distance < 0)
     {
         goto loc_6DCA7A;
@@ -8719,9 +8711,9 @@ loc_6DC40E:
         goto loc_6DCE02;
     }
     vehicle->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-    unk_F64E20.x = vehicle->x;
-    unk_F64E20.y = vehicle->y;
-    unk_F64E20.z = vehicle->z;
+    state.UnkF64E20.x = vehicle->x;
+    state.UnkF64E20.y = vehicle->y;
+    state.UnkF64E20.z = vehicle->z;
     vehicle_invalidate(vehicle);
 
 loc_6DC462:
@@ -8823,8 +8815,8 @@ loc_6DC476:
 
     {
         uint16_t trackType = vehicle->track_type >> 2;
-        _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
-        _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_end;
+        state.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
+        state.BankEndF64E37 = TrackDefinitions[trackType].bank_end;
         tileElement = map_get_track_element_at_of_type_seq(
             vehicle->track_x, vehicle->track_y, vehicle->track_z >> 3, trackType, 0);
     }
@@ -8847,7 +8839,7 @@ loc_6DC476:
         direction = outDirection;
     }
 
-    if (!loc_6DB38B(vehicle, tileElement))
+    if (!loc_6DB38B(state, vehicle, tileElement))
     {
         goto loc_6DC9BC;
     }
@@ -8988,15 +8980,15 @@ loc_6DC743:
 
     // Investigate redundant code
     regs.ebx = 0;
-    if (regs.ax != unk_F64E20.x)
+    if (regs.ax != state.UnkF64E20.x)
     {
         regs.ebx |= 1;
     }
-    if (regs.cx == unk_F64E20.y)
+    if (regs.cx == state.UnkF64E20.y)
     {
         regs.ebx |= 2;
     }
-    if (regs.dx == unk_F64E20.z)
+    if (regs.dx == state.UnkF64E20.z)
     {
         regs.ebx |= 4;
     }
@@ -9007,9 +8999,9 @@ loc_6DC743:
         vehicle->remaining_distance = 0;
     }
 
-    unk_F64E20.x = x;
-    unk_F64E20.y = y;
-    unk_F64E20.z = z;
+    state.UnkF64E20.x = x;
+    state.UnkF64E20.y = y;
+    state.UnkF64E20.z = z;
     vehicle->sprite_direction = moveInfo->direction;
     vehicle->bank_rotation = moveInfo->bank_rotation;
     vehicle->vehicle_sprite_type = moveInfo->vehicle_sprite_type;
@@ -9024,9 +9016,9 @@ loc_6DC743:
         }
     }
 
-    if (vehicle == _vehicleFrontVehicle)
+    if (vehicle == state.FrontVehicle)
     {
-        if (_vehicleVelocityF64E08 >= 0)
+        if (state.VelocityF64E08 >= 0)
         {
             regs.bp = vehicle->prev_vehicle_on_ride;
             vehicle_update_motion_collision_detection(vehicle, x, y, z, (uint16_t*)&regs.bp);
@@ -9048,12 +9040,12 @@ loc_6DC99A:
         goto loc_6DCDE4;
     }
     vehicle->acceleration = dword_9A2970[vehicle->vehicle_sprite_type];
-    _vehicleUnkF64E10++;
+    state.UnkF64E10++;
     goto loc_6DC462;
 
 loc_6DC9BC:
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-    _vehicleVelocityF64E0C -= vehicle->remaining_distance + 1;
+    state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+    state.VelocityF64E0C -= vehicle->remaining_distance + 1;
     vehicle->remaining_distance = -1;
     goto loc_6DCD2B;
 
@@ -9063,9 +9055,9 @@ loc_6DC9BC:
 
 loc_6DCA7A:
     vehicle->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-    unk_F64E20.x = vehicle->x;
-    unk_F64E20.y = vehicle->y;
-    unk_F64E20.z = vehicle->z;
+    state.UnkF64E20.x = vehicle->x;
+    state.UnkF64E20.y = vehicle->y;
+    state.UnkF64E20.z = vehicle->z;
     vehicle_invalidate(vehicle);
 
 loc_6DCA9A:
@@ -9077,8 +9069,8 @@ loc_6DCA9A:
 
     {
         uint16_t trackType = vehicle->track_type >> 2;
-        _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
-        _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_end;
+        state.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
+        state.BankEndF64E37 = TrackDefinitions[trackType].bank_end;
 
         tileElement = map_get_track_element_at_of_type_seq(
             vehicle->track_x, vehicle->track_y, vehicle->track_z >> 3, trackType, 0);
@@ -9096,7 +9088,7 @@ loc_6DCA9A:
         tileElement = trackBeginEnd.begin_element;
     }
 
-    if (!loc_6DB38B(vehicle, tileElement))
+    if (!loc_6DB38B(state, vehicle, tileElement))
     {
         goto loc_6DCD4A;
     }
@@ -9122,9 +9114,9 @@ loc_6DCA9A:
         vehicle->update_flags &= ~VEHICLE_UPDATE_FLAG_ON_LIFT_HILL;
         if (vehicle->next_vehicle_on_train == SPRITE_INDEX_NULL)
         {
-            if (_vehicleVelocityF64E08 < 0)
+            if (state.VelocityF64E08 < 0)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
+                state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
             }
         }
     }
@@ -9145,15 +9137,15 @@ loc_6DCC2C:
 
     // Investigate redundant code
     regs.ebx = 0;
-    if (regs.ax != unk_F64E20.x)
+    if (regs.ax != state.UnkF64E20.x)
     {
         regs.ebx |= 1;
     }
-    if (regs.cx == unk_F64E20.y)
+    if (regs.cx == state.UnkF64E20.y)
     {
         regs.ebx |= 2;
     }
-    if (regs.dx == unk_F64E20.z)
+    if (regs.dx == state.UnkF64E20.z)
     {
         regs.ebx |= 4;
     }
@@ -9164,9 +9156,9 @@ loc_6DCC2C:
         vehicle->remaining_distance = 0;
     }
 
-    unk_F64E20.x = x;
-    unk_F64E20.y = y;
-    unk_F64E20.z = z;
+    state.UnkF64E20.x = x;
+    state.UnkF64E20.y = y;
+    state.UnkF64E20.z = z;
     vehicle->sprite_direction = moveInfo->direction;
     vehicle->bank_rotation = moveInfo->bank_rotation;
     vehicle->vehicle_sprite_type = moveInfo->vehicle_sprite_type;
@@ -9181,9 +9173,9 @@ loc_6DCC2C:
         }
     }
 
-    if (vehicle == _vehicleFrontVehicle)
+    if (vehicle == state.FrontVehicle)
     {
-        if (_vehicleVelocityF64E08 >= 0)
+        if (state.VelocityF64E08 >= 0)
         {
             regs.bp = vehicle->var_44;
             if (vehicle_update_motion_collision_detection(vehicle, x, y, z, (uint16_t*)&regs.bp))
@@ -9199,42 +9191,42 @@ loc_6DCD2B:
         goto loc_6DCDE4;
     }
     vehicle->acceleration += dword_9A2970[vehicle->vehicle_sprite_type];
-    _vehicleUnkF64E10++;
+    state.UnkF64E10++;
     goto loc_6DCA9A;
 
 loc_6DCD4A:
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-    _vehicleVelocityF64E0C -= vehicle->remaining_distance - 0x368A;
+    state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+    state.VelocityF64E0C -= vehicle->remaining_distance - 0x368A;
     vehicle->remaining_distance = 0x368A;
     regs.ebx = vehicle->vehicle_sprite_type;
     goto loc_6DC99A;
 
 loc_6DCD6B:
-    _vehicleVelocityF64E0C -= vehicle->remaining_distance - 0x368A;
+    state.VelocityF64E0C -= vehicle->remaining_distance - 0x368A;
     vehicle->remaining_distance = 0x368A;
     {
         rct_vehicle* vEBP = GET_VEHICLE(regs.bp);
-        rct_vehicle* vEDI = gCurrentVehicle;
+        rct_vehicle* vEDI = state.CurrentVehicle;
         regs.eax = abs(vEDI->velocity - vEBP->velocity);
         if (regs.eax > 0xE0000)
         {
             if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
             }
         }
         vEDI->velocity = vEBP->velocity >> 1;
         vEBP->velocity = vEDI->velocity >> 1;
     }
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+    state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
     goto loc_6DC99A;
 
 loc_6DCDE4:
-    sprite_move(unk_F64E20.x, unk_F64E20.y, unk_F64E20.z, (rct_sprite*)vehicle);
+    sprite_move(state.UnkF64E20.x, state.UnkF64E20.y, state.UnkF64E20.z, (rct_sprite*)vehicle);
     vehicle_invalidate(vehicle);
 
 loc_6DCE02:
-    vehicle->acceleration /= _vehicleUnkF64E10;
+    vehicle->acceleration /= state.UnkF64E10;
     if (vehicle->var_CD == 2)
     {
         goto loc_6DCEB2;
@@ -9245,18 +9237,18 @@ loc_6DCE02:
         {
             goto loc_6DCEB2;
         }
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
+        state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
         if (trackType != TRACK_ELEM_END_STATION)
         {
             goto loc_6DCEB2;
         }
     }
-    if (vehicle != gCurrentVehicle)
+    if (vehicle != state.CurrentVehicle)
     {
         goto loc_6DCEB2;
     }
     regs.ax = vehicle->track_progress;
-    if (_vehicleVelocityF64E08 < 0)
+    if (state.VelocityF64E08 < 0)
     {
         goto loc_6DCE62;
     }
@@ -9274,7 +9266,7 @@ loc_6DCE62:
     }
 
 loc_6DCE68:
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+    state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
     regs.al = vehicle->track_x >> 5;
     regs.ah = vehicle->track_y >> 5;
     regs.dl = vehicle->track_z >> 3;
@@ -9288,15 +9280,15 @@ loc_6DCE68:
         {
             continue;
         }
-        _vehicleStationIndex = i;
+        state.StationIndex = i;
     }
 
 loc_6DCEB2:
     if (vehicle->update_flags & VEHICLE_UPDATE_FLAG_ON_LIFT_HILL)
     {
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
+        state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
     }
-    if (_vehicleVelocityF64E08 >= 0)
+    if (state.VelocityF64E08 >= 0)
     {
         regs.si = vehicle->next_vehicle_on_train;
         if ((uint16_t)regs.si == SPRITE_INDEX_NULL)
@@ -9307,7 +9299,7 @@ loc_6DCEB2:
         goto loc_6DC40E;
     }
 
-    if (vehicle == gCurrentVehicle)
+    if (vehicle == state.CurrentVehicle)
     {
         goto loc_6DCEFF;
     }
@@ -9315,7 +9307,7 @@ loc_6DCEB2:
     goto loc_6DC40E;
 
 loc_6DCEFF:
-    vehicle = gCurrentVehicle;
+    vehicle = state.CurrentVehicle;
     regs.eax = 0;
     regs.ebp = 0;
     regs.dx = 0;
@@ -9335,7 +9327,7 @@ loc_6DCEFF:
         vehicle = GET_VEHICLE((uint16_t)regs.si);
     }
 
-    vehicle = gCurrentVehicle;
+    vehicle = state.CurrentVehicle;
     regs.eax /= regs.ebx;
     regs.ecx = (regs.eax * 21) >> 9;
     regs.eax = vehicle->velocity >> 12;
@@ -9420,8 +9412,8 @@ loc_6DCEFF:
 
 loc_6DD069:
     vehicle->acceleration = regs.ecx;
-    regs.eax = _vehicleMotionTrackFlags;
-    regs.ebx = _vehicleStationIndex;
+    regs.eax = state.MotionTrackFlags;
+    regs.ebx = state.StationIndex;
 
     if (outStation != nullptr)
         *outStation = regs.ebx;
@@ -9544,11 +9536,20 @@ static void vehicle_update_track_motion_powered_ride_acceleration(
     *acceleration += poweredAcceleration;
 }
 
+/**
+ * Moves a train along the track outside of the regular vehicle update, e.g. when placing trains on a newly opened ride.
+ */
+int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
+{
+    VehicleUpdateState state;
+    return vehicle_update_track_motion(state, vehicle, outStation);
+}
+
 /**
  *
  *  rct2: 0x006DAB4C
  */
-int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
+int32_t vehicle_update_track_motion(VehicleUpdateState& state, rct_vehicle* vehicle, int32_t* outStation)
 {
     registers regs = {};
 
@@ -9563,25 +9564,25 @@ int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
 
     if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_MINI_GOLF)
     {
-        return vehicle_update_track_motion_mini_golf(vehicle, outStation);
+        return vehicle_update_track_motion_mini_golf(state, vehicle, outStation);
     }
 
-    _vehicleF64E2C = 0;
-    gCurrentVehicle = vehicle;
-    _vehicleMotionTrackFlags = 0;
-    _vehicleStationIndex = 0xFF;
+    state.F64E2C = 0;
+    state.CurrentVehicle = vehicle;
+    state.MotionTrackFlags = 0;
+    state.StationIndex = 0xFF;
 
-    vehicle_update_track_motion_up_stop_check(vehicle);
-    check_and_apply_block_section_stop_site(vehicle);
-    update_velocity(vehicle);
+    vehicle_update_track_motion_up_stop_check(state, vehicle);
+    check_and_apply_block_section_stop_site(state, vehicle);
+    update_velocity(state, vehicle);
 
-    if (_vehicleVelocityF64E08 < 0)
+    if (state.VelocityF64E08 < 0)
     {
         vehicle = vehicle_get_tail(vehicle);
     }
     // This will be the front vehicle even when traveling
     // backwards.
-    _vehicleFrontVehicle = vehicle;
+    state.FrontVehicle = vehicle;
 
     uint16_t spriteId = vehicle->sprite_index;
     while (spriteId != SPRITE_INDEX_NULL)
@@ -9596,28 +9597,28 @@ int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
         // Swinging cars
         if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_SWINGING)
         {
-            vehicle_update_swinging_car(car);
+            vehicle_update_swinging_car(state, car);
         }
         // Spinning cars
         if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_SPINNING)
         {
-            vehicle_update_spinning_car(car);
+            vehicle_update_spinning_car(state, car);
         }
         // Rider sprites?? animation??
         if ((vehicleEntry->flags & VEHICLE_ENTRY_FLAG_VEHICLE_ANIMATION)
             || (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_RIDER_ANIMATION))
         {
-            vehicle_update_additional_animation(car);
+            vehicle_update_additional_animation(state, car);
         }
         car->acceleration = dword_9A2970[car->vehicle_sprite_type];
-        _vehicleUnkF64E10 = 1;
+        state.UnkF64E10 = 1;
 
-        car->remaining_distance += _vehicleVelocityF64E0C;
+        car->remaining_distance += state.VelocityF64E0C;
 
         car->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        unk_F64E20.x = car->x;
-        unk_F64E20.y = car->y;
-        unk_F64E20.z = car->z;
+        state.UnkF64E20.x = car->x;
+        state.UnkF64E20.y = car->y;
+        state.UnkF64E20.z = car->z;
         invalidate_sprite_2((rct_sprite*)car);
 
         while (true)
@@ -9625,7 +9626,7 @@ int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
             if (car->remaining_distance < 0)
             {
                 // Backward loop
-                if (vehicle_update_track_motion_backwards(car, vehicleEntry, ride, rideEntry))
+                if (vehicle_update_track_motion_backwards(state, car, vehicleEntry, ride, rideEntry))
                 {
                     break;
                 }
@@ -9637,7 +9638,7 @@ int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
                     }
                     regs.ebx = dword_9A2970[car->vehicle_sprite_type];
                     car->acceleration += regs.ebx;
-                    _vehicleUnkF64E10++;
+                    state.UnkF64E10++;
                     continue;
                 }
             }
@@ -9646,7 +9647,7 @@ int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
                 // Location found
                 goto loc_6DBF3E;
             }
-            if (vehicle_update_track_motion_forwards(car, vehicleEntry, ride, rideEntry))
+            if (vehicle_update_track_motion_forwards(state, car, vehicleEntry, ride, rideEntry))
             {
                 break;
             }
@@ -9658,29 +9659,29 @@ int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
                 }
                 regs.ebx = dword_9A2970[car->vehicle_sprite_type];
                 car->acceleration = regs.ebx;
-                _vehicleUnkF64E10++;
+                state.UnkF64E10++;
                 continue;
             }
         }
         // loc_6DBF20
-        sprite_move(unk_F64E20.x, unk_F64E20.y, unk_F64E20.z, (rct_sprite*)car);
+        sprite_move(state.UnkF64E20.x, state.UnkF64E20.y, state.UnkF64E20.z, (rct_sprite*)car);
         invalidate_sprite_2((rct_sprite*)car);
 
     loc_6DBF3E:
-        sub_6DBF3E(car);
+        sub_6DBF3E(state, car);
 
         // loc_6DC0F7
         if (car->update_flags & VEHICLE_UPDATE_FLAG_ON_LIFT_HILL)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
+            state.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
         }
-        if (_vehicleVelocityF64E08 >= 0)
+        if (state.VelocityF64E08 >= 0)
         {
             spriteId = car->next_vehicle_on_train;
         }
         else
         {
-            if (car == gCurrentVehicle)
+            if (car == state.CurrentVehicle)
             {
                 break;
             }
@@ -9688,7 +9689,7 @@ int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
         }
     }
     // loc_6DC144
-    vehicle = gCurrentVehicle;
+    vehicle = state.CurrentVehicle;
 
     vehicleEntry = vehicle_get_vehicle_entry(vehicle);
     // eax
@@ -9716,7 +9717,7 @@ int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
         vehicle = GET_VEHICLE(spriteIndex);
     }
 
-    vehicle = gCurrentVehicle;
+    vehicle = state.CurrentVehicle;
     regs.eax = (totalAcceleration / numVehicles) * 21;
     if (regs.eax < 0)
     {
@@ -9796,8 +9797,8 @@ int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation)
 
     vehicle->acceleration = acceleration;
 
-    regs.eax = _vehicleMotionTrackFlags;
-    regs.ebx = _vehicleStationIndex;
+    regs.eax = state.MotionTrackFlags;
+    regs.ebx = state.StationIndex;
 
     // hook_setreturnregisters(&regs);
     if (outStation != nullptr)
@@ -241,6 +241,26 @@ struct train_ref
     rct_vehicle* tail;
 };
 
+/**
+ * Scratch state of a single train update. The original game kept these at fixed addresses, they are now passed through
+ * the update so one train's physics step does not depend on any other train.
+ */
+struct VehicleUpdateState
+{
+    rct_vehicle* CurrentVehicle = nullptr;
+    rct_vehicle* FrontVehicle = nullptr;
+    uint8_t Breakdown = 255;
+    uint8_t StationIndex = 0xFF;
+    uint32_t MotionTrackFlags = 0;
+    int32_t VelocityF64E08 = 0;
+    int32_t VelocityF64E0C = 0;
+    int32_t UnkF64E10 = 0;
+    uint8_t VAngleEndF64E36 = 0;
+    uint8_t BankEndF64E37 = 0;
+    uint8_t F64E2C = 0;
+    LocationXYZ16 UnkF64E20 = {};
+};
+
 // Size: 0x09
 struct rct_vehicle_info
 {
@@ -461,6 +481,7 @@ void vehicle_get_g_forces(const rct_vehicle* vehicle, int32_t* verticalG, int32_
 void vehicle_set_map_toolbar(const rct_vehicle* vehicle);
 int32_t vehicle_is_used_in_pairs(const rct_vehicle* vehicle);
 int32_t vehicle_update_track_motion(rct_vehicle* vehicle, int32_t* outStation);
+int32_t vehicle_update_track_motion(VehicleUpdateState& state, rct_vehicle* vehicle, int32_t* outStation);
 rct_ride_entry_vehicle* vehicle_get_vehicle_entry(const rct_vehicle* vehicle);
 int32_t vehicle_get_total_num_peeps(const rct_vehicle* vehicle);
 void vehicle_invalidate_window(rct_vehicle* vehicle);
@@ -473,18 +494,6 @@ const rct_vehicle_info* vehicle_get_move_info(int32_t cd, int32_t typeAndDirecti
 uint16_t vehicle_get_move_info_size(int32_t cd, int32_t typeAndDirection);
 bool vehicle_update_dodgems_collision(rct_vehicle* vehicle, int16_t x, int16_t y, uint16_t* spriteId);
 
-extern rct_vehicle* gCurrentVehicle;
-extern uint8_t _vehicleStationIndex;
-extern uint32_t _vehicleMotionTrackFlags;
-extern int32_t _vehicleVelocityF64E08;
-extern int32_t _vehicleVelocityF64E0C;
-extern int32_t _vehicleUnkF64E10;
-extern uint8_t _vehicleVAngleEndF64E36;
-extern uint8_t _vehicleBankEndF64E37;
-extern uint8_t _vehicleF64E2C;
-extern rct_vehicle* _vehicleFrontVehicle;
-extern LocationXYZ16 unk_F64E20;
-
 /** Helper macro until rides are stored in this module. */
 #define GET_VEHICLE(sprite_index) &(get_sprite(sprite_index)->vehicle)
 
@@ -24,6 +24,7 @@
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../util/Util.h"
+#include "FootpathConnectivity.h"
 #include "Map.h"
 #include "MapAnimation.h"
 #include "Park.h"
@@ -31,9 +32,12 @@
 #include "Surface.h"
 
 #include <algorithm>
+#include <bitset>
 #include <iterator>
+#include <utility>
 
 void footpath_update_queue_entrance_banner(int32_t x, int32_t y, TileElement* tileElement);
+static void footpath_invalidate_path_wide_flags_around(int32_t x, int32_t y);
 
 uint8_t gFootpathProvisionalFlags;
 LocationXYZ16 gFootpathProvisionalPosition;
@@ -52,6 +56,10 @@ uint8_t gFootpathGroundFlags;
 static uint8_t* _footpathQueueChainNext;
 static uint8_t _footpathQueueChain[64];
 
+// Tiles whose wide flags may change the next time map_update_path_wide_flags reaches them, see
+// footpath_update_path_wide_flags
+static std::bitset<MAX_TILE_TILE_ELEMENT_POINTERS> _footpathWideFlagsDirtyTiles;
+
 // This is the coordinates that a user of the bin should move to
 // rct2: 0x00992A4C
 const LocationXY16 BinUseOffsets[4] = {
@@ -292,6 +300,7 @@ static money32 footpath_element_insert(
             pathElement->SetIsBroken(false);
             if (flags & GAME_COMMAND_FLAG_GHOST)
                 pathElement->SetGhost(true);
+            footpath_invalidate_path_wide_flags(x, y);
 
             footpath_queue_chain_reset();
 
@@ -395,6 +404,7 @@ static money32 footpath_element_update(
 
         tileElement->AsPath()->SetAddition(pathItemType);
         tileElement->AsPath()->SetIsBroken(false);
+        map_mark_tile_for_update(x, y);
         if (pathItemType != 0)
         {
             rct_scenery_entry* scenery_entry = get_footpath_item_entry(pathItemType - 1);
@@ -424,6 +434,8 @@ static money32 footpath_element_update(
             tileElement->AsPath()->SetIsQueue(false);
         tileElement->AsPath()->SetAddition(pathItemType);
         tileElement->AsPath()->SetIsBroken(false);
+        footpath_invalidate_path_wide_flags(x, y);
+        map_mark_tile_for_update(x, y);
 
         loc_6A6620(flags, x, y, tileElement);
     }
@@ -687,6 +699,7 @@ static money32 footpath_place_from_track(
             pathElement->SetIsBroken(false);
             if (flags & (1 << 6))
                 pathElement->SetGhost(true);
+            footpath_invalidate_path_wide_flags(x, y);
 
             map_invalidate_tile_full(x, y);
         }
@@ -1167,6 +1180,8 @@ static void footpath_connect_corners(int32_t initialX, int32_t initialY, TileEle
         direction = initialDirection;
         tileElement[0]->AsPath()->SetCorners(tileElement[0]->AsPath()->GetCorners() | (1 << (direction)));
         map_invalidate_element(x, y, tileElement[0]);
+
+        footpath_invalidate_path_wide_flags_around(initialX, initialY);
     }
 }
 
@@ -1313,7 +1328,11 @@ static bool sub_footpath_disconnect_queue_from_path(
             otherTileElement->AsPath()->SetEdges(otherTileElement->AsPath()->GetEdges() | (1 << ((direction + 2) & 3)));
         }
         if (action != 0)
+        {
             map_invalidate_tile_full(x1, y1);
+            footpath_invalidate_path_wide_flags(x, y);
+            footpath_invalidate_path_wide_flags(x1, y1);
+        }
         return true;
     }
     return false;
@@ -1486,6 +1505,7 @@ static void loc_6A6D7E(
         {
             footpath_disconnect_queue_from_path(x, y, tileElement, 1 + ((flags >> 6) & 1));
             tileElement->AsPath()->SetEdges(tileElement->AsPath()->GetEdges() | (1 << direction_reverse(direction)));
+            footpath_invalidate_path_wide_flags(x, y);
             if (tileElement->AsPath()->IsQueue())
             {
                 footpath_queue_chain_push(tileElement->AsPath()->GetRideIndex());
@@ -1505,6 +1525,7 @@ loc_6A6FD2:
         {
             initialTileElement->AsPath()->SetEdges(initialTileElement->AsPath()->GetEdges() | (1 << direction));
             map_invalidate_element(initialX, initialY, initialTileElement);
+            footpath_invalidate_path_wide_flags(initialX, initialY);
         }
     }
 }
@@ -1708,6 +1729,7 @@ void footpath_chain_ride_queue(
             tileElement->AsPath()->SetStationIndex(entranceIndex);
 
             map_invalidate_element(x, y, tileElement);
+            footpath_invalidate_path_wide_flags(x, y);
 
             if (lastQueuePathElement == nullptr)
             {
@@ -1930,6 +1952,14 @@ static int32_t footpath_is_connected_to_map_edge_recurse(
     return level == 1 ? FOOTPATH_SEARCH_NOT_FOUND : FOOTPATH_SEARCH_INCOMPLETE;
 
 searchFromFootpath:
+    // A network without any path leading off the map cannot be searched successfully, whatever way the search goes
+    if (level == 1
+        && !(footpath_connectivity_get_flags({ x >> 5, y >> 5, tileElement->base_height })
+             & FOOTPATH_CONNECTIVITY_FLAG_MAP_EDGE))
+    {
+        return FOOTPATH_SEARCH_INCOMPLETE;
+    }
+
     // Exclude direction we came from
     z = tileElement->base_height;
     edges &= ~(1 << direction);
@@ -2228,7 +2258,7 @@ static TileElement* footpath_can_be_wide(int32_t x, int32_t y, uint8_t height)
  *
  *  rct2: 0x006A87BB
  */
-void footpath_update_path_wide_flags(int32_t x, int32_t y)
+static void footpath_recalculate_path_wide_flags(int32_t x, int32_t y)
 {
     if (x < 0x20)
         return;
@@ -2430,6 +2460,163 @@ void footpath_update_path_wide_flags(int32_t x, int32_t y)
     } while (!(tileElement++)->IsLastForTile());
 }
 
+/**
+ * Gets the wide flags of the paths on a tile as a mask, in the order of the elements.
+ */
+static uint32_t footpath_get_path_wide_flags(int32_t x, int32_t y)
+{
+    uint32_t wideFlags = 0;
+    int32_t pathIndex = 0;
+    const TileElement* tileElement = map_get_first_element_at(x / 32, y / 32);
+    do
+    {
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
+        if (tileElement->AsPath()->IsWide())
+            wideFlags |= 1u << (pathIndex & 31);
+        pathIndex++;
+    } while (!(tileElement++)->IsLastForTile());
+    return wideFlags;
+}
+
+static void footpath_set_path_wide_flags(int32_t x, int32_t y, uint32_t wideFlags)
+{
+    int32_t pathIndex = 0;
+    TileElement* tileElement = map_get_first_element_at(x / 32, y / 32);
+    do
+    {
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
+        tileElement->AsPath()->SetWide((wideFlags & (1u << (pathIndex & 31))) != 0);
+        pathIndex++;
+    } while (!(tileElement++)->IsLastForTile());
+}
+
+static void footpath_set_path_wide_flags_dirty(int32_t tileX, int32_t tileY)
+{
+    if (tileX >= 0 && tileY >= 0 && tileX < MAXIMUM_MAP_SIZE_TECHNICAL && tileY < MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        _footpathWideFlagsDirtyTiles[tileY * MAXIMUM_MAP_SIZE_TECHNICAL + tileX] = true;
+    }
+}
+
+/**
+ * Updates the wide flags of the paths on a tile, as part of the sweep over the map done by map_update_path_wide_flags.
+ *
+ * The flags of a tile only depend on the paths on it and its neighbours, and on the wide flags of the neighbours the
+ * sweep has already been over: the ones at -x -y, -x, +x -y and -y. So a tile is only recalculated if one of those has
+ * changed since the sweep last reached it, anything else would give the flags it already has. The sweep itself is kept
+ * as it is, peeps see the flags change at exactly the same time as they always did.
+ * @param x x-coordinate in units (not tiles)
+ * @param y y-coordinate in units (not tiles)
+ */
+void footpath_update_path_wide_flags(int32_t x, int32_t y)
+{
+    int32_t tileX = x / 32;
+    int32_t tileY = y / 32;
+    int32_t tileIndex = tileY * MAXIMUM_MAP_SIZE_TECHNICAL + tileX;
+    if (!_footpathWideFlagsDirtyTiles[tileIndex])
+    {
+        return;
+    }
+    _footpathWideFlagsDirtyTiles[tileIndex] = false;
+
+    uint32_t wideFlags = footpath_get_path_wide_flags(x, y);
+    footpath_recalculate_path_wide_flags(x, y);
+    if (footpath_get_path_wide_flags(x, y) != wideFlags)
+    {
+        // The tiles that look at the flags of this one
+        footpath_set_path_wide_flags_dirty(tileX + 1, tileY);
+        footpath_set_path_wide_flags_dirty(tileX - 1, tileY + 1);
+        footpath_set_path_wide_flags_dirty(tileX, tileY + 1);
+        footpath_set_path_wide_flags_dirty(tileX + 1, tileY + 1);
+    }
+}
+
+/**
+ * Marks the wide flags of a tile and its neighbours as needing to be recalculated, for when a path on the tile has been
+ * added, removed or had its edges, corners, slope or queue flag changed. The tile is also queued to be brought up to
+ * date in the path connectivity index.
+ * @param x x-coordinate in units (not tiles)
+ * @param y y-coordinate in units (not tiles)
+ */
+void footpath_invalidate_path_wide_flags(int32_t x, int32_t y)
+{
+    int32_t tileX = x >> 5;
+    int32_t tileY = y >> 5;
+    for (int32_t yOffset = -1; yOffset <= 1; yOffset++)
+    {
+        for (int32_t xOffset = -1; xOffset <= 1; xOffset++)
+        {
+            footpath_set_path_wide_flags_dirty(tileX + xOffset, tileY + yOffset);
+        }
+    }
+    footpath_connectivity_update_tile(tileX, tileY);
+}
+
+/**
+ * As footpath_invalidate_path_wide_flags, for changes to the paths of a tile and any of its neighbours.
+ */
+static void footpath_invalidate_path_wide_flags_around(int32_t x, int32_t y)
+{
+    for (int32_t yOffset = -1; yOffset <= 1; yOffset++)
+    {
+        for (int32_t xOffset = -1; xOffset <= 1; xOffset++)
+        {
+            footpath_invalidate_path_wide_flags(x + xOffset * 32, y + yOffset * 32);
+        }
+    }
+}
+
+void footpath_invalidate_all_path_wide_flags()
+{
+    _footpathWideFlagsDirtyTiles.set();
+    footpath_connectivity_invalidate();
+}
+
+/**
+ * Exchanges which tiles need their wide flags recalculated with the ones put aside by map_swap_storage.
+ */
+void footpath_swap_path_wide_flags_state()
+{
+    static std::bitset<MAX_TILE_TILE_ELEMENT_POINTERS> stashedDirtyTiles;
+    std::swap(_footpathWideFlagsDirtyTiles, stashedDirtyTiles);
+    footpath_connectivity_swap_state();
+}
+
+/**
+ * Checks that recalculating the wide flags of every tile that is not waiting to be recalculated would not change them,
+ * i.e. that skipping those tiles gives the same flags as updating every tile. Returns the number of tiles that differ.
+ */
+int32_t footpath_verify_path_wide_flags()
+{
+    int32_t numMismatches = 0;
+    for (int32_t tileY = 0; tileY < MAXIMUM_MAP_SIZE_TECHNICAL; tileY++)
+    {
+        for (int32_t tileX = 0; tileX < MAXIMUM_MAP_SIZE_TECHNICAL; tileX++)
+        {
+            if (_footpathWideFlagsDirtyTiles[tileY * MAXIMUM_MAP_SIZE_TECHNICAL + tileX])
+            {
+                continue;
+            }
+
+            int32_t x = tileX * 32;
+            int32_t y = tileY * 32;
+            uint32_t wideFlags = footpath_get_path_wide_flags(x, y);
+            footpath_recalculate_path_wide_flags(x, y);
+            uint32_t expectedWideFlags = footpath_get_path_wide_flags(x, y);
+            if (expectedWideFlags != wideFlags)
+            {
+                log_warning(
+                    "Wide flags of the paths at %d, %d are 0x%X, should be 0x%X", tileX, tileY, wideFlags, expectedWideFlags);
+                footpath_set_path_wide_flags(x, y, wideFlags);
+                numMismatches++;
+            }
+        }
+    }
+    return numMismatches;
+}
+
 bool footpath_is_blocked_by_vehicle(const TileCoordsXYZ& position)
 {
     auto pathElement = map_get_path_element_at(position.x, position.y, position.z);
@@ -2488,6 +2675,7 @@ static void footpath_remove_edges_towards_here(
     cd = ((cd + 1) & 3);
     tileElement->AsPath()->SetCorners(tileElement->AsPath()->GetCorners() & ~(1 << cd));
     map_invalidate_tile(x, y, tileElement->base_height * 8, tileElement->clearance_height * 8);
+    footpath_invalidate_path_wide_flags(x, y);
 
     if (isQueue)
         footpath_disconnect_queue_from_path(x, y, tileElement, -1);
@@ -2510,6 +2698,7 @@ static void footpath_remove_edges_towards_here(
         cd = ((direction + 1) & 3);
         tileElement->AsPath()->SetCorners(tileElement->AsPath()->GetCorners() & ~(1 << cd));
         map_invalidate_tile(x, y, tileElement->base_height * 8, tileElement->clearance_height * 8);
+        footpath_invalidate_path_wide_flags(x, y);
         break;
     } while (!(tileElement++)->IsLastForTile());
 }
@@ -2640,6 +2829,8 @@ static void footpath_fix_corners_around(int32_t x, int32_t y, TileElement* pathE
     if (pathElement->GetType() == TILE_ELEMENT_TYPE_PATH && pathElement->AsPath()->IsSloped())
         return;
 
+    footpath_invalidate_path_wide_flags_around(x * 32, y * 32);
+
     for (int32_t xOffset = -1; xOffset <= 1; xOffset++)
     {
         for (int32_t yOffset = -1; yOffset <= 1; yOffset++)
@@ -2726,7 +2917,10 @@ void footpath_remove_edges_at(int32_t x, int32_t y, TileElement* tileElement)
     }
 
     if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH)
+    {
         tileElement->AsPath()->SetEdgesAndCorners(0);
+        footpath_invalidate_path_wide_flags(x, y);
+    }
 }
 
 PathSurfaceEntry* get_path_surface_entry(int32_t entryIndex)
@@ -196,6 +196,10 @@ bool fence_in_the_way(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t dire
 void footpath_chain_ride_queue(
     ride_id_t rideIndex, int32_t entranceIndex, int32_t x, int32_t y, TileElement* tileElement, int32_t direction);
 void footpath_update_path_wide_flags(int32_t x, int32_t y);
+void footpath_invalidate_path_wide_flags(int32_t x, int32_t y);
+void footpath_invalidate_all_path_wide_flags();
+void footpath_swap_path_wide_flags_state();
+int32_t footpath_verify_path_wide_flags();
 bool footpath_is_blocked_by_vehicle(const TileCoordsXYZ& position);
 
 int32_t footpath_is_connected_to_map_edge(int32_t x, int32_t y, int32_t z, int32_t direction, int32_t flags);
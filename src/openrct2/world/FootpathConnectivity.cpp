@@ -0,0 +1,460 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "FootpathConnectivity.h"
+
+#include "Map.h"
+
+#include <utility>
+#include <vector>
+
+// Which paths can be reached from each other, kept as a union-find over every path element of the map. Two paths are
+// in the same component when either of them has an edge leading to the other, banners and walls are not taken into
+// account, so the components are an upper bound of what guests and the path searches can actually walk. Each component
+// also records whether it leads off the map, into a park entrance or into a ride entrance or exit.
+// Placing paths and entrances and adding edges only ever joins components, so the tiles they are on are queued and
+// joined in on the next query. A union-find cannot split a component again, so removing a path or entrance, or finding
+// that a queued path has lost an edge, rebuilds the whole index instead, which is a single pass over the map.
+
+constexpr int32_t FOOTPATH_CONNECTIVITY_TILE_COUNT = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+// Once more tiles are queued than this, the index is rebuilt rather than brought up to date tile by tile
+constexpr size_t FOOTPATH_CONNECTIVITY_PENDING_TILES_MAX = 4096;
+
+// First path of each tile or -1, the paths of a tile are linked through _footpathConnectivityNextPaths
+static std::vector<int32_t> _footpathConnectivityTileFirstPath;
+static std::vector<int32_t> _footpathConnectivityNextPaths;
+static std::vector<uint8_t> _footpathConnectivityPathHeights;
+// The slope and edges of each path when its tile was last brought up to date
+static std::vector<uint8_t> _footpathConnectivityPathSlopes;
+static std::vector<uint8_t> _footpathConnectivityPathEdges;
+static std::vector<int32_t> _footpathConnectivityParents;
+static std::vector<int32_t> _footpathConnectivitySizes;
+static std::vector<uint8_t> _footpathConnectivityFlags;
+static std::vector<int32_t> _footpathConnectivityPendingTiles;
+static int16_t _footpathConnectivityMapSizeUnits;
+static bool _footpathConnectivityValid = false;
+
+struct FootpathConnectivityState
+{
+    std::vector<int32_t> TileFirstPath;
+    std::vector<int32_t> NextPaths;
+    std::vector<uint8_t> PathHeights;
+    std::vector<uint8_t> PathSlopes;
+    std::vector<uint8_t> PathEdges;
+    std::vector<int32_t> Parents;
+    std::vector<int32_t> Sizes;
+    std::vector<uint8_t> Flags;
+    std::vector<int32_t> PendingTiles;
+    int16_t MapSizeUnits = 0;
+    bool Valid = false;
+};
+
+static int32_t footpath_connectivity_find(int32_t path)
+{
+    while (_footpathConnectivityParents[path] != path)
+    {
+        _footpathConnectivityParents[path] = _footpathConnectivityParents[_footpathConnectivityParents[path]];
+        path = _footpathConnectivityParents[path];
+    }
+    return path;
+}
+
+static void footpath_connectivity_union(int32_t a, int32_t b)
+{
+    a = footpath_connectivity_find(a);
+    b = footpath_connectivity_find(b);
+    if (a == b)
+    {
+        return;
+    }
+
+    if (_footpathConnectivitySizes[a] < _footpathConnectivitySizes[b])
+    {
+        std::swap(a, b);
+    }
+    _footpathConnectivityParents[b] = a;
+    _footpathConnectivitySizes[a] += _footpathConnectivitySizes[b];
+    _footpathConnectivityFlags[a] |= _footpathConnectivityFlags[b];
+}
+
+static uint8_t footpath_connectivity_get_slope(const TileElement* pathElement)
+{
+    if (!pathElement->AsPath()->IsSloped())
+    {
+        return 0;
+    }
+    return 4 | pathElement->AsPath()->GetSlopeDirection();
+}
+
+/**
+ * Gets the path of the index at the given tile and base height, or -1 if there is none.
+ */
+static int32_t footpath_connectivity_get_tile_path(int32_t tileIndex, int32_t z)
+{
+    for (int32_t path = _footpathConnectivityTileFirstPath[tileIndex]; path != -1; path = _footpathConnectivityNextPaths[path])
+    {
+        if (_footpathConnectivityPathHeights[path] == z)
+        {
+            return path;
+        }
+    }
+    return -1;
+}
+
+static void footpath_connectivity_add_path(int32_t tileIndex, const TileElement* pathElement)
+{
+    int32_t path = (int32_t)_footpathConnectivityPathHeights.size();
+    _footpathConnectivityNextPaths.push_back(_footpathConnectivityTileFirstPath[tileIndex]);
+    _footpathConnectivityPathHeights.push_back(pathElement->base_height);
+    _footpathConnectivityPathSlopes.push_back(footpath_connectivity_get_slope(pathElement));
+    _footpathConnectivityPathEdges.push_back(0);
+    _footpathConnectivityParents.push_back(path);
+    _footpathConnectivitySizes.push_back(1);
+    _footpathConnectivityFlags.push_back(0);
+    _footpathConnectivityTileFirstPath[tileIndex] = path;
+}
+
+/**
+ * Adds the paths of a tile the index does not have yet, and takes note of the edges added to the ones it has. Returns
+ * false if a path has been removed, sloped differently or has lost an edge, which the index cannot follow.
+ */
+static bool footpath_connectivity_add_tile_paths(int32_t tileIndex)
+{
+    const TileElement* firstElement = map_get_first_element_at(
+        tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL, tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL);
+    if (firstElement == nullptr)
+    {
+        return _footpathConnectivityTileFirstPath[tileIndex] == -1;
+    }
+
+    const TileElement* tileElement = firstElement;
+    do
+    {
+        if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH
+            && footpath_connectivity_get_tile_path(tileIndex, tileElement->base_height) == -1)
+        {
+            footpath_connectivity_add_path(tileIndex, tileElement);
+        }
+    } while (!(tileElement++)->IsLastForTile());
+
+    for (int32_t path = _footpathConnectivityTileFirstPath[tileIndex]; path != -1; path = _footpathConnectivityNextPaths[path])
+    {
+        bool found = false;
+        uint8_t edges = 0;
+        tileElement = firstElement;
+        do
+        {
+            if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH
+                && tileElement->base_height == _footpathConnectivityPathHeights[path])
+            {
+                if (footpath_connectivity_get_slope(tileElement) != _footpathConnectivityPathSlopes[path])
+                {
+                    return false;
+                }
+                edges |= tileElement->AsPath()->GetEdges();
+                found = true;
+            }
+        } while (!(tileElement++)->IsLastForTile());
+
+        if (!found || (_footpathConnectivityPathEdges[path] & ~edges))
+        {
+            return false;
+        }
+        _footpathConnectivityPathEdges[path] = edges;
+    }
+    return true;
+}
+
+/**
+ * Whether a path leaving its tile in the given direction at the given height continues onto the given path, following
+ * the same rules as footpath_is_connected_to_map_edge.
+ */
+static bool footpath_connectivity_continues_onto(const TileElement* pathElement, int32_t direction, int32_t z)
+{
+    if (pathElement->AsPath()->IsSloped() && pathElement->AsPath()->GetSlopeDirection() != direction)
+    {
+        return direction_reverse(pathElement->AsPath()->GetSlopeDirection()) == direction
+            && pathElement->base_height + 2 == z;
+    }
+    return pathElement->base_height == z;
+}
+
+/**
+ * Joins the given path with everything its edges lead to on the neighbouring tiles. Returns false if it leads onto a
+ * path the index does not have.
+ */
+static bool footpath_connectivity_connect_path(int32_t path, int32_t x, int32_t y, const TileElement* pathElement)
+{
+    uint8_t edges = pathElement->AsPath()->GetEdges();
+    for (int32_t direction = 0; direction < 4; direction++)
+    {
+        if (!(edges & (1 << direction)))
+        {
+            continue;
+        }
+
+        int32_t nextX = x + TileDirectionDelta[direction].x;
+        int32_t nextY = y + TileDirectionDelta[direction].y;
+        if (nextX * 32 < 32 || nextY * 32 < 32 || nextX * 32 >= gMapSizeUnits || nextY * 32 >= gMapSizeUnits)
+        {
+            _footpathConnectivityFlags[footpath_connectivity_find(path)] |= FOOTPATH_CONNECTIVITY_FLAG_MAP_EDGE;
+            continue;
+        }
+
+        int32_t z = pathElement->base_height;
+        if (pathElement->AsPath()->IsSloped() && pathElement->AsPath()->GetSlopeDirection() == direction)
+        {
+            z += 2;
+        }
+
+        int32_t nextTileIndex = nextY * MAXIMUM_MAP_SIZE_TECHNICAL + nextX;
+        const TileElement* tileElement = map_get_first_element_at(nextX, nextY);
+        if (tileElement == nullptr)
+        {
+            continue;
+        }
+        do
+        {
+            switch (tileElement->GetType())
+            {
+                case TILE_ELEMENT_TYPE_PATH:
+                    if (footpath_connectivity_continues_onto(tileElement, direction, z))
+                    {
+                        int32_t nextPath = footpath_connectivity_get_tile_path(nextTileIndex, tileElement->base_height);
+                        if (nextPath == -1)
+                        {
+                            return false;
+                        }
+                        footpath_connectivity_union(path, nextPath);
+                    }
+                    break;
+                case TILE_ELEMENT_TYPE_ENTRANCE:
+                    if (tileElement->base_height == z)
+                    {
+                        uint8_t flag = tileElement->AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE
+                            ? FOOTPATH_CONNECTIVITY_FLAG_PARK_ENTRANCE
+                            : FOOTPATH_CONNECTIVITY_FLAG_RIDE_ENTRANCE;
+                        _footpathConnectivityFlags[footpath_connectivity_find(path)] |= flag;
+                    }
+                    break;
+            }
+        } while (!(tileElement++)->IsLastForTile());
+    }
+    return true;
+}
+
+static bool footpath_connectivity_connect_tile(int32_t tileIndex)
+{
+    if (_footpathConnectivityTileFirstPath[tileIndex] == -1)
+    {
+        return true;
+    }
+
+    int32_t x = tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL;
+    int32_t y = tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL;
+    const TileElement* tileElement = map_get_first_element_at(x, y);
+    do
+    {
+        if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH)
+        {
+            int32_t path = footpath_connectivity_get_tile_path(tileIndex, tileElement->base_height);
+            if (path == -1 || !footpath_connectivity_connect_path(path, x, y, tileElement))
+            {
+                return false;
+            }
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return true;
+}
+
+static void footpath_connectivity_rebuild()
+{
+    _footpathConnectivityTileFirstPath.assign(FOOTPATH_CONNECTIVITY_TILE_COUNT, -1);
+    _footpathConnectivityNextPaths.clear();
+    _footpathConnectivityPathHeights.clear();
+    _footpathConnectivityPathSlopes.clear();
+    _footpathConnectivityPathEdges.clear();
+    _footpathConnectivityParents.clear();
+    _footpathConnectivitySizes.clear();
+    _footpathConnectivityFlags.clear();
+    _footpathConnectivityPendingTiles.clear();
+
+    for (int32_t tileIndex = 0; tileIndex < FOOTPATH_CONNECTIVITY_TILE_COUNT; tileIndex++)
+    {
+        footpath_connectivity_add_tile_paths(tileIndex);
+    }
+    for (int32_t tileIndex = 0; tileIndex < FOOTPATH_CONNECTIVITY_TILE_COUNT; tileIndex++)
+    {
+        footpath_connectivity_connect_tile(tileIndex);
+    }
+}
+
+/**
+ * Joins in the paths and entrances of the queued tiles. Returns false if the index has to be rebuilt instead.
+ */
+static bool footpath_connectivity_add_pending_tiles()
+{
+    for (int32_t tileIndex : _footpathConnectivityPendingTiles)
+    {
+        if (!footpath_connectivity_add_tile_paths(tileIndex))
+        {
+            return false;
+        }
+    }
+
+    for (int32_t tileIndex : _footpathConnectivityPendingTiles)
+    {
+        if (!footpath_connectivity_connect_tile(tileIndex))
+        {
+            return false;
+        }
+
+        // The paths of the neighbours may lead onto the new paths and entrances
+        int32_t x = tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL;
+        int32_t y = tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL;
+        for (int32_t direction = 0; direction < 4; direction++)
+        {
+            int32_t nextX = x + TileDirectionDelta[direction].x;
+            int32_t nextY = y + TileDirectionDelta[direction].y;
+            if (nextX >= 0 && nextY >= 0 && nextX < MAXIMUM_MAP_SIZE_TECHNICAL && nextY < MAXIMUM_MAP_SIZE_TECHNICAL
+                && !footpath_connectivity_connect_tile(nextY * MAXIMUM_MAP_SIZE_TECHNICAL + nextX))
+            {
+                return false;
+            }
+        }
+    }
+    _footpathConnectivityPendingTiles.clear();
+    return true;
+}
+
+static void footpath_connectivity_refresh()
+{
+    if (_footpathConnectivityValid && !_footpathConnectivityPendingTiles.empty())
+    {
+        _footpathConnectivityValid = footpath_connectivity_add_pending_tiles();
+    }
+    if (!_footpathConnectivityValid || _footpathConnectivityMapSizeUnits != gMapSizeUnits)
+    {
+        footpath_connectivity_rebuild();
+        _footpathConnectivityMapSizeUnits = gMapSizeUnits;
+        _footpathConnectivityValid = true;
+    }
+}
+
+static int32_t footpath_connectivity_get_path(const TileCoordsXYZ& location)
+{
+    if (location.x < 0 || location.y < 0 || location.x >= MAXIMUM_MAP_SIZE_TECHNICAL
+        || location.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        return -1;
+    }
+
+    footpath_connectivity_refresh();
+    return footpath_connectivity_get_tile_path(location.y * MAXIMUM_MAP_SIZE_TECHNICAL + location.x, location.z);
+}
+
+/**
+ * Gets what the path at the given tile and base height is connected to, or 0 if there is no path.
+ */
+uint8_t footpath_connectivity_get_flags(const TileCoordsXYZ& location)
+{
+    int32_t path = footpath_connectivity_get_path(location);
+    if (path == -1)
+    {
+        return 0;
+    }
+    return _footpathConnectivityFlags[footpath_connectivity_find(path)];
+}
+
+/**
+ * Whether the paths at the given tiles and base heights are part of the same network. A false return guarantees there
+ * is no way to walk from one to the other.
+ */
+bool footpath_connectivity_are_connected(const TileCoordsXYZ& a, const TileCoordsXYZ& b)
+{
+    int32_t pathA = footpath_connectivity_get_path(a);
+    int32_t pathB = footpath_connectivity_get_path(b);
+    if (pathA == -1 || pathB == -1)
+    {
+        return false;
+    }
+    return footpath_connectivity_find(pathA) == footpath_connectivity_find(pathB);
+}
+
+/**
+ * Gets the number of path elements that are not connected to any park entrance.
+ */
+int32_t footpath_connectivity_count_stranded_paths()
+{
+    footpath_connectivity_refresh();
+    int32_t numPaths = (int32_t)_footpathConnectivityPathHeights.size();
+    int32_t strandedPaths = 0;
+    for (int32_t path = 0; path < numPaths; path++)
+    {
+        if (!(_footpathConnectivityFlags[footpath_connectivity_find(path)] & FOOTPATH_CONNECTIVITY_FLAG_PARK_ENTRANCE))
+        {
+            strandedPaths++;
+        }
+    }
+    return strandedPaths;
+}
+
+/**
+ * Queues a tile whose paths or entrances have been placed, or whose paths have gained edges, to be joined in on the
+ * next query.
+ * @param x x-coordinate in tiles
+ * @param y y-coordinate in tiles
+ */
+void footpath_connectivity_update_tile(int32_t x, int32_t y)
+{
+    if (!_footpathConnectivityValid || x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        return;
+    }
+
+    int32_t tileIndex = y * MAXIMUM_MAP_SIZE_TECHNICAL + x;
+    if (!_footpathConnectivityPendingTiles.empty() && _footpathConnectivityPendingTiles.back() == tileIndex)
+    {
+        return;
+    }
+    if (_footpathConnectivityPendingTiles.size() >= FOOTPATH_CONNECTIVITY_PENDING_TILES_MAX)
+    {
+        footpath_connectivity_invalidate();
+        return;
+    }
+    _footpathConnectivityPendingTiles.push_back(tileIndex);
+}
+
+/**
+ * Makes the whole index be rebuilt on the next query, for when paths or entrances have been removed.
+ */
+void footpath_connectivity_invalidate()
+{
+    _footpathConnectivityValid = false;
+    _footpathConnectivityPendingTiles.clear();
+}
+
+/**
+ * Exchanges the index with the one put aside by map_swap_storage.
+ */
+void footpath_connectivity_swap_state()
+{
+    static FootpathConnectivityState stashedState;
+    std::swap(_footpathConnectivityTileFirstPath, stashedState.TileFirstPath);
+    std::swap(_footpathConnectivityNextPaths, stashedState.NextPaths);
+    std::swap(_footpathConnectivityPathHeights, stashedState.PathHeights);
+    std::swap(_footpathConnectivityPathSlopes, stashedState.PathSlopes);
+    std::swap(_footpathConnectivityPathEdges, stashedState.PathEdges);
+    std::swap(_footpathConnectivityParents, stashedState.Parents);
+    std::swap(_footpathConnectivitySizes, stashedState.Sizes);
+    std::swap(_footpathConnectivityFlags, stashedState.Flags);
+    std::swap(_footpathConnectivityPendingTiles, stashedState.PendingTiles);
+    std::swap(_footpathConnectivityMapSizeUnits, stashedState.MapSizeUnits);
+    std::swap(_footpathConnectivityValid, stashedState.Valid);
+}
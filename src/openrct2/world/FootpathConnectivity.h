@@ -0,0 +1,27 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Location.hpp"
+
+enum
+{
+    FOOTPATH_CONNECTIVITY_FLAG_MAP_EDGE = 1 << 0,
+    FOOTPATH_CONNECTIVITY_FLAG_PARK_ENTRANCE = 1 << 1,
+    FOOTPATH_CONNECTIVITY_FLAG_RIDE_ENTRANCE = 1 << 2,
+};
+
+uint8_t footpath_connectivity_get_flags(const TileCoordsXYZ& location);
+bool footpath_connectivity_are_connected(const TileCoordsXYZ& a, const TileCoordsXYZ& b);
+int32_t footpath_connectivity_count_stranded_paths();
+void footpath_connectivity_update_tile(int32_t x, int32_t y);
+void footpath_connectivity_invalidate();
+void footpath_connectivity_swap_state();
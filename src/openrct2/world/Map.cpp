@@ -33,6 +33,8 @@
 #include "../object/TerrainSurfaceObject.h"
 #include "../ride/RideData.h"
 #include "../ride/Track.h"
+#include "../ride/RideSpatialIndex.h"
+#include "../ride/TrackCircuit.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
 #include "../scenario/Scenario.h"
@@ -41,17 +43,22 @@
 #include "Banner.h"
 #include "Climate.h"
 #include "Footpath.h"
+#include "FootpathConnectivity.h"
 #include "LargeScenery.h"
 #include "MapAnimation.h"
 #include "Park.h"
 #include "Scenery.h"
 #include "SmallScenery.h"
 #include "Surface.h"
+#include "TileElementAllocator.h"
+#include "TileElementSummary.h"
 #include "TileInspector.h"
 #include "Wall.h"
 
 #include <algorithm>
+#include <bitset>
 #include <iterator>
+#include <utility>
 
 using namespace OpenRCT2;
 
@@ -75,7 +82,32 @@ uint8_t gMapGroundFlags;
 
 uint16_t gWidePathTileLoopX;
 uint16_t gWidePathTileLoopY;
-uint16_t gGrassSceneryTileLoopPosition;
+uint32_t gGrassSceneryTileLoopPosition;
+
+static constexpr int32_t map_get_coordinate_bits(int32_t size)
+{
+    return size <= 1 ? 0 : 1 + map_get_coordinate_bits(size / 2);
+}
+
+// The number of bits of each tile coordinate interleaved into gGrassSceneryTileLoopPosition
+constexpr int32_t MAP_TILE_COORDINATE_BITS = map_get_coordinate_bits(MAXIMUM_MAP_SIZE_TECHNICAL);
+static_assert((1 << MAP_TILE_COORDINATE_BITS) == MAXIMUM_MAP_SIZE_TECHNICAL, "The technical map size must be a power of two");
+
+// map_update_tiles visits the tiles in the order of gGrassSceneryTileLoopPosition, which works as a timer wheel: a tile
+// is due once the loop position reaches it. Most tiles have no grass that can grow and no scenery that ages, so each
+// position keeps a bit that is only cleared once the update of its tile is known to change nothing. Skipped tiles are
+// still due on the same tick as before, keeping saves, replays and network games unchanged. Anything that could give a
+// tile something to update sets its bit again, setting it without need is harmless.
+static std::bitset<MAX_TILE_TILE_ELEMENT_POINTERS> _mapTileUpdatesPending;
+static bool _mapTileUpdatesInvalidated = true;
+
+// Tiles passed to map_invalidate_tile since the last map_take_invalidated_tiles, for views that keep their own picture
+// of the map such as the minimap. Once more tiles are invalidated than are worth tracking one by one, further tiles are
+// not recorded and the next taker is told to redraw everything.
+constexpr size_t MAP_INVALIDATED_TILES_MAX = 4096;
+static std::bitset<MAX_TILE_TILE_ELEMENT_POINTERS> _mapTileInvalidated;
+static std::vector<TileCoordsXY> _mapInvalidatedTiles;
+static bool _mapInvalidatedTilesOverflow = true;
 
 int16_t gMapSizeUnits;
 int16_t gMapSizeMinus2;
@@ -83,8 +115,17 @@ int16_t gMapSize;
 int16_t gMapSizeMaxXY;
 int16_t gMapBaseZ;
 
-TileElement gTileElements[MAX_TILE_TILE_ELEMENT_POINTERS * 3];
-TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
+static TileElement _parkTileElements[MAX_TILE_TILE_ELEMENT_POINTERS * 3];
+static TileElement* _parkTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
+static TileElementChunkList _parkTileElementChunks;
+
+TileElement* gTileElements = _parkTileElements;
+TileElement** gTileElementTilePointers = _parkTileElementTilePointers;
+TileElementChunkList* gTileElementChunks = &_parkTileElementChunks;
+
+// Whether the derived state of the park is in use, or put aside while another storage such as a track design preview
+// is active.
+static bool _mapParkDerivedStateActive = true;
 LocationXY16 gMapSelectionTiles[300];
 std::vector<PeepSpawn> gPeepSpawns;
 
@@ -104,6 +145,7 @@ LocationXYZ16 gCommandPosition;
 
 bool gMapLandRightsUpdateSuccess;
 
+static void map_swap_derived_state();
 static void clear_elements_at(int32_t x, int32_t y);
 static void translate_3d_to_2d(int32_t rotation, int32_t* x, int32_t* y);
 
@@ -240,6 +282,11 @@ TileElement* map_get_nth_element_at(int32_t x, int32_t y, int32_t n)
     return nullptr;
 }
 
+/**
+ * Points a tile at other elements, only used to paint temporary elements during the track construction preview, which
+ * puts the original pointers back straight after. The storage itself is untouched, so only the summary has to know the
+ * tile may now hold any type.
+ */
 void map_set_tile_elements(int32_t x, int32_t y, TileElement* elements)
 {
     if (x < 0 || y < 0 || x > (MAXIMUM_MAP_SIZE_TECHNICAL - 1) || y > (MAXIMUM_MAP_SIZE_TECHNICAL - 1))
@@ -248,6 +295,7 @@ void map_set_tile_elements(int32_t x, int32_t y, TileElement* elements)
         return;
     }
     gTileElementTilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL] = elements;
+    tile_element_summary_mark_changed(x, y);
 }
 
 TileElement* map_get_surface_element_at(int32_t x, int32_t y)
@@ -276,6 +324,11 @@ TileElement* map_get_surface_element_at(const CoordsXY coords)
 
 TileElement* map_get_path_element_at(int32_t x, int32_t y, int32_t z)
 {
+    if (!tile_element_summary_may_contain(x, y, TILE_ELEMENT_TYPE_PATH))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x, y);
 
     if (tileElement == nullptr)
@@ -299,6 +352,11 @@ TileElement* map_get_path_element_at(int32_t x, int32_t y, int32_t z)
 
 BannerElement* map_get_banner_element_at(int32_t x, int32_t y, int32_t z, uint8_t position)
 {
+    if (!tile_element_summary_may_contain(x, y, TILE_ELEMENT_TYPE_BANNER))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x, y);
 
     if (tileElement == nullptr)
@@ -412,12 +470,83 @@ void map_count_remaining_land_rights()
  */
 void map_strip_ghost_flag_from_elements()
 {
-    for (auto& element : gTileElements)
+    for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS * 3; i++)
     {
-        element.SetGhost(false);
+        gTileElements[i].SetGhost(false);
     }
 }
 
+/**
+ * Makes the map functions operate on the given storage, returning the storage that was active before so it can be
+ * swapped back in afterwards. Nothing is copied, the caller keeps ownership of both. Swapping back to the park's storage
+ * restores the park's derived state as it was left.
+ */
+MapStorage map_swap_storage(const MapStorage& storage)
+{
+    MapStorage previous;
+    previous.TileElements = gTileElements;
+    previous.TileElementPointers = gTileElementTilePointers;
+    previous.TileElementChunks = gTileElementChunks;
+    previous.NextFreeTileElement = gNextFreeTileElement;
+    previous.MapSizeUnits = gMapSizeUnits;
+    previous.MapSizeMinus2 = gMapSizeMinus2;
+    previous.MapSize = gMapSize;
+
+    gTileElements = storage.TileElements;
+    gTileElementTilePointers = storage.TileElementPointers;
+    gTileElementChunks = storage.TileElementChunks;
+    gNextFreeTileElement = storage.NextFreeTileElement;
+    gMapSizeUnits = storage.MapSizeUnits;
+    gMapSizeMinus2 = storage.MapSizeMinus2;
+    gMapSize = storage.MapSize;
+
+    // Previews swap their storage in and out several times a second while a park is open. Rather than rebuilding the
+    // park's derived state each time, it is put aside while another storage is active and handed back unchanged, so
+    // only switching to a storage other than the park's counts as a change.
+    bool isParkStorage = gTileElements == _parkTileElements;
+    if (isParkStorage != _mapParkDerivedStateActive)
+    {
+        map_swap_derived_state();
+        _mapParkDerivedStateActive = isParkStorage;
+    }
+    if (!isParkStorage)
+    {
+        map_storage_changed();
+    }
+    return previous;
+}
+
+/**
+ * Exchanges everything derived from the tile element storage with the state put aside by the last call.
+ */
+static void map_swap_derived_state()
+{
+    static std::bitset<MAX_TILE_TILE_ELEMENT_POINTERS> stashedTileUpdatesPending;
+    static bool stashedTileUpdatesInvalidated = true;
+    std::swap(_mapTileUpdatesPending, stashedTileUpdatesPending);
+    std::swap(_mapTileUpdatesInvalidated, stashedTileUpdatesInvalidated);
+
+    tile_element_allocator_swap_state();
+    tile_element_summary_swap_state();
+    footpath_swap_path_wide_flags_state();
+    track_circuit_swap_state();
+    ride_spatial_index_swap_state();
+}
+
+/**
+ * Drops everything derived from the tile element storage. Call this whenever the storage is swapped or its elements are
+ * rewritten wholesale rather than through the tile element functions.
+ */
+void map_storage_changed()
+{
+    tile_element_allocator_invalidate();
+    tile_element_summary_invalidate_all();
+    footpath_invalidate_all_path_wide_flags();
+    map_mark_all_tiles_for_update();
+    track_circuit_invalidate_all();
+    ride_spatial_index_invalidate_all();
+}
+
 /**
  *
  *  rct2: 0x0068AFFD
@@ -444,6 +573,8 @@ void map_update_tile_pointers()
     }
 
     gNextFreeTileElement = tileElement;
+    gTileElementChunks->clear();
+    map_storage_changed();
 }
 
 /**
@@ -459,7 +590,7 @@ int32_t tile_element_height(int32_t x, int32_t y)
     TileElement* tileElement;
 
     // Off the map
-    if ((unsigned)x >= 8192 || (unsigned)y >= 8192)
+    if ((unsigned)x >= MAXIMUM_MAP_SIZE_BIG || (unsigned)y >= MAXIMUM_MAP_SIZE_BIG)
         return 16;
 
     // Truncate subtile coordinates
@@ -656,7 +787,8 @@ void map_update_path_wide_flags()
 
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
-    // progress. A maximum of 128 calls is done per update.
+    // progress. A maximum of 128 calls is done per update, only tiles whose paths or
+    // neighbouring wide flags have changed are actually recalculated.
     uint16_t x = gWidePathTileLoopX;
     uint16_t y = gWidePathTileLoopY;
     for (int32_t i = 0; i < 128; i++)
@@ -665,11 +797,11 @@ void map_update_path_wide_flags()
 
         // Next x, y tile
         x += 32;
-        if (x >= 8192)
+        if (x >= MAXIMUM_MAP_SIZE_BIG)
         {
             x = 0;
             y += 32;
-            if (y >= 8192)
+            if (y >= MAXIMUM_MAP_SIZE_BIG)
             {
                 y = 0;
             }
@@ -956,6 +1088,7 @@ static money32 map_change_surface_style(
                     if (flags & GAME_COMMAND_FLAG_APPLY)
                     {
                         surfaceElement->SetSurfaceStyle(surfaceStyle);
+                        map_mark_tile_for_update(x, y);
 
                         map_invalidate_tile_full(x, y);
                         footpath_remove_litter(x, y, tile_element_height(x, y));
@@ -2402,6 +2535,38 @@ void game_command_place_large_scenery(
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    int32_t tileIndex = tile_element_allocator_get_tile_index(tileElement);
+    if (tileIndex == -1)
+    {
+        track_circuit_invalidate_all();
+    }
+    else
+    {
+        track_circuit_invalidate_tile(tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL, tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL);
+    }
+
+    if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
+    {
+        ride_spatial_index_invalidate_ride(tileElement->AsTrack()->GetRideIndex());
+    }
+    else if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH)
+    {
+        if (tileIndex == -1)
+        {
+            footpath_invalidate_all_path_wide_flags();
+        }
+        else
+        {
+            footpath_invalidate_path_wide_flags(
+                (tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL) * 32, (tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL) * 32);
+        }
+    }
+    if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH || tileElement->GetType() == TILE_ELEMENT_TYPE_ENTRANCE)
+    {
+        // Paths may be split into separate networks, which the connectivity index can only follow by being rebuilt
+        footpath_connectivity_invalidate();
+    }
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -2415,12 +2580,7 @@ void tile_element_remove(TileElement* tileElement)
 
     // Mark the latest element with the last element flag.
     (tileElement - 1)->flags |= TILE_ELEMENT_FLAG_LAST_TILE;
-    tileElement->base_height = 0xFF;
-
-    if ((tileElement + 1) == gNextFreeTileElement)
-    {
-        gNextFreeTileElement--;
-    }
+    tile_element_allocator_release(tileElement);
 }
 
 /**
@@ -2558,72 +2718,23 @@ void map_reorganise_elements()
 {
     context_setcurrentcursor(CURSOR_ZZZ);
 
-    TileElement* new_tile_elements = (TileElement*)malloc(
-        3 * (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL) * sizeof(TileElement));
-    TileElement* new_elements_pointer = new_tile_elements;
-
-    if (new_tile_elements == nullptr)
-    {
-        log_fatal("Unable to allocate memory for map elements.");
-        return;
-    }
-
-    uint32_t num_elements;
-
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
-    {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
-        {
-            TileElement* startElement = map_get_first_element_at(x, y);
-            TileElement* endElement = startElement;
-            while (!(endElement++)->IsLastForTile())
-                ;
-
-            num_elements = (uint32_t)(endElement - startElement);
-            std::memcpy(new_elements_pointer, startElement, num_elements * sizeof(TileElement));
-            new_elements_pointer += num_elements;
-        }
-    }
-
-    num_elements = (uint32_t)(new_elements_pointer - new_tile_elements);
-    std::memcpy(gTileElements, new_tile_elements, num_elements * sizeof(TileElement));
-    std::memset(
-        gTileElements + num_elements, 0,
-        (3 * (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL) - num_elements) * sizeof(TileElement));
-
-    free(new_tile_elements);
-
-    map_update_tile_pointers();
+    tile_element_allocator_reorganise();
+    track_circuit_invalidate_all();
+    ride_spatial_index_invalidate_all();
 }
 
 /**
  *
  *  rct2: 0x0068B044
  *  Returns true on space available for more elements
- *  Reorganises the map elements to check for space
  */
 bool map_check_free_elements_and_reorganise(int32_t numElements)
 {
-    if (numElements != 0)
+    if (numElements != 0 && !tile_element_allocator_reserve(numElements))
     {
-        auto tileElementEnd = &gTileElements[MAX_TILE_ELEMENTS];
-
-        // Check if is there is room for the required number of elements
-        auto newTileElementEnd = gNextFreeTileElement + numElements;
-        if (newTileElementEnd > tileElementEnd)
-        {
-            // Defragment the map element list
-            map_reorganise_elements();
-
-            // Check if there is any room again
-            newTileElementEnd = gNextFreeTileElement + numElements;
-            if (newTileElementEnd > tileElementEnd)
-            {
-                // Not enough spare elements left :'(
-                gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
-                return false;
-            }
-        }
+        // Not enough spare elements left :'(
+        gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
+        return false;
     }
     return true;
 }
@@ -2634,61 +2745,49 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
  */
 TileElement* tile_element_insert(int32_t x, int32_t y, int32_t z, int32_t flags)
 {
-    TileElement *originalTileElement, *newTileElement, *insertedElement;
+    int32_t tileIndex = y * MAXIMUM_MAP_SIZE_TECHNICAL + x;
 
-    if (!map_check_free_elements_and_reorganise(1))
+    // Find where the new element goes, which is above all elements at or below the insert height
+    TileElement* tileElement = gTileElementTilePointers[tileIndex];
+    int32_t position = 0;
+    bool isLastForTile = false;
+    while (z >= tileElement->base_height)
     {
-        log_error("Cannot insert new element");
-        return nullptr;
-    }
-
-    newTileElement = gNextFreeTileElement;
-    originalTileElement = gTileElementTilePointers[y * MAXIMUM_MAP_SIZE_TECHNICAL + x];
-
-    // Set tile index pointer to point to new element block
-    gTileElementTilePointers[y * MAXIMUM_MAP_SIZE_TECHNICAL + x] = newTileElement;
-
-    // Copy all elements that are below the insert height
-    while (z >= originalTileElement->base_height)
-    {
-        // Copy over map element
-        *newTileElement = *originalTileElement;
-        originalTileElement->base_height = 255;
-        originalTileElement++;
-        newTileElement++;
-
-        if ((newTileElement - 1)->flags & TILE_ELEMENT_FLAG_LAST_TILE)
+        position++;
+        if (tileElement->IsLastForTile())
         {
             // No more elements above the insert element
-            (newTileElement - 1)->flags &= ~TILE_ELEMENT_FLAG_LAST_TILE;
-            flags |= TILE_ELEMENT_FLAG_LAST_TILE;
+            isLastForTile = true;
             break;
         }
+        tileElement++;
     }
 
-    // Insert new map element
-    insertedElement = newTileElement;
-    newTileElement->type = 0;
-    newTileElement->base_height = z;
-    newTileElement->flags = flags;
-    newTileElement->clearance_height = z;
-    std::memset(&newTileElement->pad_04, 0, sizeof(newTileElement->pad_04));
-    newTileElement++;
+    TileElement* insertedElement = tile_element_allocator_insert(tileIndex, position);
+    if (insertedElement == nullptr)
+    {
+        gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
+        log_error("Cannot insert new element");
+        return nullptr;
+    }
+
+    track_circuit_invalidate_tile(x, y);
+    ride_spatial_index_invalidate_tile(x, y);
 
-    // Insert rest of map elements above insert height
-    if (!(flags & TILE_ELEMENT_FLAG_LAST_TILE))
+    if (isLastForTile)
     {
-        do
-        {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = 255;
-            originalTileElement++;
-            newTileElement++;
-        } while (!((newTileElement - 1)->IsLastForTile()));
+        (insertedElement - 1)->flags &= ~TILE_ELEMENT_FLAG_LAST_TILE;
+        flags |= TILE_ELEMENT_FLAG_LAST_TILE;
     }
 
-    gNextFreeTileElement = newTileElement;
+    // Insert new map element
+    insertedElement->type = 0;
+    insertedElement->base_height = z;
+    insertedElement->flags = flags;
+    insertedElement->clearance_height = z;
+    std::memset(&insertedElement->pad_04, 0, sizeof(insertedElement->pad_04));
+    tile_element_summary_mark_changed(x, y);
+    map_mark_tile_for_update(x * 32, y * 32);
     return insertedElement;
 }
 
@@ -2939,6 +3038,105 @@ int32_t map_can_construct_at(int32_t x, int32_t y, int32_t zLow, int32_t zHigh,
     return map_can_construct_with_clear_at(x, y, zLow, zHigh, nullptr, bl, 0, nullptr, CREATE_CROSSING_MODE_NONE);
 }
 
+static CoordsXY map_get_tile_loop_position_tile(uint32_t position)
+{
+    int32_t x = 0;
+    int32_t y = 0;
+    for (int32_t i = 0; i < MAP_TILE_COORDINATE_BITS; i++)
+    {
+        x = (x << 1) | (position & 1);
+        position >>= 1;
+        y = (y << 1) | (position & 1);
+        position >>= 1;
+    }
+    return { x, y };
+}
+
+static uint32_t map_get_tile_loop_position(int32_t x, int32_t y)
+{
+    uint32_t position = 0;
+    for (int32_t i = 0; i < MAP_TILE_COORDINATE_BITS; i++)
+    {
+        int32_t bit = MAP_TILE_COORDINATE_BITS - 1 - i;
+        position |= ((x >> bit) & 1) << (i * 2);
+        position |= ((y >> bit) & 1) << (i * 2 + 1);
+    }
+    return position;
+}
+
+/**
+ * Whether map_update_tiles may change anything on the given tile. Grass outside the park is only ever cleared, so land
+ * around the park with short grass is skipped, as are tiles without small scenery or path additions.
+ */
+static bool map_tile_needs_update(int32_t x, int32_t y)
+{
+    TileElement* tileElement = map_get_first_element_at(x, y);
+    if (tileElement == nullptr)
+    {
+        return false;
+    }
+
+    do
+    {
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_SURFACE:
+            {
+                auto surfaceElement = tileElement->AsSurface();
+                if (surfaceElement->CanGrassGrow()
+                    && ((surfaceElement->GetGrassLength() & 7) != GRASS_LENGTH_CLEAR_0
+                        || (surfaceElement->GetOwnership() & OWNERSHIP_OWNED)))
+                {
+                    return true;
+                }
+                break;
+            }
+            case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                return true;
+            case TILE_ELEMENT_TYPE_PATH:
+                if (tileElement->AsPath()->HasAddition())
+                {
+                    return true;
+                }
+                break;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return false;
+}
+
+static void map_refresh_tile_updates()
+{
+    if (_mapTileUpdatesInvalidated)
+    {
+        for (uint32_t position = 0; position < MAX_TILE_TILE_ELEMENT_POINTERS; position++)
+        {
+            CoordsXY tile = map_get_tile_loop_position_tile(position);
+            _mapTileUpdatesPending[position] = map_tile_needs_update(tile.x, tile.y);
+        }
+        _mapTileUpdatesInvalidated = false;
+    }
+}
+
+/**
+ * Makes map_update_tiles visit the tile at the given position again, for when its grass, ownership, scenery or path
+ * additions change.
+ */
+void map_mark_tile_for_update(int32_t x, int32_t y)
+{
+    x /= 32;
+    y /= 32;
+    if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        return;
+    }
+    _mapTileUpdatesPending[map_get_tile_loop_position(x, y)] = true;
+}
+
+void map_mark_all_tiles_for_update()
+{
+    _mapTileUpdatesInvalidated = true;
+}
+
 /**
  * Updates grass length, scenery age and jumping fountains.
  *
@@ -2948,32 +3146,31 @@ void map_update_tiles()
 {
     int32_t ignoreScreenFlags = SCREEN_FLAGS_SCENARIO_EDITOR | SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER;
     if (gScreenFlags & ignoreScreenFlags)
+    {
+        // The editors change tiles without marking them
+        map_mark_all_tiles_for_update();
         return;
+    }
+
+    map_refresh_tile_updates();
 
     // Update 43 more tiles
     for (int32_t j = 0; j < 43; j++)
     {
-        int32_t x = 0;
-        int32_t y = 0;
-
-        uint16_t interleaved_xy = gGrassSceneryTileLoopPosition;
-        for (int32_t i = 0; i < 8; i++)
+        uint32_t position = gGrassSceneryTileLoopPosition;
+        if (_mapTileUpdatesPending[position])
         {
-            x = (x << 1) | (interleaved_xy & 1);
-            interleaved_xy >>= 1;
-            y = (y << 1) | (interleaved_xy & 1);
-            interleaved_xy >>= 1;
-        }
-
-        TileElement* tileElement = map_get_surface_element_at(x, y);
-        if (tileElement != nullptr)
-        {
-            tileElement->AsSurface()->UpdateGrassLength({ x * 32, y * 32 });
-            scenery_update_tile(x * 32, y * 32);
+            CoordsXY tile = map_get_tile_loop_position_tile(position);
+            TileElement* tileElement = map_get_surface_element_at(tile.x, tile.y);
+            if (tileElement != nullptr)
+            {
+                tileElement->AsSurface()->UpdateGrassLength({ tile.x * 32, tile.y * 32 });
+                scenery_update_tile(tile.x * 32, tile.y * 32);
+            }
+            _mapTileUpdatesPending[position] = map_tile_needs_update(tile.x, tile.y);
         }
 
-        gGrassSceneryTileLoopPosition++;
-        gGrassSceneryTileLoopPosition &= 0xFFFF;
+        gGrassSceneryTileLoopPosition = (gGrassSceneryTileLoopPosition + 1) % MAX_TILE_TILE_ELEMENT_POINTERS;
     }
 }
 
@@ -3076,6 +3273,7 @@ void map_extend_boundary_surface()
         newTileElement->base_height = z;
         newTileElement->clearance_height = z;
 
+        map_mark_tile_for_update(x << 5, y << 5);
         update_park_fences({ x << 5, y << 5 });
     }
 
@@ -3119,6 +3317,7 @@ void map_extend_boundary_surface()
         newTileElement->base_height = z;
         newTileElement->clearance_height = z;
 
+        map_mark_tile_for_update(x << 5, y << 5);
         update_park_fences({ x << 5, y << 5 });
     }
 }
@@ -3236,6 +3435,11 @@ int32_t map_get_highest_z(int32_t tileX, int32_t tileY)
 
 TileElement* map_get_large_scenery_segment(int32_t x, int32_t y, int32_t z, int32_t direction, int32_t sequence)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_LARGE_SCENERY))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     if (tileElement == nullptr)
     {
@@ -3259,6 +3463,11 @@ TileElement* map_get_large_scenery_segment(int32_t x, int32_t y, int32_t z, int3
 
 EntranceElement* map_get_park_entrance_element_at(int32_t x, int32_t y, int32_t z, bool ghost)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_ENTRANCE))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     if (tileElement != nullptr)
     {
@@ -3284,6 +3493,11 @@ EntranceElement* map_get_park_entrance_element_at(int32_t x, int32_t y, int32_t
 
 EntranceElement* map_get_ride_entrance_element_at(int32_t x, int32_t y, int32_t z, bool ghost)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_ENTRANCE))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     if (tileElement != nullptr)
     {
@@ -3309,6 +3523,11 @@ EntranceElement* map_get_ride_entrance_element_at(int32_t x, int32_t y, int32_t
 
 EntranceElement* map_get_ride_exit_element_at(int32_t x, int32_t y, int32_t z, bool ghost)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_ENTRANCE))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     if (tileElement != nullptr)
     {
@@ -3334,6 +3553,11 @@ EntranceElement* map_get_ride_exit_element_at(int32_t x, int32_t y, int32_t z, b
 
 TileElement* map_get_small_scenery_element_at(int32_t x, int32_t y, int32_t z, int32_t type, uint8_t quadrant)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_SMALL_SCENERY))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     if (tileElement != nullptr)
     {
@@ -3483,11 +3707,55 @@ CoordsXY translate_3d_to_2d_with_z(int32_t rotation, CoordsXYZ pos)
     return result;
 }
 
+static void map_record_invalidated_tile(int32_t x, int32_t y)
+{
+    if (_mapInvalidatedTilesOverflow || x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_BIG || y >= MAXIMUM_MAP_SIZE_BIG)
+        return;
+
+    TileCoordsXY tile = { x / 32, y / 32 };
+    size_t tileIndex = tile.y * MAXIMUM_MAP_SIZE_TECHNICAL + tile.x;
+    if (_mapTileInvalidated[tileIndex])
+        return;
+
+    if (_mapInvalidatedTiles.size() >= MAP_INVALIDATED_TILES_MAX)
+    {
+        _mapInvalidatedTilesOverflow = true;
+        return;
+    }
+    _mapTileInvalidated[tileIndex] = true;
+    _mapInvalidatedTiles.push_back(tile);
+}
+
+/**
+ * Moves the tiles invalidated since the last call into the given list. Returns false if too many tiles were invalidated
+ * to be tracked, in which case all of the map has to be treated as invalidated.
+ */
+bool map_take_invalidated_tiles(std::vector<TileCoordsXY>& tiles)
+{
+    tiles.clear();
+    if (_mapInvalidatedTilesOverflow)
+    {
+        _mapInvalidatedTiles.clear();
+        _mapTileInvalidated.reset();
+        _mapInvalidatedTilesOverflow = false;
+        return false;
+    }
+
+    for (const auto& tile : _mapInvalidatedTiles)
+    {
+        _mapTileInvalidated[tile.y * MAXIMUM_MAP_SIZE_TECHNICAL + tile.x] = false;
+    }
+    std::swap(tiles, _mapInvalidatedTiles);
+    return true;
+}
+
 static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t maxZoom)
 {
     if (gOpenRCT2Headless)
         return;
 
+    map_record_invalidated_tile(x, y);
+
     int32_t x1, y1, x2, y2;
 
     x += 16;
@@ -3598,7 +3866,7 @@ int32_t map_get_tile_quadrant(int32_t mapX, int32_t mapY)
 bool map_surface_is_blocked(int16_t x, int16_t y)
 {
     TileElement* tileElement;
-    if (x >= 8192 || y >= 8192)
+    if (x >= MAXIMUM_MAP_SIZE_BIG || y >= MAXIMUM_MAP_SIZE_BIG)
         return true;
 
     tileElement = map_get_surface_element_at({ x, y });
@@ -3822,6 +4090,11 @@ void game_command_modify_tile(
  */
 TileElement* map_get_track_element_at(int32_t x, int32_t y, int32_t z)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_TRACK))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
     {
@@ -3844,6 +4117,11 @@ TileElement* map_get_track_element_at(int32_t x, int32_t y, int32_t z)
  */
 TileElement* map_get_track_element_at_of_type(int32_t x, int32_t y, int32_t z, int32_t trackType)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_TRACK))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
     {
@@ -3868,6 +4146,11 @@ TileElement* map_get_track_element_at_of_type(int32_t x, int32_t y, int32_t z, i
  */
 TileElement* map_get_track_element_at_of_type_seq(int32_t x, int32_t y, int32_t z, int32_t trackType, int32_t sequence)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_TRACK))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
     {
@@ -3896,6 +4179,11 @@ TileElement* map_get_track_element_at_of_type_seq(int32_t x, int32_t y, int32_t
  */
 TileElement* map_get_track_element_at_of_type_from_ride(int32_t x, int32_t y, int32_t z, int32_t trackType, ride_id_t rideIndex)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_TRACK))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
     {
@@ -3922,6 +4210,11 @@ TileElement* map_get_track_element_at_of_type_from_ride(int32_t x, int32_t y, in
  */
 TileElement* map_get_track_element_at_from_ride(int32_t x, int32_t y, int32_t z, ride_id_t rideIndex)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_TRACK))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
     {
@@ -3948,6 +4241,11 @@ TileElement* map_get_track_element_at_from_ride(int32_t x, int32_t y, int32_t z,
 TileElement* map_get_track_element_at_with_direction_from_ride(
     int32_t x, int32_t y, int32_t z, int32_t direction, ride_id_t rideIndex)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_TRACK))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
     {
@@ -3991,6 +4289,11 @@ void map_offset_with_rotation(int16_t* x, int16_t* y, int16_t offsetX, int16_t o
 
 TileElement* map_get_wall_element_at(int32_t x, int32_t y, int32_t z, int32_t direction)
 {
+    if (!tile_element_summary_may_contain(x >> 5, y >> 5, TILE_ELEMENT_TYPE_WALL))
+    {
+        return nullptr;
+    }
+
     TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
     {
@@ -4049,6 +4352,7 @@ void FixLandOwnershipTilesWithOwnership(std::initializer_list<TileCoordsXY> tile
     {
         currentElement = map_get_surface_element_at((*tile).x, (*tile).y);
         currentElement->AsSurface()->SetOwnership(ownership);
+        map_mark_tile_for_update((*tile).x * 32, (*tile).y * 32);
         update_park_fences_around_tile({ (*tile).x * 32, (*tile).y * 32 });
     }
 }
@@ -15,6 +15,7 @@
 #include "TileElement.h"
 
 #include <initializer_list>
+#include <memory>
 #include <vector>
 
 #define MINIMUM_LAND_HEIGHT 2
@@ -26,9 +27,12 @@
 #define MAXIMUM_MAP_SIZE_TECHNICAL 256
 #define MINIMUM_MAP_SIZE_PRACTICAL (MINIMUM_MAP_SIZE_TECHNICAL - 2)
 #define MAXIMUM_MAP_SIZE_PRACTICAL (MAXIMUM_MAP_SIZE_TECHNICAL - 2)
+// The map size in coordinate units, i.e. the first x or y coordinate past the last tile
+#define MAXIMUM_MAP_SIZE_BIG (MAXIMUM_MAP_SIZE_TECHNICAL * 32)
 
 #define MAP_MINIMUM_X_Y (-MAXIMUM_MAP_SIZE_TECHNICAL)
 
+// The number of elements that fit in a saved park, more are kept in extra chunks of storage while playing
 #define MAX_TILE_ELEMENTS 196096 // 0x30000
 #define MAX_TILE_TILE_ELEMENT_POINTERS (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL)
 #define MAX_PEEP_SPAWNS 8
@@ -87,7 +91,7 @@ extern const TileCoordsXY TileDirectionDelta[];
 
 extern uint16_t gWidePathTileLoopX;
 extern uint16_t gWidePathTileLoopY;
-extern uint16_t gGrassSceneryTileLoopPosition;
+extern uint32_t gGrassSceneryTileLoopPosition;
 
 extern int16_t gMapSizeUnits;
 extern int16_t gMapSizeMinus2;
@@ -104,8 +108,11 @@ extern uint8_t gMapSelectArrowDirection;
 
 extern uint8_t gMapGroundFlags;
 
-extern TileElement gTileElements[MAX_TILE_TILE_ELEMENT_POINTERS * 3];
-extern TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
+using TileElementChunkList = std::vector<std::unique_ptr<TileElement[]>>;
+
+extern TileElement* gTileElements;
+extern TileElement** gTileElementTilePointers;
+extern TileElementChunkList* gTileElementChunks;
 
 extern LocationXY16 gMapSelectionTiles[300];
 extern std::vector<PeepSpawn> gPeepSpawns;
@@ -129,10 +136,27 @@ extern LocationXYZ16 gCommandPosition;
 
 extern bool gMapLandRightsUpdateSuccess;
 
+/**
+ * The tile elements of a world together with the state describing their layout. The map functions work on whichever
+ * storage is active, which is the park's own unless another one has been swapped in.
+ */
+struct MapStorage
+{
+    TileElement* TileElements;        // MAX_TILE_TILE_ELEMENT_POINTERS * 3 elements
+    TileElement** TileElementPointers; // MAX_TILE_TILE_ELEMENT_POINTERS pointers
+    TileElementChunkList* TileElementChunks;
+    TileElement* NextFreeTileElement;
+    int16_t MapSizeUnits;
+    int16_t MapSizeMinus2;
+    int16_t MapSize;
+};
+
 void map_init(int32_t size);
+MapStorage map_swap_storage(const MapStorage& storage);
 void map_count_remaining_land_rights();
 void map_strip_ghost_flag_from_elements();
 void map_update_tile_pointers();
+void map_storage_changed();
 TileElement* map_get_first_element_at(int32_t x, int32_t y);
 TileElement* map_get_nth_element_at(int32_t x, int32_t y, int32_t n);
 void map_set_tile_elements(int32_t x, int32_t y, TileElement* elements);
@@ -233,6 +257,8 @@ void tile_element_iterator_restart_for_tile(tile_element_iterator* it);
 
 void wall_remove_intersecting_walls(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t direction);
 void map_update_tiles();
+void map_mark_tile_for_update(int32_t x, int32_t y);
+void map_mark_all_tiles_for_update();
 int32_t map_get_highest_z(int32_t tileX, int32_t tileY);
 
 bool tile_element_wants_path_connection_towards(TileCoordsXYZD coords, const TileElement* const elementToBeRemoved);
@@ -251,6 +277,7 @@ void map_invalidate_tile_zoom0(int32_t x, int32_t y, int32_t z0, int32_t z1);
 void map_invalidate_tile_full(int32_t x, int32_t y);
 void map_invalidate_element(int32_t x, int32_t y, TileElement* tileElement);
 void map_invalidate_region(const LocationXY16& mins, const LocationXY16& maxs);
+bool map_take_invalidated_tiles(std::vector<TileCoordsXY>& tiles);
 
 int32_t map_get_tile_side(int32_t mapX, int32_t mapY);
 int32_t map_get_tile_quadrant(int32_t mapX, int32_t mapY);
@@ -14,10 +14,10 @@
 #include "../common.h"
 #include "../core/Guard.hpp"
 #include "../core/Imaging.h"
+#include "../core/JobPool.hpp"
 #include "../core/String.hpp"
 #include "../localisation/StringIds.h"
 #include "../object/Object.h"
-#include "../platform/platform.h"
 #include "../util/Util.h"
 #include "Map.h"
 #include "MapHelpers.h"
@@ -28,7 +28,10 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #pragma region Height map struct
@@ -86,14 +89,18 @@ static constexpr const uint8_t BaseTerrain[] = { TERRAIN_GRASS, TERRAIN_SAND, TE
 
 static void mapgen_place_trees();
 static void mapgen_set_water_level(int32_t waterLevel);
-static void mapgen_smooth_height(int32_t iterations);
+static void mapgen_smooth_height(int32_t iterations, JobPool* jobPool);
 static void mapgen_set_height();
 
-static void mapgen_simplex(mapgen_settings* settings);
+static void mapgen_simplex(mapgen_settings* settings, JobPool* jobPool);
 
 static int32_t _heightSize;
 static uint8_t* _height;
 
+// The noise and smoothing stages work on bands of rows of the height map in parallel. Each band only writes its own
+// rows, so the result is the same no matter how many threads there are or in which order the bands finish.
+constexpr int32_t MAPGEN_ROWS_PER_BAND = 16;
+
 static int32_t get_height(int32_t x, int32_t y)
 {
     if (x >= 0 && y >= 0 && x < _heightSize && y < _heightSize)
@@ -108,6 +115,38 @@ static void set_height(int32_t x, int32_t y, int32_t height)
         _height[x + y * _heightSize] = height;
 }
 
+/**
+ * Creates the job pool the stages of one generation share, or nullptr if there is only one hardware thread to run on.
+ */
+static std::unique_ptr<JobPool> mapgen_create_job_pool()
+{
+    if (std::thread::hardware_concurrency() <= 1)
+    {
+        return nullptr;
+    }
+    return std::make_unique<JobPool>();
+}
+
+/**
+ * Calls processRows for bands of the rows from startRow up to endRow, spread over the job pool, and waits for all of them.
+ */
+static void mapgen_process_rows(
+    JobPool* jobPool, int32_t startRow, int32_t endRow, const std::function<void(int32_t, int32_t)>& processRows)
+{
+    if (jobPool == nullptr)
+    {
+        processRows(startRow, endRow);
+        return;
+    }
+
+    for (int32_t bandStart = startRow; bandStart < endRow; bandStart += MAPGEN_ROWS_PER_BAND)
+    {
+        int32_t bandEnd = std::min(bandStart + MAPGEN_ROWS_PER_BAND, endRow);
+        jobPool->AddTask([&processRows, bandStart, bandEnd]() { processRows(bandStart, bandEnd); });
+    }
+    jobPool->Join();
+}
+
 void mapgen_generate_blank(mapgen_settings* settings)
 {
     int32_t x, y;
@@ -136,7 +175,7 @@ void mapgen_generate(mapgen_settings* settings)
     int32_t x, y, mapSize, floorTexture, wallTexture, waterLevel;
     TileElement* tileElement;
 
-    util_srand((int32_t)platform_get_ticks());
+    util_srand((int32_t)settings->seed);
 
     mapSize = settings->mapSize;
     floorTexture = settings->floor;
@@ -184,8 +223,10 @@ void mapgen_generate(mapgen_settings* settings)
     _height = new uint8_t[_heightSize * _heightSize];
     std::fill_n(_height, _heightSize * _heightSize, 0x00);
 
-    mapgen_simplex(settings);
-    mapgen_smooth_height(2 + (util_rand() % 6));
+    auto jobPool = mapgen_create_job_pool();
+    mapgen_simplex(settings, jobPool.get());
+    mapgen_smooth_height(2 + (util_rand() % 6), jobPool.get());
+    jobPool.reset();
 
     // Set the game map to the height map
     mapgen_set_height();
@@ -305,9 +346,14 @@ static void mapgen_place_trees()
         }
     }
 
-    CoordsXY tmp, pos;
+    struct TreePosition
+    {
+        CoordsXY Location;
+        uint8_t SurfaceStyle;
+    };
+    TreePosition tmp;
 
-    std::vector<CoordsXY> availablePositions;
+    std::vector<TreePosition> availablePositions;
 
     // Create list of available tiles
     for (int32_t y = 1; y < gMapSize - 1; y++)
@@ -320,9 +366,7 @@ static void mapgen_place_trees()
             if (tileElement->AsSurface()->GetWaterHeight() > 0)
                 continue;
 
-            pos.x = x;
-            pos.y = y;
-            availablePositions.push_back(pos);
+            availablePositions.push_back({ { x, y }, (uint8_t)tileElement->AsSurface()->GetSurfaceStyle() });
         }
     }
 
@@ -345,11 +389,11 @@ static void mapgen_place_trees()
 
     for (int32_t i = 0; i < numTrees; i++)
     {
-        pos = availablePositions[i];
+        const TreePosition& pos = availablePositions[i];
 
+        // Placing trees does not change the surface, so the style found when listing the tiles is still valid
         int32_t type = -1;
-        TileElement* tileElement = map_get_surface_element_at(pos.x, pos.y);
-        switch (tileElement->AsSurface()->GetSurfaceStyle())
+        switch (pos.SurfaceStyle)
         {
             case TERRAIN_GRASS:
             case TERRAIN_DIRT:
@@ -379,7 +423,7 @@ static void mapgen_place_trees()
         }
 
         if (type != -1)
-            mapgen_place_tree(type, pos.x, pos.y);
+            mapgen_place_tree(type, pos.Location.x, pos.Location.y);
     }
 }
 
@@ -407,31 +451,32 @@ static void mapgen_set_water_level(int32_t waterLevel)
 /**
  * Smooths the height map.
  */
-static void mapgen_smooth_height(int32_t iterations)
+static void mapgen_smooth_height(int32_t iterations, JobPool* jobPool)
 {
-    int32_t i, x, y, xx, yy, avg;
     int32_t arraySize = _heightSize * _heightSize * sizeof(uint8_t);
     uint8_t* copyHeight = new uint8_t[arraySize];
 
-    for (i = 0; i < iterations; i++)
+    for (int32_t i = 0; i < iterations; i++)
     {
         std::memcpy(copyHeight, _height, arraySize);
-        for (y = 1; y < _heightSize - 1; y++)
-        {
-            for (x = 1; x < _heightSize - 1; x++)
+        mapgen_process_rows(jobPool, 1, _heightSize - 1, [copyHeight](int32_t startRow, int32_t endRow) {
+            for (int32_t y = startRow; y < endRow; y++)
             {
-                avg = 0;
-                for (yy = -1; yy <= 1; yy++)
+                for (int32_t x = 1; x < _heightSize - 1; x++)
                 {
-                    for (xx = -1; xx <= 1; xx++)
+                    int32_t avg = 0;
+                    for (int32_t yy = -1; yy <= 1; yy++)
                     {
-                        avg += copyHeight[(y + yy) * _heightSize + (x + xx)];
+                        for (int32_t xx = -1; xx <= 1; xx++)
+                        {
+                            avg += copyHeight[(y + yy) * _heightSize + (x + xx)];
+                        }
                     }
+                    avg /= 9;
+                    set_height(x, y, avg);
                 }
-                avg /= 9;
-                set_height(x, y, avg);
             }
-        }
+        });
     }
 
     delete[] copyHeight;
@@ -489,6 +534,11 @@ static void mapgen_set_height()
  *   - https://code.google.com/p/fractalterraingeneration/wiki/Fractional_Brownian_Motion
  */
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define MAPGEN_NOISE_SSE2
+#    include <emmintrin.h>
+#endif
+
 static float generate(float x, float y);
 static int32_t fast_floor(float x);
 static float grad(int32_t hash, float x, float y);
@@ -503,7 +553,7 @@ static void noise_rand()
     }
 }
 
-static float fractal_noise(int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence)
+float mapgen_fractal_noise(int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence)
 {
     float total = 0.0f;
     float amplitude = persistence;
@@ -560,8 +610,8 @@ static float generate(float x, float y)
     float y2 = y0 - 1.0f + 2.0f * G2;
 
     // Wrap the integer indices at 256, to avoid indexing perm[] out of bounds
-    int32_t ii = i % 256;
-    int32_t jj = j % 256;
+    int32_t ii = i & 0xFF;
+    int32_t jj = j & 0xFF;
 
     // Calculate the contribution from the three corners
     float t0 = 0.5f - x0 * x0 - y0 * y0;
@@ -615,10 +665,126 @@ static float grad(int32_t hash, float x, float y)
     return ((h & 1) != 0 ? -u : u) + ((h & 2) != 0 ? -2.0f * v : 2.0f * v);
 }
 
-static void mapgen_simplex(mapgen_settings* settings)
+#ifdef MAPGEN_NOISE_SSE2
+
+// The functions below evaluate the noise for four points at once. They perform the same single precision operations in
+// the same order as their scalar counterparts, so a map generated from a seed does not depend on whether it was built
+// with them.
+
+static __m128i fast_floor_sse2(__m128 x)
 {
-    int32_t x, y;
+    __m128i truncated = _mm_cvttps_epi32(x);
+    __m128i positive = _mm_castps_si128(_mm_cmpgt_ps(x, _mm_setzero_ps()));
+    return _mm_add_epi32(truncated, _mm_andnot_si128(positive, _mm_set1_epi32(-1)));
+}
+
+static __m128 grad_sse2(__m128i hash, __m128 x, __m128 y)
+{
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+
+    __m128i h = _mm_and_si128(hash, _mm_set1_epi32(7));
+    __m128 swapped = _mm_castsi128_ps(_mm_cmpgt_epi32(h, _mm_set1_epi32(3)));
+    __m128 u = _mm_or_ps(_mm_and_ps(swapped, y), _mm_andnot_ps(swapped, x));
+    __m128 v = _mm_or_ps(_mm_and_ps(swapped, x), _mm_andnot_ps(swapped, y));
+
+    __m128i one = _mm_set1_epi32(1);
+    __m128i two = _mm_set1_epi32(2);
+    __m128 negateU = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(h, one), one));
+    __m128 negateV = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(h, two), two));
+    u = _mm_xor_ps(u, _mm_and_ps(negateU, signBit));
+    v = _mm_xor_ps(_mm_mul_ps(_mm_set1_ps(2.0f), v), _mm_and_ps(negateV, signBit));
+    return _mm_add_ps(u, v);
+}
+
+static __m128 corner_sse2(__m128i hash, __m128 x, __m128 y)
+{
+    __m128 t = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.5f), _mm_mul_ps(x, x)), _mm_mul_ps(y, y));
+    __m128 contributes = _mm_cmpnlt_ps(t, _mm_setzero_ps());
+    t = _mm_mul_ps(t, t);
+    __m128 n = _mm_mul_ps(_mm_mul_ps(t, t), grad_sse2(hash, x, y));
+    return _mm_and_ps(contributes, n);
+}
+
+static __m128 generate_sse2(__m128 x, __m128 y)
+{
+    const float G2 = 0.211324865f;
+
+    __m128 s = _mm_mul_ps(_mm_add_ps(x, y), _mm_set1_ps(0.366025403f));
+    __m128i i = fast_floor_sse2(_mm_add_ps(x, s));
+    __m128i j = fast_floor_sse2(_mm_add_ps(y, s));
+
+    __m128 t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(i, j)), _mm_set1_ps(G2));
+    __m128 x0 = _mm_sub_ps(x, _mm_sub_ps(_mm_cvtepi32_ps(i), t));
+    __m128 y0 = _mm_sub_ps(y, _mm_sub_ps(_mm_cvtepi32_ps(j), t));
+
+    __m128 lower = _mm_cmpgt_ps(x0, y0);
+    __m128 i1 = _mm_and_ps(lower, _mm_set1_ps(1.0f));
+    __m128 j1 = _mm_andnot_ps(lower, _mm_set1_ps(1.0f));
+
+    __m128 x1 = _mm_add_ps(_mm_sub_ps(x0, i1), _mm_set1_ps(G2));
+    __m128 y1 = _mm_add_ps(_mm_sub_ps(y0, j1), _mm_set1_ps(G2));
+    __m128 x2 = _mm_add_ps(_mm_sub_ps(x0, _mm_set1_ps(1.0f)), _mm_set1_ps(2.0f * G2));
+    __m128 y2 = _mm_add_ps(_mm_sub_ps(y0, _mm_set1_ps(1.0f)), _mm_set1_ps(2.0f * G2));
+
+    // The permutation table has no vector lookup, so the hashes are gathered one point at a time
+    alignas(16) int32_t is[4], js[4], hashes0[4], hashes1[4], hashes2[4];
+    _mm_store_si128((__m128i*)is, i);
+    _mm_store_si128((__m128i*)js, j);
+    int32_t lowerMask = _mm_movemask_ps(lower);
+    for (int32_t lane = 0; lane < 4; lane++)
+    {
+        int32_t ii = is[lane] & 0xFF;
+        int32_t jj = js[lane] & 0xFF;
+        int32_t laneI1 = (lowerMask >> lane) & 1;
+        int32_t laneJ1 = laneI1 ^ 1;
+        hashes0[lane] = perm[ii + perm[jj]];
+        hashes1[lane] = perm[ii + laneI1 + perm[jj + laneJ1]];
+        hashes2[lane] = perm[ii + 1 + perm[jj + 1]];
+    }
+
+    __m128 n0 = corner_sse2(_mm_load_si128((const __m128i*)hashes0), x0, y0);
+    __m128 n1 = corner_sse2(_mm_load_si128((const __m128i*)hashes1), x1, y1);
+    __m128 n2 = corner_sse2(_mm_load_si128((const __m128i*)hashes2), x2, y2);
+    return _mm_mul_ps(_mm_set1_ps(40.0f), _mm_add_ps(_mm_add_ps(n0, n1), n2));
+}
+
+#endif // MAPGEN_NOISE_SSE2
+
+/**
+ * Calculates the fractal noise of the first width points of row y, four at a time where SSE2 is available.
+ */
+void mapgen_fractal_noise_row(
+    int32_t y, int32_t width, float frequency, int32_t octaves, float lacunarity, float persistence, float* noiseValues)
+{
+    int32_t x = 0;
+#ifdef MAPGEN_NOISE_SSE2
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128 xs = _mm_cvtepi32_ps(_mm_setr_epi32(x, x + 1, x + 2, x + 3));
+        __m128 ys = _mm_set1_ps((float)y);
 
+        __m128 total = _mm_setzero_ps();
+        float octaveFrequency = frequency;
+        float amplitude = persistence;
+        for (int32_t i = 0; i < octaves; i++)
+        {
+            __m128 scale = _mm_set1_ps(octaveFrequency);
+            __m128 noise = generate_sse2(_mm_mul_ps(xs, scale), _mm_mul_ps(ys, scale));
+            total = _mm_add_ps(total, _mm_mul_ps(noise, _mm_set1_ps(amplitude)));
+            octaveFrequency *= lacunarity;
+            amplitude *= persistence;
+        }
+        _mm_storeu_ps(noiseValues + x, total);
+    }
+#endif
+    for (; x < width; x++)
+    {
+        noiseValues[x] = mapgen_fractal_noise(x, y, frequency, octaves, lacunarity, persistence);
+    }
+}
+
+static void mapgen_simplex(mapgen_settings* settings, JobPool* jobPool)
+{
     float freq = settings->simplex_base_freq * (1.0f / _heightSize);
     int32_t octaves = settings->simplex_octaves;
 
@@ -626,16 +792,20 @@ static void mapgen_simplex(mapgen_settings* settings)
     int32_t high = settings->simplex_high;
 
     noise_rand();
-    for (y = 0; y < _heightSize; y++)
-    {
-        for (x = 0; x < _heightSize; x++)
+    mapgen_process_rows(jobPool, 0, _heightSize, [freq, octaves, low, high](int32_t startRow, int32_t endRow) {
+        std::vector<float> noiseValues(_heightSize);
+        for (int32_t y = startRow; y < endRow; y++)
         {
-            float noiseValue = std::clamp(fractal_noise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
-            float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
+            mapgen_fractal_noise_row(y, _heightSize, freq, octaves, 2.0f, 0.65f, noiseValues.data());
+            for (int32_t x = 0; x < _heightSize; x++)
+            {
+                float noiseValue = std::clamp(noiseValues[x], -1.0f, 1.0f);
+                float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
-            set_height(x, y, low + (int32_t)(normalisedNoiseValue * high));
+                set_height(x, y, low + (int32_t)(normalisedNoiseValue * high));
+            }
         }
-    }
+    });
 }
 
 #pragma endregion
@@ -722,44 +892,42 @@ void mapgen_unload_heightmap()
  */
 static void mapgen_smooth_heightmap(uint8_t* src, int32_t strength)
 {
+    auto jobPool = mapgen_create_job_pool();
+
     // Create buffer to store one channel
     uint8_t* dest = new uint8_t[_heightMapData.width * _heightMapData.height];
 
     for (int32_t i = 0; i < strength; i++)
     {
         // Calculate box blur value to all pixels of the surface
-        for (uint32_t y = 0; y < _heightMapData.height; y++)
-        {
-            for (uint32_t x = 0; x < _heightMapData.width; x++)
+        mapgen_process_rows(jobPool.get(), 0, _heightMapData.height, [src, dest](int32_t startRow, int32_t endRow) {
+            for (uint32_t y = startRow; y < (uint32_t)endRow; y++)
             {
-                uint32_t heightSum = 0;
-
-                // Loop over neighbour pixels, all of them have the same weight
-                for (int8_t offsetX = -1; offsetX <= 1; offsetX++)
+                for (uint32_t x = 0; x < _heightMapData.width; x++)
                 {
-                    for (int8_t offsetY = -1; offsetY <= 1; offsetY++)
+                    uint32_t heightSum = 0;
+
+                    // Loop over neighbour pixels, all of them have the same weight
+                    for (int8_t offsetX = -1; offsetX <= 1; offsetX++)
                     {
-                        // Clamp x and y so they stay within the image
-                        // This assumes the height map is not tiled, and increases the weight of the edges
-                        const int32_t readX = std::clamp<int32_t>(x + offsetX, 0, _heightMapData.width - 1);
-                        const int32_t readY = std::clamp<int32_t>(y + offsetY, 0, _heightMapData.height - 1);
-                        heightSum += src[readX + readY * _heightMapData.width];
+                        for (int8_t offsetY = -1; offsetY <= 1; offsetY++)
+                        {
+                            // Clamp x and y so they stay within the image
+                            // This assumes the height map is not tiled, and increases the weight of the edges
+                            const int32_t readX = std::clamp<int32_t>(x + offsetX, 0, _heightMapData.width - 1);
+                            const int32_t readY = std::clamp<int32_t>(y + offsetY, 0, _heightMapData.height - 1);
+                            heightSum += src[readX + readY * _heightMapData.width];
+                        }
                     }
-                }
 
-                // Take average
-                dest[x + y * _heightMapData.width] = heightSum / 9;
+                    // Take average
+                    dest[x + y * _heightMapData.width] = heightSum / 9;
+                }
             }
-        }
+        });
 
         // Now apply the blur to the source pixels
-        for (uint32_t y = 0; y < _heightMapData.height; y++)
-        {
-            for (uint32_t x = 0; x < _heightMapData.width; x++)
-            {
-                src[x + y * _heightMapData.width] = dest[x + y * _heightMapData.width];
-            }
-        }
+        std::memcpy(src, dest, _heightMapData.width * _heightMapData.height);
     }
 
     delete[] dest;
@@ -19,6 +19,8 @@ struct mapgen_settings
     int32_t water_level;
     int32_t floor;
     int32_t wall;
+    // Everything random about the generated map follows from this
+    uint32_t seed;
 
     // Features (e.g. tree, rivers, lakes etc.)
     int32_t trees;
@@ -42,3 +44,8 @@ void mapgen_generate_custom_simplex(mapgen_settings* settings);
 bool mapgen_load_heightmap(const utf8* path);
 void mapgen_unload_heightmap();
 void mapgen_generate_from_heightmap(mapgen_settings* settings);
+
+// The simplex noise of the last generated map, for a single point and for a row at a time
+float mapgen_fractal_noise(int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence);
+void mapgen_fractal_noise_row(
+    int32_t y, int32_t width, float frequency, int32_t octaves, float lacunarity, float persistence, float* noiseValues);
@@ -270,6 +270,7 @@ static money32 map_buy_land_rights_for_tile(int32_t x, int32_t y, int32_t settin
             if (flags & GAME_COMMAND_FLAG_APPLY)
             {
                 surfaceElement->SetOwnership(OWNERSHIP_OWNED);
+                map_mark_tile_for_update(x, y);
                 update_park_fences_around_tile({ x, y });
             }
             return gLandPrice;
@@ -383,6 +384,7 @@ static money32 map_buy_land_rights_for_tile(int32_t x, int32_t y, int32_t settin
                     gPeepSpawns.end());
             }
             surfaceElement->SetOwnership(newOwnership);
+            map_mark_tile_for_update(x, y);
             update_park_fences_around_tile({ x, y });
             gMapLandRightsUpdateSuccess = true;
             return 0;
@@ -0,0 +1,668 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TileElementAllocator.h"
+
+#include "../ride/TrackCircuit.h"
+#include "../ride/TrackDesign.h"
+#include "Map.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+// The elements of a tile are stored next to each other, so adding one used to mean copying the whole column to the end
+// of the used part of gTileElements and leaving a hole behind, with the entire array being compacted at once whenever
+// the end was reached. Instead, a column grows into a free slot directly above or below it where possible, and is
+// otherwise moved into a hole of the right size left behind by another column. The holes that remain are squeezed out
+// a few columns per tick by sliding them towards the start of the storage.
+//
+// Slots are numbered across the park's own array followed by the extra chunks in gTileElementChunks, which are added
+// once the array is full. The first MAX_TILE_ELEMENTS slots are the ones that fit in a saved park. A column never
+// spans two chunks, and chunks are never moved, so element pointers stay valid as the storage grows.
+
+constexpr int32_t TILE_ELEMENT_BASE_SLOT_COUNT = MAX_TILE_TILE_ELEMENT_POINTERS * 3;
+constexpr int32_t TILE_ELEMENT_CHUNK_SIZE = MAX_TILE_TILE_ELEMENT_POINTERS;
+// Keeps slot numbers well within int32_t, at 512 KiB per chunk this is far beyond what any park needs
+constexpr int32_t TILE_ELEMENT_MAX_CHUNKS = 1024;
+constexpr int32_t TILE_ELEMENT_ALLOCATOR_MAX_RUN = 32;
+constexpr int32_t TILE_ELEMENT_COMPACTION_STEP = 2048;
+constexpr int32_t TILE_ELEMENT_COMPACTION_MIN_HOLES = 1024;
+constexpr int32_t TILE_ELEMENT_COMPACTION_HEADROOM = MAX_TILE_ELEMENTS / 8;
+constexpr uint32_t TILE_ELEMENT_NO_OWNER = UINT32_MAX;
+
+static std::vector<bool> _tileElementSlotsUsed;
+static std::vector<uint32_t> _tileElementColumnOwners;
+static std::array<std::vector<int32_t>, TILE_ELEMENT_ALLOCATOR_MAX_RUN + 1> _tileElementFreeRuns;
+static int32_t _tileElementSlotsUsedCount;
+static int32_t _tileElementEnd;
+static bool _tileElementAllocatorValid;
+
+// Slots in [write - 1, read] are being compacted and must not be handed out, so the column at read stays in place
+static bool _tileElementCompacting;
+static int32_t _tileElementCompactionRead;
+static int32_t _tileElementCompactionWrite;
+
+struct TileElementAllocatorState
+{
+    std::vector<bool> SlotsUsed;
+    std::vector<uint32_t> ColumnOwners;
+    std::array<std::vector<int32_t>, TILE_ELEMENT_ALLOCATOR_MAX_RUN + 1> FreeRuns;
+    int32_t SlotsUsedCount = 0;
+    int32_t End = 0;
+    bool Valid = false;
+    bool Compacting = false;
+    int32_t CompactionRead = 0;
+    int32_t CompactionWrite = 0;
+};
+
+static int32_t tile_element_allocator_get_slot_count()
+{
+    return TILE_ELEMENT_BASE_SLOT_COUNT + (int32_t)gTileElementChunks->size() * TILE_ELEMENT_CHUNK_SIZE;
+}
+
+static TileElement* tile_element_allocator_get_slot(int32_t index)
+{
+    if (index < TILE_ELEMENT_BASE_SLOT_COUNT)
+    {
+        return &gTileElements[index];
+    }
+    index -= TILE_ELEMENT_BASE_SLOT_COUNT;
+    return &(*gTileElementChunks)[index / TILE_ELEMENT_CHUNK_SIZE][index % TILE_ELEMENT_CHUNK_SIZE];
+}
+
+static int32_t tile_element_allocator_get_slot_index(const TileElement* tileElement)
+{
+    if (tileElement >= gTileElements && tileElement < gTileElements + TILE_ELEMENT_BASE_SLOT_COUNT)
+    {
+        return (int32_t)(tileElement - gTileElements);
+    }
+    for (size_t i = 0; i < gTileElementChunks->size(); i++)
+    {
+        const TileElement* chunk = (*gTileElementChunks)[i].get();
+        if (tileElement >= chunk && tileElement < chunk + TILE_ELEMENT_CHUNK_SIZE)
+        {
+            return TILE_ELEMENT_BASE_SLOT_COUNT + (int32_t)i * TILE_ELEMENT_CHUNK_SIZE + (int32_t)(tileElement - chunk);
+        }
+    }
+    return -1;
+}
+
+/**
+ * Gets the first slot after the array or chunk containing the given slot, columns have to end before it.
+ */
+static int32_t tile_element_allocator_get_region_end(int32_t index)
+{
+    if (index < TILE_ELEMENT_BASE_SLOT_COUNT)
+    {
+        return MAX_TILE_ELEMENTS;
+    }
+    int32_t chunk = (index - TILE_ELEMENT_BASE_SLOT_COUNT) / TILE_ELEMENT_CHUNK_SIZE;
+    return TILE_ELEMENT_BASE_SLOT_COUNT + (chunk + 1) * TILE_ELEMENT_CHUNK_SIZE;
+}
+
+/**
+ * Gets the first slot of the next chunk after the given slot, allocating the chunk if it does not exist yet. Returns -1
+ * if there is no memory left for it.
+ */
+static int32_t tile_element_allocator_get_next_region(int32_t index)
+{
+    int32_t next = index < TILE_ELEMENT_BASE_SLOT_COUNT ? TILE_ELEMENT_BASE_SLOT_COUNT
+                                                        : tile_element_allocator_get_region_end(index);
+    if (next >= tile_element_allocator_get_slot_count())
+    {
+        if (gTileElementChunks->size() >= TILE_ELEMENT_MAX_CHUNKS)
+        {
+            return -1;
+        }
+        try
+        {
+            gTileElementChunks->push_back(std::make_unique<TileElement[]>(TILE_ELEMENT_CHUNK_SIZE));
+        }
+        catch (const std::bad_alloc&)
+        {
+            log_error("Unable to allocate memory for map elements.");
+            return -1;
+        }
+        _tileElementSlotsUsed.resize(tile_element_allocator_get_slot_count(), false);
+        _tileElementColumnOwners.resize(tile_element_allocator_get_slot_count(), TILE_ELEMENT_NO_OWNER);
+    }
+    return next;
+}
+
+/**
+ * Gets the first slot at or after the given one from which a column of the given length fits within a single chunk,
+ * allocating a new chunk if needed. Returns -1 if there is no memory left for it.
+ */
+static int32_t tile_element_allocator_get_run_start(int32_t index, int32_t length)
+{
+    if (index == tile_element_allocator_get_slot_count())
+    {
+        // The last chunk is full and the next one has not been allocated yet
+        return tile_element_allocator_get_next_region(index - 1);
+    }
+    if (index + length > tile_element_allocator_get_region_end(index))
+    {
+        return tile_element_allocator_get_next_region(index);
+    }
+    return index;
+}
+
+static void tile_element_allocator_free_unused_chunks(int32_t end)
+{
+    while (!gTileElementChunks->empty() && tile_element_allocator_get_slot_count() - TILE_ELEMENT_CHUNK_SIZE >= end)
+    {
+        gTileElementChunks->pop_back();
+    }
+}
+
+static void tile_element_allocator_set_end(int32_t end)
+{
+    _tileElementEnd = end;
+    gNextFreeTileElement = gTileElements + std::min(end, MAX_TILE_ELEMENTS);
+}
+
+static int32_t tile_element_allocator_get_column_length(const TileElement* tileElement)
+{
+    const TileElement* start = tileElement;
+    while (!(tileElement++)->IsLastForTile())
+        ;
+    return (int32_t)(tileElement - start);
+}
+
+static void tile_element_allocator_push_free_run(int32_t start, int32_t length)
+{
+    while (length > 0)
+    {
+        int32_t runLength = std::min(length, TILE_ELEMENT_ALLOCATOR_MAX_RUN);
+        _tileElementFreeRuns[runLength].push_back(start);
+        start += runLength;
+        length -= runLength;
+    }
+}
+
+/**
+ * Rebuilds which slots are in use from the tile pointers, for after the layout has been changed without going through
+ * the allocator, e.g. by loading a park or swapping in another map storage.
+ */
+static void tile_element_allocator_refresh()
+{
+    if (_tileElementAllocatorValid)
+    {
+        return;
+    }
+
+    _tileElementSlotsUsed.assign(tile_element_allocator_get_slot_count(), false);
+    _tileElementColumnOwners.assign(tile_element_allocator_get_slot_count(), TILE_ELEMENT_NO_OWNER);
+    for (auto& runs : _tileElementFreeRuns)
+    {
+        runs.clear();
+    }
+    _tileElementSlotsUsedCount = 0;
+    _tileElementCompacting = false;
+
+    int32_t end = 0;
+    for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+    {
+        const TileElement* tileElement = gTileElementTilePointers[i];
+        if (tileElement == nullptr)
+        {
+            continue;
+        }
+
+        int32_t start = tile_element_allocator_get_slot_index(tileElement);
+        if (start == -1)
+        {
+            log_error("Elements of tile %d are outside the map element storage", i);
+            continue;
+        }
+
+        int32_t length = tile_element_allocator_get_column_length(tileElement);
+        _tileElementColumnOwners[start] = i;
+        for (int32_t j = start; j < start + length; j++)
+        {
+            _tileElementSlotsUsed[j] = true;
+        }
+        _tileElementSlotsUsedCount += length;
+        end = std::max(end, start + length);
+    }
+    tile_element_allocator_set_end(end);
+
+    int32_t runStart = -1;
+    for (int32_t i = 0; i <= end; i++)
+    {
+        bool isFree = i < end && !_tileElementSlotsUsed[i] && (i < MAX_TILE_ELEMENTS || i >= TILE_ELEMENT_BASE_SLOT_COUNT);
+        if (isFree && runStart != -1 && i == tile_element_allocator_get_region_end(runStart))
+        {
+            tile_element_allocator_push_free_run(runStart, i - runStart);
+            runStart = -1;
+        }
+        if (isFree && runStart == -1)
+        {
+            runStart = i;
+        }
+        else if (!isFree && runStart != -1)
+        {
+            tile_element_allocator_push_free_run(runStart, i - runStart);
+            runStart = -1;
+        }
+    }
+    _tileElementAllocatorValid = true;
+}
+
+static bool tile_element_allocator_is_slot_free(int32_t index)
+{
+    if (index < 0 || index >= tile_element_allocator_get_slot_count()
+        || (index >= MAX_TILE_ELEMENTS && index < TILE_ELEMENT_BASE_SLOT_COUNT))
+    {
+        return false;
+    }
+    if (_tileElementCompacting && index >= _tileElementCompactionWrite - 1 && index <= _tileElementCompactionRead)
+    {
+        return false;
+    }
+    return index == _tileElementEnd || (index < _tileElementEnd && !_tileElementSlotsUsed[index]);
+}
+
+static void tile_element_allocator_claim_slots(int32_t start, int32_t length)
+{
+    for (int32_t i = start; i < start + length; i++)
+    {
+        _tileElementSlotsUsed[i] = true;
+    }
+    _tileElementSlotsUsedCount += length;
+    if (start + length > _tileElementEnd)
+    {
+        tile_element_allocator_set_end(start + length);
+    }
+}
+
+static void tile_element_allocator_release_slots(int32_t start, int32_t length)
+{
+    for (int32_t i = start; i < start + length; i++)
+    {
+        _tileElementSlotsUsed[i] = false;
+        tile_element_allocator_get_slot(i)->base_height = 0xFF;
+    }
+    _tileElementSlotsUsedCount -= length;
+
+    if (start + length == _tileElementEnd)
+    {
+        tile_element_allocator_set_end(start);
+    }
+    else
+    {
+        tile_element_allocator_push_free_run(start, length);
+    }
+}
+
+static bool tile_element_allocator_is_run_free(int32_t start, int32_t length)
+{
+    if (start + length > _tileElementEnd || start + length > tile_element_allocator_get_region_end(start))
+    {
+        return false;
+    }
+    for (int32_t i = start; i < start + length; i++)
+    {
+        if (!tile_element_allocator_is_slot_free(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Finds room for a column of the given length, preferring a hole of exactly that size, then a larger hole which is
+ * split, and only then the end of the used slots, moving on to a new chunk if the current one is full. Holes that have
+ * since been taken are dropped.
+ */
+static int32_t tile_element_allocator_allocate_run(int32_t length)
+{
+    for (int32_t runLength = length; runLength <= TILE_ELEMENT_ALLOCATOR_MAX_RUN; runLength++)
+    {
+        auto& runs = _tileElementFreeRuns[runLength];
+        while (!runs.empty())
+        {
+            int32_t start = runs.back();
+            runs.pop_back();
+            if (tile_element_allocator_is_run_free(start, runLength))
+            {
+                if (runLength > length)
+                {
+                    tile_element_allocator_push_free_run(start + length, runLength - length);
+                }
+                tile_element_allocator_claim_slots(start, length);
+                return start;
+            }
+        }
+    }
+
+    int32_t end = _tileElementEnd;
+    int32_t start = tile_element_allocator_get_run_start(end, length);
+    if (start == -1)
+    {
+        return -1;
+    }
+    if (start != end && end < tile_element_allocator_get_region_end(end))
+    {
+        // Whatever is left at the end of the full chunk can still be used for shorter columns
+        tile_element_allocator_push_free_run(end, tile_element_allocator_get_region_end(end) - end);
+    }
+    tile_element_allocator_claim_slots(start, length);
+    return start;
+}
+
+static void tile_element_allocator_set_column(int32_t tileIndex, int32_t oldStart, int32_t newStart)
+{
+    _tileElementColumnOwners[oldStart] = TILE_ELEMENT_NO_OWNER;
+    _tileElementColumnOwners[newStart] = tileIndex;
+    gTileElementTilePointers[tileIndex] = tile_element_allocator_get_slot(newStart);
+}
+
+/**
+ * Makes room for a new element at the given position within a tile's elements and returns it, leaving it to the caller
+ * to fill in. The tile's elements may be moved, so any pointers to them are invalidated. Returns nullptr if no more
+ * memory can be allocated for map elements.
+ */
+TileElement* tile_element_allocator_insert(int32_t tileIndex, int32_t position)
+{
+    tile_element_allocator_refresh();
+
+    TileElement* first = gTileElementTilePointers[tileIndex];
+    int32_t start = tile_element_allocator_get_slot_index(first);
+    int32_t length = tile_element_allocator_get_column_length(first);
+    int32_t regionEnd = tile_element_allocator_get_region_end(start);
+
+    // Grow into the slot after the last element
+    if (start + length < regionEnd && tile_element_allocator_is_slot_free(start + length))
+    {
+        tile_element_allocator_claim_slots(start + length, 1);
+        std::memmove(first + position + 1, first + position, (length - position) * sizeof(TileElement));
+        return first + position;
+    }
+
+    // Grow into the slot before the first element
+    if (tile_element_allocator_get_region_end(start - 1) == regionEnd && tile_element_allocator_is_slot_free(start - 1))
+    {
+        tile_element_allocator_claim_slots(start - 1, 1);
+        std::memmove(first - 1, first, position * sizeof(TileElement));
+        tile_element_allocator_set_column(tileIndex, start, start - 1);
+        return first - 1 + position;
+    }
+
+    int32_t newStart = tile_element_allocator_allocate_run(length + 1);
+    if (newStart == -1)
+    {
+        return nullptr;
+    }
+
+    TileElement* destination = tile_element_allocator_get_slot(newStart);
+    std::copy(first, first + position, destination);
+    std::copy(first + position, first + length, destination + position + 1);
+    tile_element_allocator_set_column(tileIndex, start, newStart);
+    tile_element_allocator_release_slots(start, length);
+    return destination + position;
+}
+
+/**
+ * Frees the slot of an element that is no longer part of its tile, which must have been the last one of the column.
+ */
+void tile_element_allocator_release(TileElement* tileElement)
+{
+    tileElement->base_height = 0xFF;
+    if (_tileElementAllocatorValid)
+    {
+        tile_element_allocator_release_slots(tile_element_allocator_get_slot_index(tileElement), 1);
+    }
+}
+
+/**
+ * Gets the index of the tile the given element belongs to, or -1 if it is not part of any tile.
+ */
+int32_t tile_element_allocator_get_tile_index(const TileElement* tileElement)
+{
+    tile_element_allocator_refresh();
+
+    int32_t index = tile_element_allocator_get_slot_index(tileElement);
+    if (index == -1 || !_tileElementSlotsUsed[index])
+    {
+        return -1;
+    }
+
+    // Walk back to the start of the column, the slot before it is either free or the last element of another column
+    int32_t regionStart = index < TILE_ELEMENT_BASE_SLOT_COUNT
+        ? 0
+        : index - (index - TILE_ELEMENT_BASE_SLOT_COUNT) % TILE_ELEMENT_CHUNK_SIZE;
+    while (index > regionStart && _tileElementSlotsUsed[index - 1]
+           && !tile_element_allocator_get_slot(index - 1)->IsLastForTile())
+    {
+        index--;
+    }
+
+    uint32_t owner = _tileElementColumnOwners[index];
+    return owner == TILE_ELEMENT_NO_OWNER ? -1 : (int32_t)owner;
+}
+
+/**
+ * Checks whether the given number of elements can still be added, which only fails once no more memory can be
+ * allocated for them.
+ */
+bool tile_element_allocator_reserve(int32_t numElements)
+{
+    tile_element_allocator_refresh();
+
+    // Allocate the next chunk up front if the elements might not fit in the current one, the worst case being a column
+    // of the longest length that is kept in the free lists being moved to the end
+    int32_t required = numElements + TILE_ELEMENT_ALLOCATOR_MAX_RUN;
+    return tile_element_allocator_get_run_start(_tileElementEnd, required) != -1;
+}
+
+/**
+ * Moves the elements of all tiles next to each other in tile order, as the park file format expects them. The park's
+ * own array is filled first, tiles that do not fit in it anymore are placed in the extra chunks.
+ */
+void tile_element_allocator_reorganise()
+{
+    std::vector<TileElement> elements;
+    elements.reserve(MAX_TILE_ELEMENTS);
+    for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+    {
+        const TileElement* tileElement = gTileElementTilePointers[i];
+        elements.insert(elements.end(), tileElement, tileElement + tile_element_allocator_get_column_length(tileElement));
+    }
+
+    int32_t index = 0;
+    const TileElement* source = elements.data();
+    for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+    {
+        int32_t length = tile_element_allocator_get_column_length(source);
+        index = tile_element_allocator_get_run_start(index, length);
+        if (index == -1)
+        {
+            log_fatal("Unable to allocate memory for map elements.");
+            return;
+        }
+
+        TileElement* destination = tile_element_allocator_get_slot(index);
+        std::copy(source, source + length, destination);
+        gTileElementTilePointers[i] = destination;
+        source += length;
+        index += length;
+    }
+
+    if (index < TILE_ELEMENT_BASE_SLOT_COUNT)
+    {
+        std::memset(&gTileElements[index], 0, (TILE_ELEMENT_BASE_SLOT_COUNT - index) * sizeof(TileElement));
+    }
+    tile_element_allocator_free_unused_chunks(index);
+
+    tile_element_allocator_set_end(index);
+    tile_element_allocator_invalidate();
+}
+
+/**
+ * Gets whether all elements are in the park's own array, which is required for saving the park.
+ */
+bool tile_element_allocator_fits_legacy_storage()
+{
+    tile_element_allocator_refresh();
+    return _tileElementEnd <= MAX_TILE_ELEMENTS;
+}
+
+TileElementStorageStats tile_element_allocator_get_stats()
+{
+    tile_element_allocator_refresh();
+
+    TileElementStorageStats stats = {};
+    stats.ElementCount = _tileElementSlotsUsedCount;
+    stats.SlotCount = tile_element_allocator_get_slot_count();
+    stats.ExtraChunkCount = (int32_t)gTileElementChunks->size();
+    for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+    {
+        const TileElement* tileElement = gTileElementTilePointers[i];
+        do
+        {
+            stats.ElementCountByType[tileElement->GetType() >> 2]++;
+        } while (!(tileElement++)->IsLastForTile());
+    }
+    return stats;
+}
+
+static void tile_element_allocator_finish_compaction()
+{
+    tile_element_allocator_set_end(std::min(_tileElementEnd, _tileElementCompactionWrite));
+    for (auto& runs : _tileElementFreeRuns)
+    {
+        runs.clear();
+    }
+    _tileElementCompacting = false;
+
+    // Chunks that are now entirely past the end are no longer needed
+    tile_element_allocator_free_unused_chunks(_tileElementEnd);
+    _tileElementSlotsUsed.resize(tile_element_allocator_get_slot_count());
+    _tileElementColumnOwners.resize(tile_element_allocator_get_slot_count());
+}
+
+/**
+ * Moves the next few columns down into the holes before them. A compaction pass is started once enough of the used
+ * slots are holes, or when the end of them gets close to the end of the park's own array.
+ */
+void tile_element_allocator_update()
+{
+    tile_element_allocator_refresh();
+
+    // Saving a track design holds pointers to the selected elements, so columns must stay put until it is done
+    if (gTrackDesignSaveMode)
+    {
+        return;
+    }
+
+    if (!_tileElementCompacting)
+    {
+        int32_t end = _tileElementEnd;
+        int32_t holes = end - _tileElementSlotsUsedCount;
+        if (end > MAX_TILE_ELEMENTS)
+        {
+            holes -= TILE_ELEMENT_BASE_SLOT_COUNT - MAX_TILE_ELEMENTS;
+        }
+        if (holes < TILE_ELEMENT_COMPACTION_MIN_HOLES
+            || (holes * 8 < end && end + TILE_ELEMENT_COMPACTION_HEADROOM < MAX_TILE_ELEMENTS))
+        {
+            return;
+        }
+        _tileElementCompacting = true;
+        _tileElementCompactionRead = 0;
+        _tileElementCompactionWrite = 0;
+    }
+
+    int32_t budget = TILE_ELEMENT_COMPACTION_STEP;
+    while (budget > 0)
+    {
+        int32_t read = _tileElementCompactionRead;
+        int32_t write = _tileElementCompactionWrite;
+        if (read >= _tileElementEnd)
+        {
+            tile_element_allocator_finish_compaction();
+            break;
+        }
+        if (!_tileElementSlotsUsed[read])
+        {
+            _tileElementCompactionRead++;
+            budget--;
+            continue;
+        }
+
+        uint32_t tileIndex = _tileElementColumnOwners[read];
+        if (tileIndex == TILE_ELEMENT_NO_OWNER)
+        {
+            log_error("Tile element %d is not the start of a tile, rebuilding allocator state", read);
+            tile_element_allocator_invalidate();
+            break;
+        }
+
+        TileElement* source = tile_element_allocator_get_slot(read);
+        int32_t length = tile_element_allocator_get_column_length(source);
+        // If the column does not fit in what is left of this chunk, read is past it and the next chunk exists
+        write = tile_element_allocator_get_run_start(write, length);
+        if (write != read)
+        {
+            TileElement* destination = tile_element_allocator_get_slot(write);
+            bool movedTrack = false;
+            for (int32_t i = 0; i < length; i++)
+            {
+                movedTrack |= source[i].GetType() == TILE_ELEMENT_TYPE_TRACK;
+                _tileElementSlotsUsed[read + i] = false;
+            }
+            if (movedTrack)
+            {
+                track_circuit_invalidate_tile(tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL, tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL);
+            }
+            std::memmove(destination, source, length * sizeof(TileElement));
+            for (int32_t i = write; i < write + length; i++)
+            {
+                _tileElementSlotsUsed[i] = true;
+            }
+            for (int32_t i = std::max(read, write + length); i < read + length; i++)
+            {
+                tile_element_allocator_get_slot(i)->base_height = 0xFF;
+            }
+            tile_element_allocator_set_column(tileIndex, read, write);
+        }
+        _tileElementCompactionRead = read + length;
+        _tileElementCompactionWrite = write + length;
+        budget -= length;
+    }
+}
+
+void tile_element_allocator_invalidate()
+{
+    _tileElementAllocatorValid = false;
+    _tileElementCompacting = false;
+}
+
+/**
+ * Exchanges the allocator state with the one put aside by map_swap_storage, including any compaction in progress.
+ */
+void tile_element_allocator_swap_state()
+{
+    static TileElementAllocatorState stashedState;
+    std::swap(_tileElementSlotsUsed, stashedState.SlotsUsed);
+    std::swap(_tileElementColumnOwners, stashedState.ColumnOwners);
+    std::swap(_tileElementFreeRuns, stashedState.FreeRuns);
+    std::swap(_tileElementSlotsUsedCount, stashedState.SlotsUsedCount);
+    std::swap(_tileElementEnd, stashedState.End);
+    std::swap(_tileElementAllocatorValid, stashedState.Valid);
+    std::swap(_tileElementCompacting, stashedState.Compacting);
+    std::swap(_tileElementCompactionRead, stashedState.CompactionRead);
+    std::swap(_tileElementCompactionWrite, stashedState.CompactionWrite);
+}
@@ -0,0 +1,36 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <array>
+
+struct TileElement;
+
+struct TileElementStorageStats
+{
+    int32_t ElementCount;
+    int32_t SlotCount;
+    int32_t ExtraChunkCount;
+    // Indexed by element type >> 2
+    std::array<int32_t, 16> ElementCountByType;
+};
+
+TileElement* tile_element_allocator_insert(int32_t tileIndex, int32_t position);
+void tile_element_allocator_release(TileElement* tileElement);
+int32_t tile_element_allocator_get_tile_index(const TileElement* tileElement);
+bool tile_element_allocator_reserve(int32_t numElements);
+void tile_element_allocator_reorganise();
+bool tile_element_allocator_fits_legacy_storage();
+TileElementStorageStats tile_element_allocator_get_stats();
+void tile_element_allocator_update();
+void tile_element_allocator_invalidate();
+void tile_element_allocator_swap_state();
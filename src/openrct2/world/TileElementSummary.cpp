@@ -0,0 +1,147 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TileElementSummary.h"
+
+#include "Map.h"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+// Typed lookups such as map_get_path_element_at walk every element of a tile, even though most tiles hold only a surface
+// and a few other types. Each tile keeps a mask of the element types it may contain so those lookups can return early.
+// The mask only ever has to be a superset of the types on the tile: an insert sets every bit, because the new element's
+// type is not assigned until after tile_element_insert returns, and the tile is recomputed on the next game tick.
+// Removals leave the mask as it is and tiles are tightened again by a sweep over a few tiles each tick.
+// Heights are deliberately not summarised, base_height is written in place all over the code base.
+
+constexpr int32_t TILE_ELEMENT_SUMMARY_TILE_COUNT = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+constexpr int32_t TILE_ELEMENT_SUMMARY_SWEEP_TILES = 256;
+constexpr uint16_t TILE_ELEMENT_SUMMARY_ALL_TYPES = 0xFFFF;
+
+static std::array<uint16_t, TILE_ELEMENT_SUMMARY_TILE_COUNT> _tileElementSummaryTypes;
+static std::vector<int32_t> _tileElementSummaryChangedTiles;
+static int32_t _tileElementSummarySweepPosition = 0;
+static bool _tileElementSummaryInvalidated = true;
+
+struct TileElementSummaryState
+{
+    std::array<uint16_t, TILE_ELEMENT_SUMMARY_TILE_COUNT> Types;
+    std::vector<int32_t> ChangedTiles;
+    int32_t SweepPosition = 0;
+    bool Invalidated = true;
+};
+
+static uint16_t tile_element_summary_get_type_bit(uint8_t type)
+{
+    return 1 << ((type & TILE_ELEMENT_TYPE_MASK) >> 2);
+}
+
+static void tile_element_summary_rebuild_tile(int32_t tileIndex)
+{
+    uint16_t types = 0;
+    const TileElement* tileElement = gTileElementTilePointers[tileIndex];
+    if (tileElement != nullptr)
+    {
+        do
+        {
+            types |= tile_element_summary_get_type_bit(tileElement->GetType());
+        } while (!(tileElement++)->IsLastForTile());
+    }
+    _tileElementSummaryTypes[tileIndex] = types;
+}
+
+static void tile_element_summary_refresh()
+{
+    if (_tileElementSummaryInvalidated)
+    {
+        for (int32_t i = 0; i < TILE_ELEMENT_SUMMARY_TILE_COUNT; i++)
+        {
+            tile_element_summary_rebuild_tile(i);
+        }
+        _tileElementSummaryChangedTiles.clear();
+        _tileElementSummaryInvalidated = false;
+    }
+}
+
+/**
+ * Whether the tile at the given tile coordinates may hold an element of the given type. A false return guarantees there
+ * is none, a true return means the tile still has to be searched.
+ */
+bool tile_element_summary_may_contain(int32_t x, int32_t y, uint8_t type)
+{
+    if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        return true;
+    }
+
+    tile_element_summary_refresh();
+    return (_tileElementSummaryTypes[y * MAXIMUM_MAP_SIZE_TECHNICAL + x] & tile_element_summary_get_type_bit(type)) != 0;
+}
+
+/**
+ * Widens the summary of the tile to every type until the next update, for when an element is inserted on it.
+ */
+void tile_element_summary_mark_changed(int32_t x, int32_t y)
+{
+    if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        return;
+    }
+
+    tile_element_summary_refresh();
+    int32_t tileIndex = y * MAXIMUM_MAP_SIZE_TECHNICAL + x;
+    if (_tileElementSummaryTypes[tileIndex] != TILE_ELEMENT_SUMMARY_ALL_TYPES)
+    {
+        _tileElementSummaryTypes[tileIndex] = TILE_ELEMENT_SUMMARY_ALL_TYPES;
+        _tileElementSummaryChangedTiles.push_back(tileIndex);
+    }
+}
+
+/**
+ * Recomputes the tiles elements were inserted on and sweeps over a few more to drop types that have been removed.
+ * Must only be called when no element is half constructed, i.e. between game actions.
+ */
+void tile_element_summary_update()
+{
+    if (_tileElementSummaryInvalidated)
+    {
+        return;
+    }
+
+    for (int32_t tileIndex : _tileElementSummaryChangedTiles)
+    {
+        tile_element_summary_rebuild_tile(tileIndex);
+    }
+    _tileElementSummaryChangedTiles.clear();
+
+    for (int32_t i = 0; i < TILE_ELEMENT_SUMMARY_SWEEP_TILES; i++)
+    {
+        tile_element_summary_rebuild_tile(_tileElementSummarySweepPosition);
+        _tileElementSummarySweepPosition = (_tileElementSummarySweepPosition + 1) % TILE_ELEMENT_SUMMARY_TILE_COUNT;
+    }
+}
+
+void tile_element_summary_invalidate_all()
+{
+    _tileElementSummaryInvalidated = true;
+}
+
+/**
+ * Exchanges the summary with the one put aside by map_swap_storage.
+ */
+void tile_element_summary_swap_state()
+{
+    static TileElementSummaryState stashedState;
+    std::swap(_tileElementSummaryTypes, stashedState.Types);
+    std::swap(_tileElementSummaryChangedTiles, stashedState.ChangedTiles);
+    std::swap(_tileElementSummarySweepPosition, stashedState.SweepPosition);
+    std::swap(_tileElementSummaryInvalidated, stashedState.Invalidated);
+}
@@ -0,0 +1,18 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+bool tile_element_summary_may_contain(int32_t x, int32_t y, uint8_t type);
+void tile_element_summary_mark_changed(int32_t x, int32_t y);
+void tile_element_summary_update();
+void tile_element_summary_invalidate_all();
+void tile_element_summary_swap_state();
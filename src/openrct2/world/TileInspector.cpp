@@ -17,10 +17,12 @@
 #include "../localisation/Localisation.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
+#include "../ride/TrackCircuit.h"
 #include "../windows/Intent.h"
 #include "../windows/tile_inspector.h"
 #include "Banner.h"
 #include "Footpath.h"
+#include "FootpathConnectivity.h"
 #include "LargeScenery.h"
 #include "Map.h"
 #include "Park.h"
@@ -67,6 +69,8 @@ static bool map_swap_elements_at(int32_t x, int32_t y, int16_t first, int16_t se
         secondElement->flags ^= TILE_ELEMENT_FLAG_LAST_TILE;
     }
 
+    // Track pieces that were resolved to either element now point at the other one
+    track_circuit_invalidate_tile(x, y);
     return true;
 }
 
@@ -189,6 +193,7 @@ int32_t tile_inspector_swap_elements_at(int32_t x, int32_t y, int16_t first, int
             return MONEY32_UNDEFINED;
         }
         map_invalidate_tile_full(x << 5, y << 5);
+        footpath_invalidate_path_wide_flags(x << 5, y << 5);
 
         // Update the window
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
@@ -258,6 +263,11 @@ int32_t tile_inspector_rotate_element_at(int32_t x, int32_t y, int32_t elementIn
                 break;
             }
             case TILE_ELEMENT_TYPE_TRACK:
+                newRotation = tileElement->GetDirectionWithOffset(1);
+                tileElement->SetDirection(newRotation);
+                track_circuit_invalidate_ride(tileElement->AsTrack()->GetRideIndex());
+                track_circuit_invalidate_tile(x, y);
+                break;
             case TILE_ELEMENT_TYPE_SMALL_SCENERY:
             case TILE_ELEMENT_TYPE_WALL:
                 newRotation = tileElement->GetDirectionWithOffset(1);
@@ -274,6 +284,7 @@ int32_t tile_inspector_rotate_element_at(int32_t x, int32_t y, int32_t elementIn
         }
 
         map_invalidate_tile_full(x << 5, y << 5);
+        footpath_invalidate_path_wide_flags(x << 5, y << 5);
 
         if ((uint32_t)x == windowTileInspectorTileX && (uint32_t)y == windowTileInspectorTileY)
         {
@@ -338,6 +349,14 @@ int32_t tile_inspector_paste_element_at(int32_t x, int32_t y, TileElement elemen
         }
 
         map_invalidate_tile_full(x << 5, y << 5);
+        if (pastedElement->GetType() == TILE_ELEMENT_TYPE_PATH)
+        {
+            footpath_invalidate_path_wide_flags(x << 5, y << 5);
+        }
+        else if (pastedElement->GetType() == TILE_ELEMENT_TYPE_ENTRANCE)
+        {
+            footpath_connectivity_update_tile(x, y);
+        }
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && (uint32_t)x == windowTileInspectorTileX
@@ -402,6 +421,7 @@ int32_t tile_inspector_sort_elements_at(int32_t x, int32_t y, int32_t flags)
         }
 
         map_invalidate_tile_full(x << 5, y << 5);
+        footpath_invalidate_path_wide_flags(x << 5, y << 5);
 
         // Deselect tile for clients who had it selected
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
@@ -452,10 +472,17 @@ int32_t tile_inspector_any_base_height_offset(int32_t x, int32_t y, int16_t elem
             }
         }
 
+        else if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
+        {
+            track_circuit_invalidate_ride(tileElement->AsTrack()->GetRideIndex());
+            track_circuit_invalidate_tile(x, y);
+        }
+
         tileElement->base_height += heightOffset;
         tileElement->clearance_height += heightOffset;
 
         map_invalidate_tile_full(x << 5, y << 5);
+        footpath_invalidate_path_wide_flags(x << 5, y << 5);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && (uint32_t)x == windowTileInspectorTileX
@@ -613,6 +640,7 @@ int32_t tile_inspector_path_set_sloped(int32_t x, int32_t y, int32_t elementInde
         pathElement->AsPath()->SetSloped(sloped);
 
         map_invalidate_tile_full(x << 5, y << 5);
+        footpath_invalidate_path_wide_flags(x << 5, y << 5);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && (uint32_t)x == windowTileInspectorTileX
@@ -638,6 +666,7 @@ int32_t tile_inspector_path_toggle_edge(int32_t x, int32_t y, int32_t elementInd
         pathElement->AsPath()->SetEdgesAndCorners(newEdges);
 
         map_invalidate_tile_full(x << 5, y << 5);
+        footpath_invalidate_path_wide_flags(x << 5, y << 5);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && (uint32_t)x == windowTileInspectorTileX
@@ -829,7 +858,9 @@ int32_t tile_inspector_track_base_height_offset(int32_t x, int32_t y, int32_t el
 
             tileElement->base_height += offset;
             tileElement->clearance_height += offset;
+            track_circuit_invalidate_tile(elemX >> 5, elemY >> 5);
         }
+        track_circuit_invalidate_ride(rideIndex);
     }
 
     // TODO: Only invalidate when one of the affected tiles is selected
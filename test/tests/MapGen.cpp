@@ -0,0 +1,122 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/MapGen.h>
+#include <openrct2/world/Surface.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class MapGenTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+        SUCCEED();
+    }
+
+    static void TearDownTestCase()
+    {
+        if (_context)
+            _context.reset();
+    }
+
+    static mapgen_settings GetSettings(uint32_t seed)
+    {
+        mapgen_settings settings = {};
+        settings.mapSize = 150;
+        settings.height = 14;
+        settings.water_level = 16;
+        settings.floor = -1;
+        settings.wall = -1;
+        settings.seed = seed;
+        settings.trees = 0;
+        settings.simplex_low = 6;
+        settings.simplex_high = 10;
+        settings.simplex_base_freq = 0.6f;
+        settings.simplex_octaves = 4;
+        return settings;
+    }
+
+    static std::vector<uint32_t> GetSurfaces()
+    {
+        std::vector<uint32_t> surfaces;
+        for (int32_t y = 0; y < gMapSize; y++)
+        {
+            for (int32_t x = 0; x < gMapSize; x++)
+            {
+                TileElement* tileElement = map_get_surface_element_at(x, y);
+                if (tileElement == nullptr)
+                {
+                    surfaces.push_back(0);
+                    continue;
+                }
+                auto surface = tileElement->AsSurface();
+                surfaces.push_back(
+                    tileElement->base_height | (surface->GetSlope() << 8) | (surface->GetSurfaceStyle() << 16)
+                    | (surface->GetWaterHeight() << 24));
+            }
+        }
+        return surfaces;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> MapGenTest::_context;
+
+TEST_F(MapGenTest, SameSeedSameMap)
+{
+    // The noise and smoothing are spread over threads, which must not change the result
+    auto settings = GetSettings(1234);
+    mapgen_generate(&settings);
+    auto first = GetSurfaces();
+
+    settings = GetSettings(1234);
+    mapgen_generate(&settings);
+    auto second = GetSurfaces();
+
+    EXPECT_EQ(first, second);
+
+    settings = GetSettings(4321);
+    mapgen_generate(&settings);
+    EXPECT_NE(first, GetSurfaces());
+    SUCCEED();
+}
+
+TEST_F(MapGenTest, NoiseRowMatchesPoints)
+{
+    // Vectorised rows do the same operations in the same order as the point by point noise, so they must give exactly the
+    // same values. The width is chosen so that the row ends with points that are not a multiple of four
+    auto settings = GetSettings(1234);
+    mapgen_generate(&settings);
+
+    constexpr int32_t width = 301;
+    constexpr float frequency = 0.6f / width;
+    std::vector<float> noiseValues(width);
+    for (int32_t y : { 0, 1, 17, 150, 300 })
+    {
+        mapgen_fractal_noise_row(y, width, frequency, 4, 2.0f, 0.65f, noiseValues.data());
+        for (int32_t x = 0; x < width; x++)
+        {
+            EXPECT_EQ(noiseValues[x], mapgen_fractal_noise(x, y, frequency, 4, 2.0f, 0.65f)) << "at " << x << ", " << y;
+        }
+    }
+    SUCCEED();
+}
@@ -0,0 +1,274 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/Cheats.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/world/Footpath.h>
+#include <openrct2/world/FootpathConnectivity.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/Park.h>
+#include <openrct2/world/Surface.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// The number of map_update_path_wide_flags calls it takes to sweep over the whole map once
+constexpr int32_t UPDATES_PER_PASS = (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL) / 128;
+constexpr int32_t UPDATES_PER_SNAPSHOT = 64;
+constexpr int32_t BLOCK_SIZE = 4;
+
+class PathWideFlagsTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+        SUCCEED();
+    }
+
+    static void TearDownTestCase()
+    {
+        if (_context)
+            _context.reset();
+    }
+
+    static void LoadPark()
+    {
+        std::string parkPath = TestData::GetParkPath("tile-element-tests.sv6");
+        load_from_sv6(parkPath.c_str());
+        game_load_init();
+        gCheatsSandboxMode = true;
+        gParkFlags |= PARK_FLAGS_NO_MONEY;
+    }
+
+    /**
+     * Runs the wide path sweep. The legacy sweep recalculates every tile it visits, which is what marking every tile as
+     * changed before each update amounts to.
+     */
+    static void UpdatePathWideFlags(int32_t numUpdates, bool legacy, std::vector<std::vector<bool>>& snapshots)
+    {
+        for (int32_t i = 0; i < numUpdates; i++)
+        {
+            if (legacy)
+            {
+                footpath_invalidate_all_path_wide_flags();
+            }
+            map_update_path_wide_flags();
+            if ((i + 1) % UPDATES_PER_SNAPSHOT == 0)
+            {
+                snapshots.push_back(GetPathWideFlags());
+            }
+        }
+    }
+
+    static std::vector<bool> GetPathWideFlags()
+    {
+        std::vector<bool> wideFlags;
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                TileElement* tileElement = map_get_first_element_at(x, y);
+                if (tileElement == nullptr)
+                    continue;
+                do
+                {
+                    if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH)
+                    {
+                        wideFlags.push_back(tileElement->AsPath()->IsWide());
+                    }
+                } while (!(tileElement++)->IsLastForTile());
+            }
+        }
+        return wideFlags;
+    }
+
+    /**
+     * Finds a square of flat, dry tiles at one height with nothing but the surface on them, so paths can be placed on it.
+     */
+    static bool FindEmptyBlock(int32_t* outX, int32_t* outY, int32_t* outZ)
+    {
+        for (int32_t y = 1; y < gMapSize - BLOCK_SIZE - 1; y++)
+        {
+            for (int32_t x = 1; x < gMapSize - BLOCK_SIZE - 1; x++)
+            {
+                int32_t z = -1;
+                bool empty = true;
+                for (int32_t yOffset = 0; yOffset < BLOCK_SIZE && empty; yOffset++)
+                {
+                    for (int32_t xOffset = 0; xOffset < BLOCK_SIZE && empty; xOffset++)
+                    {
+                        TileElement* tileElement = map_get_first_element_at(x + xOffset, y + yOffset);
+                        empty = tileElement != nullptr && tileElement->IsLastForTile()
+                            && tileElement->GetType() == TILE_ELEMENT_TYPE_SURFACE
+                            && tileElement->AsSurface()->GetSlope() == TILE_ELEMENT_SLOPE_FLAT
+                            && tileElement->AsSurface()->GetWaterHeight() == 0 && (z == -1 || tileElement->base_height == z);
+                        if (empty)
+                        {
+                            z = tileElement->base_height;
+                        }
+                    }
+                }
+                if (empty)
+                {
+                    *outX = x;
+                    *outY = y;
+                    *outZ = z;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Builds a block of paths, lets the flags settle, then removes a corner and a path in the middle of the block. Returns
+     * the wide flags of every path on the map every UPDATES_PER_SNAPSHOT updates.
+     */
+    static std::vector<std::vector<bool>> BuildAndRemovePaths(bool legacy)
+    {
+        std::vector<std::vector<bool>> snapshots;
+        LoadPark();
+        UpdatePathWideFlags(UPDATES_PER_PASS, legacy, snapshots);
+
+        int32_t blockX, blockY, blockZ;
+        EXPECT_TRUE(FindEmptyBlock(&blockX, &blockY, &blockZ));
+
+        const TileElement* pathElement = map_get_footpath_element(19, 18, 14);
+        EXPECT_NE(pathElement, nullptr);
+        int32_t pathType = pathElement != nullptr ? pathElement->AsPath()->GetPathEntryIndex() : 0;
+
+        for (int32_t yOffset = 0; yOffset < BLOCK_SIZE; yOffset++)
+        {
+            for (int32_t xOffset = 0; xOffset < BLOCK_SIZE; xOffset++)
+            {
+                money32 cost = footpath_place(
+                    pathType, (blockX + xOffset) * 32, (blockY + yOffset) * 32, blockZ, 0, GAME_COMMAND_FLAG_APPLY);
+                EXPECT_NE(cost, MONEY32_UNDEFINED);
+            }
+            // Let the sweep run while the block is half built
+            UpdatePathWideFlags(UPDATES_PER_PASS / BLOCK_SIZE, legacy, snapshots);
+        }
+        UpdatePathWideFlags(UPDATES_PER_PASS * 2, legacy, snapshots);
+
+        footpath_remove(blockX * 32, blockY * 32, blockZ, GAME_COMMAND_FLAG_APPLY);
+        UpdatePathWideFlags(UPDATES_PER_PASS / 2, legacy, snapshots);
+        footpath_remove((blockX + 1) * 32, (blockY + 2) * 32, blockZ, GAME_COMMAND_FLAG_APPLY);
+        UpdatePathWideFlags(UPDATES_PER_PASS * 2, legacy, snapshots);
+        return snapshots;
+    }
+
+    /**
+     * Gets the connectivity flags of every path of the block and the number of stranded paths, as the index has them.
+     */
+    static std::vector<int32_t> GetConnectivity(int32_t blockX, int32_t blockY, int32_t blockZ)
+    {
+        std::vector<int32_t> connectivity;
+        for (int32_t yOffset = 0; yOffset < BLOCK_SIZE; yOffset++)
+        {
+            for (int32_t xOffset = 0; xOffset < BLOCK_SIZE; xOffset++)
+            {
+                TileCoordsXYZ location = { blockX + xOffset, blockY + yOffset, blockZ };
+                connectivity.push_back(footpath_connectivity_get_flags(location));
+                connectivity.push_back(footpath_connectivity_are_connected({ blockX, blockY, blockZ }, location));
+            }
+        }
+        connectivity.push_back(footpath_connectivity_count_stranded_paths());
+        return connectivity;
+    }
+
+    static std::vector<int32_t> GetRebuiltConnectivity(int32_t blockX, int32_t blockY, int32_t blockZ)
+    {
+        footpath_connectivity_invalidate();
+        return GetConnectivity(blockX, blockY, blockZ);
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> PathWideFlagsTest::_context;
+
+TEST_F(PathWideFlagsTest, SettledFlags)
+{
+    // Two full passes of the wide path sweep, after which no tile may be left with stale wide flags
+    std::vector<std::vector<bool>> snapshots;
+    LoadPark();
+    UpdatePathWideFlags(UPDATES_PER_PASS * 2, false, snapshots);
+    EXPECT_EQ(footpath_verify_path_wide_flags(), 0);
+    SUCCEED();
+}
+
+TEST_F(PathWideFlagsTest, IncrementalMatchesLegacySweep)
+{
+    // Skipping the tiles whose surroundings have not changed must give the same flags at every point as recalculating
+    // every tile the sweep visits
+    auto incremental = BuildAndRemovePaths(false);
+    EXPECT_EQ(footpath_verify_path_wide_flags(), 0);
+    auto legacy = BuildAndRemovePaths(true);
+
+    ASSERT_EQ(incremental.size(), legacy.size());
+    for (size_t i = 0; i < incremental.size(); i++)
+    {
+        EXPECT_EQ(incremental[i], legacy[i]) << "Wide flags differ after " << (i + 1) * UPDATES_PER_SNAPSHOT << " updates";
+    }
+
+    // The block has settled into wide paths
+    bool anyWide = false;
+    for (bool isWide : legacy.back())
+    {
+        anyWide |= isWide;
+    }
+    EXPECT_TRUE(anyWide);
+    SUCCEED();
+}
+
+TEST_F(PathWideFlagsTest, ConnectivityMatchesRebuild)
+{
+    // Paths joined into the connectivity index as they are placed must give the same answers as rebuilding it
+    LoadPark();
+    int32_t blockX, blockY, blockZ;
+    ASSERT_TRUE(FindEmptyBlock(&blockX, &blockY, &blockZ));
+    const TileElement* pathElement = map_get_footpath_element(19, 18, 14);
+    ASSERT_NE(pathElement, nullptr);
+    int32_t pathType = pathElement->AsPath()->GetPathEntryIndex();
+
+    for (int32_t yOffset = 0; yOffset < BLOCK_SIZE; yOffset++)
+    {
+        for (int32_t xOffset = 0; xOffset < BLOCK_SIZE; xOffset++)
+        {
+            money32 cost = footpath_place(
+                pathType, (blockX + xOffset) * 32, (blockY + yOffset) * 32, blockZ, 0, GAME_COMMAND_FLAG_APPLY);
+            EXPECT_NE(cost, MONEY32_UNDEFINED);
+        }
+        auto incremental = GetConnectivity(blockX, blockY, blockZ);
+        EXPECT_EQ(incremental, GetRebuiltConnectivity(blockX, blockY, blockZ)) << "after row " << yOffset;
+    }
+    EXPECT_TRUE(footpath_connectivity_are_connected(
+        { blockX, blockY, blockZ }, { blockX + BLOCK_SIZE - 1, blockY + BLOCK_SIZE - 1, blockZ }));
+
+    // Removing a row of paths may split the network, which rebuilds the index
+    for (int32_t xOffset = 0; xOffset < BLOCK_SIZE; xOffset++)
+    {
+        footpath_remove((blockX + xOffset) * 32, (blockY + 1) * 32, blockZ, GAME_COMMAND_FLAG_APPLY);
+    }
+    auto incremental = GetConnectivity(blockX, blockY, blockZ);
+    EXPECT_EQ(incremental, GetRebuiltConnectivity(blockX, blockY, blockZ));
+    SUCCEED();
+}
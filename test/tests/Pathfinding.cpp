@@ -11,6 +11,7 @@
 #include <openrct2/ParkImporter.h>
 #include <openrct2/platform/platform.h>
 #include <openrct2/world/Footpath.h>
+#include <openrct2/world/FootpathConnectivity.h>
 #include <openrct2/world/Map.h>
 
 using namespace OpenRCT2;
@@ -215,6 +216,23 @@ TEST_P(SimplePathfindingTest, CanFindPathFromStartToGoal)
     EXPECT_TRUE(succeeded);
 }
 
+TEST_P(SimplePathfindingTest, StartIsConnectedToGoal)
+{
+    const SimplePathfindingScenario& scenario = GetParam();
+
+    ride_id_t rideIndex;
+    Ride* ride = FindRideByName(scenario.name, &rideIndex);
+    ASSERT_NE(ride, nullptr);
+
+    auto entrancePos = ride_get_entrance_location(ride, 0);
+    TileCoordsXYZ goal = TileCoordsXYZ(
+        entrancePos.x - TileDirectionDelta[entrancePos.direction].x,
+        entrancePos.y - TileDirectionDelta[entrancePos.direction].y, entrancePos.z);
+
+    EXPECT_TRUE(footpath_connectivity_are_connected(scenario.start, goal));
+    EXPECT_TRUE(footpath_connectivity_get_flags(goal) & FOOTPATH_CONNECTIVITY_FLAG_RIDE_ENTRANCE);
+}
+
 INSTANTIATE_TEST_CASE_P(
     ForScenario, SimplePathfindingTest,
     ::testing::Values(